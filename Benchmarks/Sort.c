@@ -0,0 +1,188 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <Objectively.h>
+
+/**
+ * @file
+ *
+ * @brief Compares the Sort algorithms to `qsort_r` on Arrays of random Strings and Numbers.
+ *
+ * Usage: `Sort [count]`
+ */
+
+static Order compareStrings(const ident obj1, const ident obj2) {
+
+	const String *a = obj1, *b = obj2;
+
+	return $(a, compareTo, b, (Range) { 0, a->length });
+}
+
+static Order compareNumbers(const ident obj1, const ident obj2) {
+
+	return $((Number *) obj1, compareTo, (Number *) obj2);
+}
+
+/**
+ * @brief The Comparator for the current benchmark.
+ */
+static Comparator comparator;
+
+#if defined(__APPLE__)
+static int _qsort(void *data, const void *a, const void *b) {
+	return ((Comparator) data)(*((const ident *) a), *((const ident *) b));
+}
+#define qsort_comparator(elements, count, comparator) \
+	qsort_r(elements, count, sizeof(ident), comparator, _qsort)
+#elif defined(__MINGW32__)
+static int _qsort(void *data, const void *a, const void *b) {
+	return ((Comparator) data)(*((const ident *) a), *((const ident *) b));
+}
+#define qsort_comparator(elements, count, comparator) \
+	qsort_s(elements, count, sizeof(ident), _qsort, comparator)
+#else
+static int _qsort(const void *a, const void *b, void *data) {
+	return ((Comparator) data)(*((const ident *) a), *((const ident *) b));
+}
+#define qsort_comparator(elements, count, comparator) \
+	qsort_r(elements, count, sizeof(ident), _qsort, comparator)
+#endif
+
+/**
+ * @return The elapsed time since `start`, in milliseconds.
+ */
+static double elapsed(const struct timespec *start) {
+
+	struct timespec end;
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	return (end.tv_sec - start->tv_sec) * 1000.0 + (end.tv_nsec - start->tv_nsec) / 1000000.0;
+}
+
+/**
+ * @brief Times `sort` over a fresh copy of `array`, and verifies the result.
+ */
+static void benchmark(const char *name, const Array *array, void (*sort)(ident *, size_t, SortOptions), SortOptions options) {
+
+	MutableArray *copy = $(array, mutableCopy);
+
+	ident *elements = ((Array *) copy)->elements;
+	const size_t count = ((Array *) copy)->count;
+
+	struct timespec start;
+	clock_gettime(CLOCK_MONOTONIC, &start);
+
+	sort(elements, count, options);
+
+	const double ms = elapsed(&start);
+
+	for (size_t i = 1; i < count; i++) {
+		if (comparator(elements[i - 1], elements[i]) == OrderDescending) {
+			fprintf(stderr, "%s: elements out of order at %zu\n", name, i);
+			exit(1);
+		}
+	}
+
+	printf("%-24s %10.2f ms\n", name, ms);
+
+	release(copy);
+}
+
+static void sort_qsort(ident *elements, size_t count, SortOptions options) {
+	qsort_comparator(elements, count, comparator);
+}
+
+static void sort_sort(ident *elements, size_t count, SortOptions options) {
+	Sort(elements, count, comparator, options);
+}
+
+static void sort_key(ident *elements, size_t count, SortOptions options) {
+	SortByKey(elements, count);
+}
+
+int main(int argc, char **argv) {
+
+	const size_t count = argc > 1 ? strtoul(argv[1], NULL, 10) : 1000000;
+
+	srand(time(NULL));
+
+	MutableArray *strings = $$(MutableArray, arrayWithCapacity, count);
+
+	for (size_t i = 0; i < count; i++) {
+
+		String *string = str("%08x%08x", rand(), rand());
+
+		$(strings, addObject, string);
+
+		release(string);
+	}
+
+	comparator = compareStrings;
+
+	printf("Sorting %zu Strings\n", count);
+
+	benchmark("qsort_r", (Array *) strings, sort_qsort, SortOptionNone);
+	benchmark("SortOptionNone", (Array *) strings, sort_sort, SortOptionNone);
+	benchmark("SortOptionStable", (Array *) strings, sort_sort, SortOptionStable);
+	benchmark("SortOptionConcurrent", (Array *) strings, sort_sort, SortOptionConcurrent);
+	benchmark("SortByKey", (Array *) strings, sort_key, SortOptionNone);
+
+	Array *sorted = $((Array *) strings, sortedArrayWithOptions, comparator, SortOptionNone);
+
+	benchmark("qsort_r (sorted)", sorted, sort_qsort, SortOptionNone);
+	benchmark("SortOptionNone (sorted)", sorted, sort_sort, SortOptionNone);
+	benchmark("SortOptionStable (sorted)", sorted, sort_sort, SortOptionStable);
+	benchmark("SortByKey (sorted)", sorted, sort_key, SortOptionNone);
+
+	release(sorted);
+	release(strings);
+
+	MutableArray *numbers = $$(MutableArray, arrayWithCapacity, count);
+
+	for (size_t i = 0; i < count; i++) {
+
+		Number *number = $$(Number, numberWithValue, (rand() - RAND_MAX / 2) / 3.0);
+
+		$(numbers, addObject, number);
+
+		release(number);
+	}
+
+	comparator = compareNumbers;
+
+	printf("Sorting %zu Numbers\n", count);
+
+	benchmark("qsort_r", (Array *) numbers, sort_qsort, SortOptionNone);
+	benchmark("SortOptionNone", (Array *) numbers, sort_sort, SortOptionNone);
+	benchmark("SortOptionStable", (Array *) numbers, sort_sort, SortOptionStable);
+	benchmark("SortByKey", (Array *) numbers, sort_key, SortOptionNone);
+
+	release(numbers);
+
+	return 0;
+}
@@ -0,0 +1,184 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <Objectively.h>
+
+/**
+ * @file
+ *
+ * @brief Compares String searches to `strstr` and to a naive `strncmp` loop over a large
+ * haystack of random letters, and times UTF-8 validation and code point counting over it.
+ *
+ * Usage: `String [megabytes]`
+ */
+
+/**
+ * @return The elapsed time since `start`, in milliseconds.
+ */
+static double elapsed(const struct timespec *start) {
+
+	struct timespec end;
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	return (end.tv_sec - start->tv_sec) * 1000.0 + (end.tv_nsec - start->tv_nsec) / 1000000.0;
+}
+
+/**
+ * @brief The naive search that String searches replaced.
+ */
+static const char *naive(const char *haystack, size_t length, const char *needle) {
+
+	const size_t len = strlen(needle);
+
+	for (size_t i = 0; i < length; i++) {
+		if (strncmp(haystack + i, needle, len) == 0) {
+			return haystack + i;
+		}
+	}
+
+	return NULL;
+}
+
+/**
+ * @brief Times a search for `needle` in `string` with `options`, and verifies its location.
+ */
+static void benchmark(const String *string, const char *needle, StringSearchOptions options, int expected) {
+
+	const Range range = { 0, string->length };
+
+	struct timespec start;
+	clock_gettime(CLOCK_MONOTONIC, &start);
+
+	const Range match = $(string, rangeOfCharactersWithOptions, needle, range, options);
+
+	const double ms = elapsed(&start);
+
+	if (match.location != expected) {
+		fprintf(stderr, "%s: found at %d, expected %d\n", needle, match.location, expected);
+		exit(1);
+	}
+
+	printf("%-8zu %-24s %10.2f ms\n", strlen(needle),
+		   options & StringSearchOptionBackwards ? "backwards" :
+		   options & StringSearchOptionCaseInsensitive ? "case-insensitive" : "forwards", ms);
+}
+
+int main(int argc, char **argv) {
+
+	const size_t megabytes = argc > 1 ? strtoul(argv[1], NULL, 10) : 64;
+	const size_t length = megabytes << 20;
+
+	srand(time(NULL));
+
+	char *chars = malloc(length + 1);
+	for (size_t i = 0; i < length; i++) {
+		chars[i] = 'a' + rand() % 26;
+	}
+	chars[length] = '\0';
+
+	const char *needles[] = {
+		"#",
+		"##",
+		"needle##",
+		"aaaaaaaaaaaaaaa#",
+		"the quick brown fox jumps over the lazy dog, twice: the quick brown fox #",
+	};
+
+	printf("Searching %zu MB\n", megabytes);
+
+	for (size_t i = 0; i < lengthof(needles); i++) {
+
+		const size_t len = strlen(needles[i]);
+
+		memcpy(chars + length - len, needles[i], len);
+		String *tail = $$(String, stringWithCharacters, chars);
+
+		benchmark(tail, needles[i], StringSearchOptionNone, (int) (length - len));
+		benchmark(tail, needles[i], StringSearchOptionCaseInsensitive, (int) (length - len));
+
+		struct timespec start;
+		clock_gettime(CLOCK_MONOTONIC, &start);
+
+		const char *match = strstr(chars, needles[i]);
+
+		printf("%-8zu %-24s %10.2f ms\n", len, "strstr", elapsed(&start));
+
+		clock_gettime(CLOCK_MONOTONIC, &start);
+
+		if (naive(chars, length, needles[i]) != match) {
+			fprintf(stderr, "%s: naive search disagrees with strstr\n", needles[i]);
+			exit(1);
+		}
+
+		printf("%-8zu %-24s %10.2f ms\n", len, "strncmp", elapsed(&start));
+
+		release(tail);
+
+		for (size_t j = 0; j < len; j++) {
+			chars[length - len + j] = 'a' + rand() % 26;
+		}
+
+		memcpy(chars, needles[i], len);
+		String *head = $$(String, stringWithCharacters, chars);
+
+		benchmark(head, needles[i], StringSearchOptionBackwards, 0);
+
+		release(head);
+
+		for (size_t j = 0; j < len; j++) {
+			chars[j] = 'a' + rand() % 26;
+		}
+	}
+
+	struct timespec start;
+	clock_gettime(CLOCK_MONOTONIC, &start);
+
+	if (IsValidUTF8((uint8_t *) chars, length) == false) {
+		fprintf(stderr, "ASCII haystack is not valid UTF-8\n");
+		exit(1);
+	}
+
+	printf("%-8s %-24s %10.2f ms\n", "-", "IsValidUTF8", elapsed(&start));
+
+	String *string = $$(String, stringWithCharacters, chars);
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+
+	if ($(string, codePointCount) != length) {
+		fprintf(stderr, "codePointCount disagrees with length\n");
+		exit(1);
+	}
+
+	printf("%-8s %-24s %10.2f ms\n", "-", "codePointCount", elapsed(&start));
+
+	release(string);
+
+	free(chars);
+
+	return 0;
+}
@@ -30,25 +30,40 @@
  */
 
 #include <Objectively/Array.h>
+#include <Objectively/BloomFilter.h>
 #include <Objectively/Boole.h>
+#include <Objectively/Cache.h>
 #include <Objectively/Class.h>
+#include <Objectively/ConcurrentDictionary.h>
 #include <Objectively/Condition.h>
+#include <Objectively/CuckooFilter.h>
 #include <Objectively/Data.h>
 #include <Objectively/Date.h>
 #include <Objectively/DateFormatter.h>
+#include <Objectively/Deque.h>
 #include <Objectively/Dictionary.h>
+#include <Objectively/DoubleArray.h>
 #include <Objectively/Enum.h>
 #include <Objectively/Error.h>
 #include <Objectively/Hash.h>
+#include <Objectively/HashMap.h>
+#include <Objectively/ImmutableMap.h>
 #include <Objectively/IndexPath.h>
 #include <Objectively/IndexSet.h>
+#include <Objectively/Int64Array.h>
+#include <Objectively/IntArray.h>
 #include <Objectively/JSONPath.h>
 #include <Objectively/JSONSerialization.h>
 #include <Objectively/Lock.h>
 #include <Objectively/Log.h>
 #include <Objectively/MutableArray.h>
 #include <Objectively/MutableData.h>
+#include <Objectively/MutableDeque.h>
 #include <Objectively/MutableDictionary.h>
+#include <Objectively/MutableDoubleArray.h>
+#include <Objectively/MutableIndexSet.h>
+#include <Objectively/MutableInt64Array.h>
+#include <Objectively/MutableIntArray.h>
 #include <Objectively/MutableSet.h>
 #include <Objectively/MutableString.h>
 #include <Objectively/Null.h>
@@ -58,9 +73,13 @@
 #include <Objectively/Operation.h>
 #include <Objectively/OperationQueue.h>
 #include <Objectively/Once.h>
+#include <Objectively/Parallel.h>
 #include <Objectively/Regex.h>
 #include <Objectively/Set.h>
+#include <Objectively/Sort.h>
 #include <Objectively/String.h>
+#include <Objectively/StringBuilder.h>
+#include <Objectively/StringTokenizer.h>
 #include <Objectively/Thread.h>
 #include <Objectively/Types.h>
 #include <Objectively/URL.h>
@@ -72,3 +91,4 @@
 #include <Objectively/URLSessionTask.h>
 #include <Objectively/URLSessionUploadTask.h>
 #include <Objectively/Value.h>
+#include <Objectively/Vector.h>
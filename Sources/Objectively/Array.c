@@ -24,11 +24,13 @@
 #include <assert.h>
 #include <stdarg.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include <Objectively/Array.h>
 #include <Objectively/Hash.h>
 #include <Objectively/MutableArray.h>
 #include <Objectively/MutableString.h>
+#include <Objectively/Parallel.h>
 
 #define _Class _Array
 
@@ -60,6 +62,22 @@ static void dealloc(Object *self) {
 	super(Object, self, dealloc);
 }
 
+/**
+ * @see Object::deepSizeInBytes(const Object *)
+ */
+static size_t deepSizeInBytes(const Object *self) {
+
+	const Array *this = (Array *) self;
+
+	size_t size = $(self, sizeInBytes);
+
+	for (size_t i = 0; i < this->count; i++) {
+		size += $((Object *) this->elements[i], deepSizeInBytes);
+	}
+
+	return size;
+}
+
 /**
  * @see Object::description(const Object *)
  */
@@ -123,6 +141,16 @@ static _Bool isEqual(const Object *self, const Object *other) {
 	return false;
 }
 
+/**
+ * @see Object::sizeInBytes(const Object *)
+ */
+static size_t sizeInBytes(const Object *self) {
+
+	const Array *this = (Array *) self;
+
+	return super(Object, self, sizeInBytes) + this->count * sizeof(ident);
+}
+
 #pragma mark - Array
 
 
@@ -189,15 +217,21 @@ static String *componentsJoinedByCharacters(const Array *self, const char *chars
 
 	MutableString *string = alloc(MutableString, init);
 
-	for (size_t i = 0; i < self->count; i++) {
+	const size_t length = strlen(chars);
 
-		String *desc = $((Object *) self->elements[i], description);
-		$(string, appendString, desc);
+	for (size_t i = 0; i < self->count; i++) {
 
-		release(desc);
+		const Object *obj = self->elements[i];
+		if ($(obj, isKindOfClass, &_String)) {
+			$(string, appendString, (String *) obj);
+		} else {
+			String *desc = $(obj, description);
+			$(string, appendString, desc);
+			release(desc);
+		}
 
 		if (i < self->count - 1) {
-			$(string, appendCharacters, chars);
+			$(string, appendBytes, (const uint8_t *) chars, length);
 		}
 	}
 
@@ -241,6 +275,105 @@ static void enumerateObjects(const Array *self, ArrayEnumerator enumerator, iden
 	}
 }
 
+/**
+ * @brief The context of Array::enumerateObjectsConcurrently.
+ */
+typedef struct {
+	const Array *array;
+	ArrayEnumerator enumerator;
+	ident data;
+	volatile _Bool stop;
+} EnumerateConcurrently;
+
+/**
+ * @brief ParallelFunction for enumerateObjectsConcurrently.
+ */
+static void enumerateObjectsConcurrently_parallel(size_t chunk, size_t begin, size_t end, ident data) {
+
+	EnumerateConcurrently *context = data;
+
+	for (size_t i = begin; i < end && context->stop == false; i++) {
+		if (context->enumerator(context->array, context->array->elements[i], context->data)) {
+			context->stop = true;
+		}
+	}
+}
+
+/**
+ * @fn void Array::enumerateObjectsConcurrently(const Array *self, ArrayEnumerator enumerator, ident data, size_t chunkSize)
+ *
+ * @memberof Array
+ */
+static void enumerateObjectsConcurrently(const Array *self, ArrayEnumerator enumerator, ident data, size_t chunkSize) {
+
+	assert(enumerator);
+
+	EnumerateConcurrently context = {
+		.array = self,
+		.enumerator = enumerator,
+		.data = data
+	};
+
+	ParallelFor(self->count, chunkSize, enumerateObjectsConcurrently_parallel, &context);
+}
+
+/**
+ * @brief The context of Array::filterConcurrently.
+ */
+typedef struct {
+	const Array *array;
+	Predicate predicate;
+	ident data;
+	_Bool *passed;
+} FilterConcurrently;
+
+/**
+ * @brief ParallelFunction for filterConcurrently.
+ */
+static void filterConcurrently_parallel(size_t chunk, size_t begin, size_t end, ident data) {
+
+	FilterConcurrently *context = data;
+
+	for (size_t i = begin; i < end; i++) {
+		context->passed[i] = context->predicate(context->array->elements[i], context->data);
+	}
+}
+
+/**
+ * @fn Array *Array::filterConcurrently(const Array *self, Predicate predicate, ident data, size_t chunkSize)
+ *
+ * @memberof Array
+ */
+static Array *filterConcurrently(const Array *self, Predicate predicate, ident data, size_t chunkSize) {
+
+	assert(predicate);
+
+	FilterConcurrently context = {
+		.array = self,
+		.predicate = predicate,
+		.data = data,
+		.passed = calloc(self->count + 1, sizeof(_Bool))
+	};
+
+	assert(context.passed);
+
+	ParallelFor(self->count, chunkSize, filterConcurrently_parallel, &context);
+
+	MutableArray *array = alloc(MutableArray, initWithCapacity, self->count);
+	if (array) {
+
+		for (size_t i = 0; i < self->count; i++) {
+			if (context.passed[i]) {
+				$(array, addObject, self->elements[i]);
+			}
+		}
+	}
+
+	free(context.passed);
+
+	return (Array *) array;
+}
+
 /**
  * @fn void Array::filteredArray(const Array *self, Predicate predicate, ident data)
  *
@@ -250,11 +383,17 @@ static Array *filteredArray(const Array *self, Predicate predicate, ident data)
 
 	assert(predicate);
 
-	MutableArray *copy = $(self, mutableCopy);
+	MutableArray *array = alloc(MutableArray, initWithCapacity, self->count);
+	if (array) {
 
-	$(copy, filter, predicate, data);
+		for (size_t i = 0; i < self->count; i++) {
+			if (predicate(self->elements[i], data)) {
+				$(array, addObject, self->elements[i]);
+			}
+		}
+	}
 
-	return (Array *) copy;
+	return (Array *) array;
 }
 
 /**
@@ -382,6 +521,61 @@ static ident lastObject(const Array *self) {
 	return self->count ? $(self, objectAtIndex, self->count - 1) : NULL;
 }
 
+/**
+ * @brief The context of Array::mapConcurrently.
+ */
+typedef struct {
+	const Array *array;
+	Functor functor;
+	ident data;
+	ident *results;
+} MapConcurrently;
+
+/**
+ * @brief ParallelFunction for mapConcurrently.
+ */
+static void mapConcurrently_parallel(size_t chunk, size_t begin, size_t end, ident data) {
+
+	MapConcurrently *context = data;
+
+	for (size_t i = begin; i < end; i++) {
+		context->results[i] = context->functor(context->array->elements[i], context->data);
+	}
+}
+
+/**
+ * @fn Array *Array::mapConcurrently(const Array *self, Functor functor, ident data, size_t chunkSize)
+ *
+ * @memberof Array
+ */
+static Array *mapConcurrently(const Array *self, Functor functor, ident data, size_t chunkSize) {
+
+	assert(functor);
+
+	Array *array = (Array *) super(Object, _alloc(&_Array), init);
+	if (array) {
+
+		if (self->count) {
+
+			MapConcurrently context = {
+				.array = self,
+				.functor = functor,
+				.data = data,
+				.results = calloc(self->count, sizeof(ident))
+			};
+
+			assert(context.results);
+
+			ParallelFor(self->count, chunkSize, mapConcurrently_parallel, &context);
+
+			array->elements = context.results;
+			array->count = self->count;
+		}
+	}
+
+	return array;
+}
+
 /**
  * @fn MutableArray *Array::mutableCopy(const Array *self)
  *
@@ -410,6 +604,71 @@ static ident objectAtIndex(const Array *self, int index) {
 	return self->elements[index];
 }
 
+/**
+ * @brief The context of Array::reduceConcurrently.
+ */
+typedef struct {
+	const Array *array;
+	Reducer reducer;
+	ident data;
+	ident *results;
+} ReduceConcurrently;
+
+/**
+ * @brief ParallelFunction for reduceConcurrently.
+ */
+static void reduceConcurrently_parallel(size_t chunk, size_t begin, size_t end, ident data) {
+
+	ReduceConcurrently *context = data;
+
+	ident accumulator = NULL;
+
+	for (size_t i = begin; i < end; i++) {
+		accumulator = ParallelFold(context->reducer, context->array->elements[i], accumulator, context->data);
+	}
+
+	context->results[chunk] = accumulator;
+}
+
+/**
+ * @fn ident Array::reduceConcurrently(const Array *self, Reducer reducer, Reducer combiner, ident data, size_t chunkSize)
+ *
+ * @memberof Array
+ */
+static ident reduceConcurrently(const Array *self, Reducer reducer, Reducer combiner, ident data, size_t chunkSize) {
+
+	assert(reducer);
+
+	if (self->count == 0) {
+		return NULL;
+	}
+
+	chunkSize = ParallelChunkSize(self->count, chunkSize);
+	const size_t chunks = (self->count + chunkSize - 1) / chunkSize;
+
+	ReduceConcurrently context = {
+		.array = self,
+		.reducer = reducer,
+		.data = data,
+		.results = calloc(chunks, sizeof(ident))
+	};
+
+	assert(context.results);
+
+	ParallelFor(self->count, chunkSize, reduceConcurrently_parallel, &context);
+
+	ident accumulator = context.results[0];
+
+	for (size_t i = 1; i < chunks; i++) {
+		accumulator = ParallelFold(combiner ?: reducer, context.results[i], accumulator, data);
+		release(context.results[i]);
+	}
+
+	free(context.results);
+
+	return accumulator;
+}
+
 /**
  * @fn Array *Array::sortedArray(const Array *self, Comparator comparator)
  *
@@ -417,11 +676,21 @@ static ident objectAtIndex(const Array *self, int index) {
  */
 static Array *sortedArray(const Array *self, Comparator comparator) {
 
+	return $(self, sortedArrayWithOptions, comparator, SortOptionNone);
+}
+
+/**
+ * @fn Array *Array::sortedArrayWithOptions(const Array *self, Comparator comparator, SortOptions options)
+ *
+ * @memberof Array
+ */
+static Array *sortedArrayWithOptions(const Array *self, Comparator comparator, SortOptions options) {
+
 	assert(comparator);
 
 	MutableArray *array = $(self, mutableCopy);
-	
-	$(array, sort, comparator);
+
+	$(array, sortWithOptions, comparator, options);
 
 	return (Array *) array;
 }
@@ -437,9 +706,11 @@ static void initialize(Class *clazz) {
 
 	object->copy = copy;
 	object->dealloc = dealloc;
+	object->deepSizeInBytes = deepSizeInBytes;
 	object->description = description;
 	object->hash = hash;
 	object->isEqual = isEqual;
+	object->sizeInBytes = sizeInBytes;
 
 	ArrayInterface *array = (ArrayInterface *) clazz->interface;
 
@@ -449,6 +720,8 @@ static void initialize(Class *clazz) {
 	array->componentsJoinedByString = componentsJoinedByString;
 	array->containsObject = containsObject;
 	array->enumerateObjects = enumerateObjects;
+	array->enumerateObjectsConcurrently = enumerateObjectsConcurrently;
+	array->filterConcurrently = filterConcurrently;
 	array->filteredArray = filteredArray;
 	array->findObject = findObject;
 	array->firstObject = firstObject;
@@ -456,9 +729,12 @@ static void initialize(Class *clazz) {
 	array->initWithArray = initWithArray;
 	array->initWithObjects = initWithObjects;
 	array->lastObject = lastObject;
+	array->mapConcurrently = mapConcurrently;
 	array->mutableCopy = mutableCopy;
 	array->objectAtIndex = objectAtIndex;
+	array->reduceConcurrently = reduceConcurrently;
 	array->sortedArray = sortedArray;
+	array->sortedArrayWithOptions = sortedArrayWithOptions;
 }
 
 Class _Array = {
@@ -24,6 +24,7 @@
 #pragma once
 
 #include <Objectively/Object.h>
+#include <Objectively/Sort.h>
 
 /**
  * @file
@@ -182,6 +183,39 @@ struct ArrayInterface {
 	 */
 	void (*enumerateObjects)(const Array *self, ArrayEnumerator enumerator, ident data);
 
+	/**
+	 * @fn void Array::enumerateObjectsConcurrently(const Array *self, ArrayEnumerator enumerator, ident data, size_t chunkSize)
+	 *
+	 * @brief Enumerate the elements of this Array concurrently, in chunks.
+	 *
+	 * @param enumerator The enumerator function, which must be thread safe.
+	 * @param data User data.
+	 * @param chunkSize The count of elements per chunk, or `0` to choose one automatically.
+	 *
+	 * @remarks The enumerator may return `true` to stop the enumeration as soon as possible.
+	 * The calling thread participates, and returns once every chunk has completed.
+	 *
+	 * @see ParallelFor(size_t, size_t, ParallelFunction, ident)
+	 *
+	 * @memberof Array
+	 */
+	void (*enumerateObjectsConcurrently)(const Array *self, ArrayEnumerator enumerator, ident data, size_t chunkSize);
+
+	/**
+	 * @fn Array *Array::filterConcurrently(const Array *self, Predicate predicate, ident data, size_t chunkSize)
+	 *
+	 * @brief Creates a new Array with elements that pass `predicate`, evaluated concurrently.
+	 *
+	 * @param predicate The predicate function, which must be thread safe.
+	 * @param data User data.
+	 * @param chunkSize The count of elements per chunk, or `0` to choose one automatically.
+	 *
+	 * @return The new, filtered Array, in the order of this Array.
+	 *
+	 * @memberof Array
+	 */
+	Array *(*filterConcurrently)(const Array *self, Predicate predicate, ident data, size_t chunkSize);
+
 	/**
 	 * @fn void Array::filteredArray(const Array *self, Predicate predicate, ident data)
 	 *
@@ -265,6 +299,21 @@ struct ArrayInterface {
 	 * @memberof Array
 	 */
 	ident (*lastObject)(const Array *self);
+
+	/**
+	 * @fn Array *Array::mapConcurrently(const Array *self, Functor functor, ident data, size_t chunkSize)
+	 *
+	 * @brief Creates a new Array with the results of `functor` applied to each element.
+	 *
+	 * @param functor The Functor, which must be thread safe.
+	 * @param data User data.
+	 * @param chunkSize The count of elements per chunk, or `0` to choose one automatically.
+	 *
+	 * @return The new, mapped Array, in the order of this Array.
+	 *
+	 * @memberof Array
+	 */
+	Array *(*mapConcurrently)(const Array *self, Functor functor, ident data, size_t chunkSize);
 	
 	/**
 	 * @fn MutableArray *Array::mutableCopy(const Array *self)
@@ -289,6 +338,26 @@ struct ArrayInterface {
 	 */
 	ident (*objectAtIndex)(const Array *self, int index);
 
+	/**
+	 * @fn ident Array::reduceConcurrently(const Array *self, Reducer reducer, Reducer combiner, ident data, size_t chunkSize)
+	 *
+	 * @brief Reduces this Array concurrently, in chunks.
+	 *
+	 * @param reducer The Reducer applied to the elements of each chunk, which must be thread safe.
+	 * @param combiner The Reducer applied to the results of the chunks, in order, or `NULL` to
+	 * use `reducer`.
+	 * @param data User data.
+	 * @param chunkSize The count of elements per chunk, or `0` to choose one automatically.
+	 *
+	 * @return The accumulated result, which the caller must release, or `NULL` if this Array is
+	 * empty.
+	 *
+	 * @remarks The result is deterministic for a given chunk size if `combiner` is associative.
+	 *
+	 * @memberof Array
+	 */
+	ident (*reduceConcurrently)(const Array *self, Reducer reducer, Reducer combiner, ident data, size_t chunkSize);
+
 	/**
 	 * @fn Array *Array::sortedArray(const Array *self, Comparator comparator)
 	 *
@@ -299,9 +368,79 @@ struct ArrayInterface {
 	 * @memberof Array
 	 */
 	Array *(*sortedArray)(const Array *self, Comparator comparator);
+
+	/**
+	 * @fn Array *Array::sortedArrayWithOptions(const Array *self, Comparator comparator, SortOptions options)
+	 *
+	 * @param comparator The Comparator.
+	 * @param options The SortOptions.
+	 *
+	 * @return A copy of this Array, sorted by the given Comparator using the algorithm
+	 * selected by `options`.
+	 *
+	 * @memberof Array
+	 */
+	Array *(*sortedArrayWithOptions)(const Array *self, Comparator comparator, SortOptions options);
 };
 
 /**
  * @brief The Array Class.
  */
 extern Class _Array;
+
+/**
+ * @brief A stack-allocated cursor over the elements of an Array.
+ *
+ * @remarks Iterators do not retain the Array, and must not outlive it. The Array must not be
+ * modified while it is being iterated.
+ */
+typedef struct {
+
+	/**
+	 * @brief The Array.
+	 */
+	const Array *array;
+
+	/**
+	 * @brief The index of the next element.
+	 */
+	size_t index;
+} ArrayIterator;
+
+/**
+ * @return An ArrayIterator positioned before the first element of `array`.
+ */
+static inline ArrayIterator MakeArrayIterator(const Array *array) {
+	return (ArrayIterator) { .array = array, .index = 0 };
+}
+
+/**
+ * @brief Advances `iterator` to the next element.
+ *
+ * @param iterator The ArrayIterator.
+ * @param obj Receives the next element.
+ *
+ * @return True if an element was available, false if `iterator` is exhausted.
+ */
+static inline _Bool ArrayIteratorNext(ArrayIterator *iterator, ident *obj) {
+
+	if (iterator->index < iterator->array->count) {
+		*obj = iterator->array->elements[iterator->index++];
+		return true;
+	}
+
+	return false;
+}
+
+/**
+ * @brief Iterates the elements of `array`, assigning each to `obj`.
+ *
+ * @code
+ * String *string;
+ * ArrayForEach(string, strings) {
+ *     puts(string->chars);
+ * }
+ * @endcode
+ */
+#define ArrayForEach(obj, array) \
+	for (ArrayIterator _iterator = MakeArrayIterator(array); ArrayIteratorNext(&_iterator, (ident *) &(obj)); )
@@ -0,0 +1,393 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <assert.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <Objectively/BloomFilter.h>
+#include <Objectively/Hash.h>
+
+#include "LittleEndian.h"
+
+#define _Class _BloomFilter
+
+#define BLOOMFILTER_MAGIC 0x464c424f /* "OBLF" */
+#define BLOOMFILTER_VERSION 1
+#define BLOOMFILTER_HEADER_SIZE 24
+
+/**
+ * @brief A block of words, operated on as a vector.
+ */
+typedef uint32_t Block __attribute__((vector_size(BLOOMFILTER_BLOCK_WORDS * sizeof(uint32_t))));
+
+/**
+ * @brief The odd multipliers that select the bit of each word of a Block.
+ */
+static const Block salts = {
+	0x47b6137b, 0x44974d91, 0x8824ad5b, 0xa2b7289d, 0x705495c7, 0x2df1424b, 0x9efc4947, 0x5c6bfb31
+};
+
+/**
+ * @return The hash of `obj`.
+ */
+static uint64_t hashForObject(const ident obj) {
+
+	const int hash = $((Object *) obj, hash);
+
+	return HashForBytes64(HASH_SEED, (const uint8_t *) &hash, sizeof(hash));
+}
+
+/**
+ * @return The Block of `self` for `hash`.
+ */
+static Block *blockForHash(const BloomFilter *self, uint64_t hash) {
+
+	const size_t index = ((hash >> 32) * self->blockCount) >> 32;
+
+	return (Block *) self->blocks + index;
+}
+
+/**
+ * @brief Writes the mask of one bit per word for `hash` to `mask`.
+ */
+static void maskForHash(uint64_t hash, Block *mask) {
+
+	const Block key = {
+		(uint32_t) hash, (uint32_t) hash, (uint32_t) hash, (uint32_t) hash,
+		(uint32_t) hash, (uint32_t) hash, (uint32_t) hash, (uint32_t) hash
+	};
+
+	const Block one = { 1, 1, 1, 1, 1, 1, 1, 1 };
+
+	*mask = one << ((key * salts) >> 27);
+}
+
+/**
+ * @brief Adds `hash` to `self`.
+ */
+static void addHash(BloomFilter *self, uint64_t hash) {
+
+	Block mask;
+	maskForHash(hash, &mask);
+
+	*blockForHash(self, hash) |= mask;
+
+	self->count++;
+}
+
+/**
+ * @return True if `self` might contain `hash`.
+ */
+static _Bool containsHash(const BloomFilter *self, uint64_t hash) {
+
+	Block mask;
+	maskForHash(hash, &mask);
+
+	const Block missing = mask & ~*blockForHash(self, hash);
+
+	uint32_t any = 0;
+	for (int i = 0; i < BLOOMFILTER_BLOCK_WORDS; i++) {
+		any |= missing[i];
+	}
+
+	return any == 0;
+}
+
+/**
+ * @brief Allocates `blockCount` cache line aligned, zeroed blocks for `self`.
+ */
+static void allocBlocks(BloomFilter *self, size_t blockCount) {
+
+	self->blockCount = max(blockCount, (size_t) 1);
+
+	const size_t size = self->blockCount * sizeof(Block);
+
+	const int err = posix_memalign((void **) &self->blocks, 64, size);
+	assert(err == 0);
+
+	memset(self->blocks, 0, size);
+}
+
+#pragma mark - Object
+
+/**
+ * @see Object::copy(const Object *)
+ */
+static Object *copy(const Object *self) {
+
+	const BloomFilter *this = (BloomFilter *) self;
+
+	BloomFilter *that = (BloomFilter *) super(Object, _alloc(&_BloomFilter), init);
+	if (that) {
+		allocBlocks(that, this->blockCount);
+		memcpy(that->blocks, this->blocks, this->blockCount * sizeof(Block));
+
+		that->count = this->count;
+	}
+
+	return (Object *) that;
+}
+
+/**
+ * @see Object::dealloc(Object *)
+ */
+static void dealloc(Object *self) {
+
+	BloomFilter *this = (BloomFilter *) self;
+
+	free(this->blocks);
+
+	super(Object, self, dealloc);
+}
+
+/**
+ * @see Object::hash(const Object *)
+ */
+static int hash(const Object *self) {
+
+	const BloomFilter *this = (BloomFilter *) self;
+
+	const uint64_t hash = HashForBytes64(HASH_SEED, (const uint8_t *) this->blocks, this->blockCount * sizeof(Block));
+
+	return (int) (uint32_t) hash;
+}
+
+/**
+ * @see Object::isEqual(const Object *, const Object *)
+ */
+static _Bool isEqual(const Object *self, const Object *other) {
+
+	if (super(Object, self, isEqual, other)) {
+		return true;
+	}
+
+	if (other && $(other, isKindOfClass, &_BloomFilter)) {
+
+		const BloomFilter *this = (BloomFilter *) self;
+		const BloomFilter *that = (BloomFilter *) other;
+
+		if (this->blockCount == that->blockCount) {
+			return memcmp(this->blocks, that->blocks, this->blockCount * sizeof(Block)) == 0;
+		}
+	}
+
+	return false;
+}
+
+/**
+ * @see Object::sizeInBytes(const Object *)
+ */
+static size_t sizeInBytes(const Object *self) {
+
+	const BloomFilter *this = (BloomFilter *) self;
+
+	return super(Object, self, sizeInBytes) + this->blockCount * BLOOMFILTER_BLOCK_WORDS * sizeof(uint32_t);
+}
+
+#pragma mark - BloomFilter
+
+/**
+ * @fn void BloomFilter::addBytes(BloomFilter *self, const uint8_t *bytes, size_t length)
+ *
+ * @memberof BloomFilter
+ */
+static void addBytes(BloomFilter *self, const uint8_t *bytes, size_t length) {
+
+	assert(bytes || length == 0);
+
+	addHash(self, HashForBytes64(HASH_SEED, bytes, length));
+}
+
+/**
+ * @fn void BloomFilter::addObject(BloomFilter *self, const ident obj)
+ *
+ * @memberof BloomFilter
+ */
+static void addObject(BloomFilter *self, const ident obj) {
+
+	assert(obj);
+
+	addHash(self, hashForObject(obj));
+}
+
+/**
+ * @fn _Bool BloomFilter::containsBytes(const BloomFilter *self, const uint8_t *bytes, size_t length)
+ *
+ * @memberof BloomFilter
+ */
+static _Bool containsBytes(const BloomFilter *self, const uint8_t *bytes, size_t length) {
+
+	assert(bytes || length == 0);
+
+	return containsHash(self, HashForBytes64(HASH_SEED, bytes, length));
+}
+
+/**
+ * @fn _Bool BloomFilter::containsObject(const BloomFilter *self, const ident obj)
+ *
+ * @memberof BloomFilter
+ */
+static _Bool containsObject(const BloomFilter *self, const ident obj) {
+
+	assert(obj);
+
+	return containsHash(self, hashForObject(obj));
+}
+
+/**
+ * @fn Data *BloomFilter::data(const BloomFilter *self)
+ *
+ * @memberof BloomFilter
+ */
+static Data *data(const BloomFilter *self) {
+
+	const size_t words = self->blockCount * BLOOMFILTER_BLOCK_WORDS;
+	const size_t length = BLOOMFILTER_HEADER_SIZE + words * sizeof(uint32_t);
+
+	uint8_t *bytes = malloc(length);
+	assert(bytes);
+
+	writeLittleEndian(bytes + 0, BLOOMFILTER_MAGIC, 4);
+	writeLittleEndian(bytes + 4, BLOOMFILTER_VERSION, 4);
+	writeLittleEndian(bytes + 8, self->blockCount, 8);
+	writeLittleEndian(bytes + 16, self->count, 8);
+
+	for (size_t i = 0; i < words; i++) {
+		writeLittleEndian(bytes + BLOOMFILTER_HEADER_SIZE + i * sizeof(uint32_t), self->blocks[i], 4);
+	}
+
+	return $$(Data, dataWithMemory, bytes, length);
+}
+
+/**
+ * @fn BloomFilter *BloomFilter::initWithCapacity(BloomFilter *self, size_t capacity, double falsePositiveRate)
+ *
+ * @memberof BloomFilter
+ */
+static BloomFilter *initWithCapacity(BloomFilter *self, size_t capacity, double falsePositiveRate) {
+
+	assert(falsePositiveRate > 0.0);
+	assert(falsePositiveRate < 1.0);
+
+	self = (BloomFilter *) super(Object, self, init);
+	if (self) {
+
+		const double bits = -8.0 * capacity / log(1.0 - pow(falsePositiveRate, 1.0 / 8.0));
+		const size_t blockBits = sizeof(Block) * 8;
+
+		allocBlocks(self, (size_t) ceil(bits / blockBits));
+	}
+
+	return self;
+}
+
+/**
+ * @fn BloomFilter *BloomFilter::initWithData(BloomFilter *self, const Data *data)
+ *
+ * @memberof BloomFilter
+ */
+static BloomFilter *initWithData(BloomFilter *self, const Data *data) {
+
+	assert(data);
+
+	self = (BloomFilter *) super(Object, self, init);
+	if (self) {
+
+		const uint8_t *bytes = data->bytes;
+
+		if (data->length < BLOOMFILTER_HEADER_SIZE ||
+			readLittleEndian(bytes + 0, 4) != BLOOMFILTER_MAGIC ||
+			readLittleEndian(bytes + 4, 4) != BLOOMFILTER_VERSION) {
+			release(self);
+			return NULL;
+		}
+
+		const uint64_t blockCount = readLittleEndian(bytes + 8, 8);
+		const size_t size = data->length - BLOOMFILTER_HEADER_SIZE;
+
+		if (blockCount == 0 || size % sizeof(Block) || size / sizeof(Block) != blockCount) {
+			release(self);
+			return NULL;
+		}
+
+		allocBlocks(self, blockCount);
+
+		for (size_t i = 0; i < blockCount * BLOOMFILTER_BLOCK_WORDS; i++) {
+			self->blocks[i] = readLittleEndian(bytes + BLOOMFILTER_HEADER_SIZE + i * sizeof(uint32_t), 4);
+		}
+
+		self->count = readLittleEndian(bytes + 16, 8);
+	}
+
+	return self;
+}
+
+/**
+ * @fn void BloomFilter::removeAllObjects(BloomFilter *self)
+ *
+ * @memberof BloomFilter
+ */
+static void removeAllObjects(BloomFilter *self) {
+
+	memset(self->blocks, 0, self->blockCount * sizeof(Block));
+
+	self->count = 0;
+}
+
+#pragma mark - Class lifecycle
+
+/**
+ * @see Class::initialize(Class *)
+ */
+static void initialize(Class *clazz) {
+
+	((ObjectInterface *) clazz->interface)->copy = copy;
+	((ObjectInterface *) clazz->interface)->dealloc = dealloc;
+	((ObjectInterface *) clazz->interface)->hash = hash;
+	((ObjectInterface *) clazz->interface)->isEqual = isEqual;
+	((ObjectInterface *) clazz->interface)->sizeInBytes = sizeInBytes;
+
+	BloomFilterInterface *bloomFilter = (BloomFilterInterface *) clazz->interface;
+
+	bloomFilter->addBytes = addBytes;
+	bloomFilter->addObject = addObject;
+	bloomFilter->containsBytes = containsBytes;
+	bloomFilter->containsObject = containsObject;
+	bloomFilter->data = data;
+	bloomFilter->initWithCapacity = initWithCapacity;
+	bloomFilter->initWithData = initWithData;
+	bloomFilter->removeAllObjects = removeAllObjects;
+}
+
+Class _BloomFilter = {
+	.name = "BloomFilter",
+	.superclass = &_Object,
+	.instanceSize = sizeof(BloomFilter),
+	.interfaceOffset = offsetof(BloomFilter, interface),
+	.interfaceSize = sizeof(BloomFilterInterface),
+	.initialize = initialize,
+};
+
+#undef _Class
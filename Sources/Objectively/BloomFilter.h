@@ -0,0 +1,201 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#pragma once
+
+#include <Objectively/Data.h>
+
+/**
+ * @file
+ *
+ * @brief Space-efficient, probabilistic set membership.
+ */
+
+/**
+ * @brief The count of 32 bit words in a block of a BloomFilter.
+ */
+#define BLOOMFILTER_BLOCK_WORDS 8
+
+typedef struct BloomFilter BloomFilter;
+typedef struct BloomFilterInterface BloomFilterInterface;
+
+/**
+ * @brief Space-efficient, probabilistic set membership.
+ *
+ * @details BloomFilters answer whether they might contain a member, with a tunable rate of false
+ * positives and no false negatives. Members may be Objects, by way of Object::hash, or raw bytes.
+ *
+ * The filter is split into blocks of 256 bits, aligned so that each lies within a single cache
+ * line. Each member sets one bit in each of the eight words of one block, so that adding or
+ * testing a member touches a single cache line, and operates on all words of the block at once.
+ *
+ * @remarks To ship a filter of Objects between processes, the hashes of those Objects must be
+ * stable across processes, as they are for String, Number and Data.
+ *
+ * @extends Object
+ *
+ * @ingroup Collections
+ */
+struct BloomFilter {
+
+	/**
+	 * @brief The parent.
+	 *
+	 * @private
+	 */
+	Object object;
+
+	/**
+	 * @brief The typed interface.
+	 *
+	 * @private
+	 */
+	BloomFilterInterface *interface;
+
+	/**
+	 * @brief The blocks.
+	 *
+	 * @private
+	 */
+	uint32_t *blocks;
+
+	/**
+	 * @brief The count of blocks.
+	 */
+	size_t blockCount;
+
+	/**
+	 * @brief The count of members added.
+	 */
+	size_t count;
+};
+
+/**
+ * @brief The BloomFilter interface.
+ */
+struct BloomFilterInterface {
+
+	/**
+	 * @brief The parent interface.
+	 */
+	ObjectInterface objectInterface;
+
+	/**
+	 * @fn void BloomFilter::addBytes(BloomFilter *self, const uint8_t *bytes, size_t length)
+	 *
+	 * @brief Adds the specified bytes to this BloomFilter.
+	 *
+	 * @param bytes The bytes.
+	 * @param length The count of `bytes`.
+	 *
+	 * @memberof BloomFilter
+	 */
+	void (*addBytes)(BloomFilter *self, const uint8_t *bytes, size_t length);
+
+	/**
+	 * @fn void BloomFilter::addObject(BloomFilter *self, const ident obj)
+	 *
+	 * @brief Adds the specified Object to this BloomFilter.
+	 *
+	 * @param obj The Object.
+	 *
+	 * @memberof BloomFilter
+	 */
+	void (*addObject)(BloomFilter *self, const ident obj);
+
+	/**
+	 * @fn _Bool BloomFilter::containsBytes(const BloomFilter *self, const uint8_t *bytes, size_t length)
+	 *
+	 * @param bytes The bytes.
+	 * @param length The count of `bytes`.
+	 *
+	 * @return False if this BloomFilter definitely does not contain `bytes`, true if it might.
+	 *
+	 * @memberof BloomFilter
+	 */
+	_Bool (*containsBytes)(const BloomFilter *self, const uint8_t *bytes, size_t length);
+
+	/**
+	 * @fn _Bool BloomFilter::containsObject(const BloomFilter *self, const ident obj)
+	 *
+	 * @param obj The Object.
+	 *
+	 * @return False if this BloomFilter definitely does not contain `obj`, true if it might.
+	 *
+	 * @memberof BloomFilter
+	 */
+	_Bool (*containsObject)(const BloomFilter *self, const ident obj);
+
+	/**
+	 * @fn Data *BloomFilter::data(const BloomFilter *self)
+	 *
+	 * @return A new Data containing the serialized representation of this BloomFilter.
+	 *
+	 * @see BloomFilter::initWithData(BloomFilter *, const Data *)
+	 *
+	 * @memberof BloomFilter
+	 */
+	Data *(*data)(const BloomFilter *self);
+
+	/**
+	 * @fn BloomFilter *BloomFilter::initWithCapacity(BloomFilter *self, size_t capacity, double falsePositiveRate)
+	 *
+	 * @brief Initializes this BloomFilter to hold `capacity` members at the specified rate of false
+	 * positives.
+	 *
+	 * @param capacity The expected count of members.
+	 * @param falsePositiveRate The desired rate of false positives, between `0.0` and `1.0`.
+	 *
+	 * @return The initialized BloomFilter, or `NULL` on error.
+	 *
+	 * @memberof BloomFilter
+	 */
+	BloomFilter *(*initWithCapacity)(BloomFilter *self, size_t capacity, double falsePositiveRate);
+
+	/**
+	 * @fn BloomFilter *BloomFilter::initWithData(BloomFilter *self, const Data *data)
+	 *
+	 * @brief Initializes this BloomFilter from its serialized representation.
+	 *
+	 * @param data The Data, as returned by BloomFilter::data.
+	 *
+	 * @return The initialized BloomFilter, or `NULL` if `data` is not a valid BloomFilter.
+	 *
+	 * @memberof BloomFilter
+	 */
+	BloomFilter *(*initWithData)(BloomFilter *self, const Data *data);
+
+	/**
+	 * @fn void BloomFilter::removeAllObjects(BloomFilter *self)
+	 *
+	 * @brief Removes all members from this BloomFilter.
+	 *
+	 * @memberof BloomFilter
+	 */
+	void (*removeAllObjects)(BloomFilter *self);
+};
+
+/**
+ * @brief The BloomFilter Class.
+ */
+extern Class _BloomFilter;
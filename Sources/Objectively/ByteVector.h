@@ -0,0 +1,68 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+/**
+ * @file
+ *
+ * @brief The byte vectors shared by the scanning loops of String and StringTokenizer.
+ *
+ * @remarks This header is private to the library and is not installed.
+ */
+
+/**
+ * @brief The count of bytes in a ByteVector.
+ *
+ * @remarks Vectors are sized to the 32 byte registers of AVX2 when the compiler targets it, and
+ * to the 16 byte registers available on every target otherwise.
+ */
+#if defined(__AVX2__)
+ #define BYTE_VECTOR_LANES 32
+#else
+ #define BYTE_VECTOR_LANES 16
+#endif
+
+/**
+ * @brief A vector of bytes.
+ */
+typedef uint8_t ByteVector __attribute__((vector_size(BYTE_VECTOR_LANES)));
+
+/**
+ * @brief The comparison mask of a ByteVector, viewed as words.
+ */
+typedef uint64_t ByteVectorMask __attribute__((vector_size(BYTE_VECTOR_LANES)));
+
+/**
+ * @return The vector of bytes at `bytes`, which need not be aligned.
+ */
+static inline ByteVector loadByteVector(const uint8_t *bytes) {
+
+	ByteVector vector;
+	memcpy(&vector, bytes, sizeof(vector));
+
+	return vector;
+}
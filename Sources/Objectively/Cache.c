@@ -0,0 +1,856 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <assert.h>
+#include <stdlib.h>
+
+#include <Objectively/Cache.h>
+#include <Objectively/Hash.h>
+
+#define _Class _Cache
+
+#define CACHE_DEFAULT_CAPACITY 16
+#define CACHE_GROW_FACTOR 2
+#define CACHE_MAX_LOAD 0.75
+
+#define CACHE_SKETCH_DEPTH 4
+#define CACHE_SKETCH_WIDTH 1024
+#define CACHE_SKETCH_MAX 15
+#define CACHE_SKETCH_SAMPLES (CACHE_SKETCH_WIDTH * 10)
+
+/**
+ * @brief The segments of a shard. LRU and CLOCK use only the window.
+ */
+typedef enum {
+	SegmentWindow,
+	SegmentProbation,
+	SegmentProtected,
+	SegmentCount
+} Segment;
+
+/**
+ * @brief A link in a circular, doubly linked List.
+ */
+typedef struct Link {
+	struct Link *prev;
+	struct Link *next;
+} Link;
+
+/**
+ * @brief An entry, linked within its segment and chained within its bin.
+ */
+typedef struct Entry {
+	Link link;
+	struct Entry *chain;
+	uint32_t hash;
+	ident key;
+	ident obj;
+	size_t cost;
+	Time expiration;
+	_Bool expires;
+	_Bool referenced;
+	Segment segment;
+} Entry;
+
+/**
+ * @brief A List of Entries, from most to least recently used.
+ */
+typedef struct {
+	Link head;
+	size_t cost;
+} List;
+
+/**
+ * @brief An independently locked partition of a Cache.
+ */
+typedef struct {
+	Lock *lock;
+	Entry **bins;
+	size_t capacity;
+	size_t count;
+	size_t cost;
+	size_t costLimit;
+	size_t windowLimit;
+	size_t protectedLimit;
+	List lists[SegmentCount];
+	uint8_t *sketch;
+	size_t samples;
+	size_t hits;
+	size_t misses;
+	size_t evictions;
+	size_t expirations;
+} Shard;
+
+/**
+ * @return The well-mixed hash of `key`.
+ */
+static uint32_t hashForKey(const ident key) {
+	return HashMix32((uint32_t) $((Object *) key, hash));
+}
+
+/**
+ * @return The Shard of `self` for `hash`.
+ */
+static Shard *shardForHash(const Cache *self, uint32_t hash) {
+	return (Shard *) self->locals.shards + (hash & (self->locals.shardCount - 1));
+}
+
+/**
+ * @return The bin of `shard` for `hash`.
+ */
+static Entry **binForHash(const Shard *shard, uint32_t hash) {
+	return &shard->bins[(hash >> 4) & (shard->capacity - 1)];
+}
+
+/**
+ * @brief Inserts `entry` at the head of `list`.
+ */
+static void listPush(List *list, Entry *entry) {
+
+	entry->link.prev = &list->head;
+	entry->link.next = list->head.next;
+
+	list->head.next->prev = &entry->link;
+	list->head.next = &entry->link;
+
+	list->cost += entry->cost;
+}
+
+/**
+ * @brief Removes `entry` from `list`.
+ */
+static void listRemove(List *list, Entry *entry) {
+
+	entry->link.prev->next = entry->link.next;
+	entry->link.next->prev = entry->link.prev;
+
+	list->cost -= entry->cost;
+}
+
+/**
+ * @return The least recently used Entry of `list`, or `NULL`.
+ */
+static Entry *listTail(const List *list) {
+	return list->head.prev == &list->head ? NULL : (Entry *) list->head.prev;
+}
+
+/**
+ * @brief Moves `entry` to the head of `segment`.
+ */
+static void moveEntry(Shard *shard, Entry *entry, Segment segment) {
+
+	listRemove(&shard->lists[entry->segment], entry);
+
+	entry->segment = segment;
+
+	listPush(&shard->lists[entry->segment], entry);
+}
+
+/**
+ * @return The counter of row `row` of the frequency sketch of `shard` for `hash`.
+ */
+static uint8_t *sketchCounter(const Shard *shard, uint32_t hash, int row) {
+
+	static const uint32_t seeds[CACHE_SKETCH_DEPTH] = {
+		0x97cb3127, 0xb8a38f11, 0x5c4fb2a5, 0xe0bde7d9
+	};
+
+	const uint32_t index = ((hash ^ (hash >> 17)) * seeds[row]) >> 22;
+
+	return &shard->sketch[row * CACHE_SKETCH_WIDTH + index];
+}
+
+/**
+ * @brief Records an access of `hash` in the frequency sketch of `shard`, aging the sketch
+ * periodically so that it forgets stale popularity.
+ */
+static void sketchIncrement(Shard *shard, uint32_t hash) {
+
+	for (int i = 0; i < CACHE_SKETCH_DEPTH; i++) {
+		uint8_t *counter = sketchCounter(shard, hash, i);
+		if (*counter < CACHE_SKETCH_MAX) {
+			(*counter)++;
+		}
+	}
+
+	if (++shard->samples == CACHE_SKETCH_SAMPLES) {
+		for (size_t i = 0; i < CACHE_SKETCH_DEPTH * CACHE_SKETCH_WIDTH; i++) {
+			shard->sketch[i] >>= 1;
+		}
+		shard->samples >>= 1;
+	}
+}
+
+/**
+ * @return The estimated access frequency of `hash` in `shard`.
+ */
+static uint8_t sketchFrequency(const Shard *shard, uint32_t hash) {
+
+	uint8_t frequency = CACHE_SKETCH_MAX;
+
+	for (int i = 0; i < CACHE_SKETCH_DEPTH; i++) {
+		frequency = min(frequency, *sketchCounter(shard, hash, i));
+	}
+
+	return frequency;
+}
+
+/**
+ * @return The address of the Entry for `key` in `shard`, or of the `NULL` at the end of its chain.
+ */
+static Entry **findEntry(const Shard *shard, const ident key, uint32_t hash) {
+
+	Entry **entry = binForHash(shard, hash);
+
+	while (*entry) {
+		if ((*entry)->hash == hash && $((Object *) (*entry)->key, isEqual, key)) {
+			break;
+		}
+		entry = &(*entry)->chain;
+	}
+
+	return entry;
+}
+
+/**
+ * @brief Unlinks `entry` from `shard`, and chains it to `garbage` for release once the Lock of
+ * `shard` has been unlocked.
+ */
+static void removeEntry(Shard *shard, Entry *entry, Entry **garbage) {
+
+	Entry **bin = findEntry(shard, entry->key, entry->hash);
+	assert(*bin == entry);
+
+	*bin = entry->chain;
+
+	listRemove(&shard->lists[entry->segment], entry);
+
+	shard->count--;
+	shard->cost -= entry->cost;
+
+	entry->chain = *garbage;
+	*garbage = entry;
+}
+
+/**
+ * @brief Releases the chained Entries of `garbage`.
+ */
+static void releaseEntries(Entry *garbage) {
+
+	while (garbage) {
+		Entry *next = garbage->chain;
+
+		release(garbage->key);
+		release(garbage->obj);
+		free(garbage);
+
+		garbage = next;
+	}
+}
+
+/**
+ * @return True if `entry` has expired.
+ */
+static _Bool isExpired(const Entry *entry) {
+
+	if (entry->expires) {
+
+		Time now;
+		gettimeofday(&now, NULL);
+
+		if (now.tv_sec != entry->expiration.tv_sec) {
+			return now.tv_sec > entry->expiration.tv_sec;
+		}
+
+		return now.tv_usec >= entry->expiration.tv_usec;
+	}
+
+	return false;
+}
+
+/**
+ * @brief Doubles the capacity of the bins of `shard`.
+ */
+static void resizeShard(Shard *shard) {
+
+	const size_t capacity = shard->capacity * CACHE_GROW_FACTOR;
+
+	Entry **bins = calloc(capacity, sizeof(Entry *));
+	assert(bins);
+
+	for (size_t i = 0; i < shard->capacity; i++) {
+		Entry *entry = shard->bins[i];
+		while (entry) {
+			Entry *next = entry->chain;
+
+			Entry **bin = &bins[(entry->hash >> 4) & (capacity - 1)];
+			entry->chain = *bin;
+			*bin = entry;
+
+			entry = next;
+		}
+	}
+
+	free(shard->bins);
+
+	shard->bins = bins;
+	shard->capacity = capacity;
+}
+
+/**
+ * @brief Updates the recency or frequency of `entry`, which was just used.
+ */
+static void touchEntry(const Cache *self, Shard *shard, Entry *entry) {
+
+	switch (self->policy) {
+		case CacheEvictionPolicyLRU:
+			moveEntry(shard, entry, SegmentWindow);
+			break;
+
+		case CacheEvictionPolicyCLOCK:
+			entry->referenced = true;
+			break;
+
+		case CacheEvictionPolicyTinyLFU:
+			if (entry->segment == SegmentWindow) {
+				moveEntry(shard, entry, SegmentWindow);
+			} else {
+				moveEntry(shard, entry, SegmentProtected);
+
+				List *protected = &shard->lists[SegmentProtected];
+				while (protected->cost > shard->protectedLimit) {
+
+					Entry *demoted = listTail(protected);
+					if (demoted == entry) {
+						break;
+					}
+
+					moveEntry(shard, demoted, SegmentProbation);
+				}
+			}
+			break;
+	}
+}
+
+/**
+ * @return The Entry of `shard` to evict next, according to the policy of `self`.
+ */
+static Entry *victim(const Cache *self, Shard *shard) {
+
+	List *window = &shard->lists[SegmentWindow];
+
+	switch (self->policy) {
+		case CacheEvictionPolicyLRU:
+			return listTail(window);
+
+		case CacheEvictionPolicyCLOCK:
+			while (true) {
+				Entry *entry = listTail(window);
+				if (entry && entry->referenced && isExpired(entry) == false) {
+					entry->referenced = false;
+					moveEntry(shard, entry, SegmentWindow);
+				} else {
+					return entry;
+				}
+			}
+
+		case CacheEvictionPolicyTinyLFU:
+			for (Segment segment = SegmentProbation; segment < SegmentCount; segment++) {
+				Entry *entry = listTail(&shard->lists[segment]);
+				if (entry) {
+					return entry;
+				}
+			}
+			return listTail(window);
+	}
+
+	return NULL;
+}
+
+/**
+ * @brief Evicts Entries from `shard` until its cost is within its limit.
+ */
+static void evictEntries(const Cache *self, Shard *shard, Entry **garbage) {
+
+	if (self->policy == CacheEvictionPolicyTinyLFU) {
+
+		List *window = &shard->lists[SegmentWindow];
+		List *probation = &shard->lists[SegmentProbation];
+
+		while (window->cost > shard->windowLimit) {
+
+			Entry *candidate = listTail(window);
+			moveEntry(shard, candidate, SegmentProbation);
+
+			if (shard->costLimit && shard->cost > shard->costLimit) {
+
+				Entry *entry = listTail(probation);
+				if (entry == candidate) {
+					entry = listTail(&shard->lists[SegmentProtected]);
+				}
+
+				if (entry) {
+					if (sketchFrequency(shard, candidate->hash) > sketchFrequency(shard, entry->hash)) {
+						removeEntry(shard, entry, garbage);
+					} else {
+						removeEntry(shard, candidate, garbage);
+					}
+					shard->evictions++;
+				}
+			}
+		}
+	}
+
+	while (shard->costLimit && shard->cost > shard->costLimit) {
+
+		Entry *entry = victim(self, shard);
+		assert(entry);
+
+		if (isExpired(entry)) {
+			shard->expirations++;
+		} else {
+			shard->evictions++;
+		}
+
+		removeEntry(shard, entry, garbage);
+	}
+}
+
+/**
+ * @brief Looks up the Object for `key` while the Lock of `shard` is held.
+ */
+static ident objectForKey_locked(Cache *self, Shard *shard, const ident key, uint32_t hash, Entry **garbage) {
+
+	if (self->policy == CacheEvictionPolicyTinyLFU) {
+		sketchIncrement(shard, hash);
+	}
+
+	Entry *entry = *findEntry(shard, key, hash);
+	if (entry && isExpired(entry)) {
+		removeEntry(shard, entry, garbage);
+		shard->expirations++;
+		entry = NULL;
+	}
+
+	if (entry == NULL) {
+		shard->misses++;
+		return NULL;
+	}
+
+	shard->hits++;
+
+	touchEntry(self, shard, entry);
+
+	return retain(entry->obj);
+}
+
+/**
+ * @brief Sets the Object for `key` while the Lock of `shard` is held.
+ */
+static void setObjectForKey_locked(Cache *self, Shard *shard, const ident obj, const ident key,
+		uint32_t hash, size_t cost, const Date *expiration, Entry **garbage) {
+
+	if (self->policy == CacheEvictionPolicyTinyLFU) {
+		sketchIncrement(shard, hash);
+	}
+
+	Entry *entry = *findEntry(shard, key, hash);
+	if (entry) {
+
+		Entry *replaced = calloc(1, sizeof(Entry));
+		assert(replaced);
+
+		replaced->obj = entry->obj;
+		replaced->chain = *garbage;
+		*garbage = replaced;
+
+		entry->obj = retain(obj);
+
+		listRemove(&shard->lists[entry->segment], entry);
+
+		shard->cost -= entry->cost;
+		shard->cost += cost;
+
+		entry->cost = cost;
+
+		listPush(&shard->lists[entry->segment], entry);
+
+		touchEntry(self, shard, entry);
+
+	} else {
+
+		if (shard->count + 1 > shard->capacity * CACHE_MAX_LOAD) {
+			resizeShard(shard);
+		}
+
+		entry = calloc(1, sizeof(Entry));
+		assert(entry);
+
+		entry->hash = hash;
+		entry->key = retain(key);
+		entry->obj = retain(obj);
+		entry->cost = cost;
+		entry->segment = SegmentWindow;
+
+		Entry **bin = binForHash(shard, hash);
+		entry->chain = *bin;
+		*bin = entry;
+
+		listPush(&shard->lists[SegmentWindow], entry);
+
+		shard->count++;
+		shard->cost += cost;
+	}
+
+	entry->expires = expiration != NULL;
+	if (expiration) {
+		entry->expiration = expiration->time;
+	}
+
+	evictEntries(self, shard, garbage);
+}
+
+/**
+ * @brief Removes all Entries from `shard`.
+ */
+static void removeAllObjects_locked(Shard *shard, Entry **garbage) {
+
+	for (size_t i = 0; i < shard->capacity; i++) {
+		while (shard->bins[i]) {
+			removeEntry(shard, shard->bins[i], garbage);
+		}
+	}
+}
+
+#pragma mark - Object
+
+/**
+ * @see Object::copy(const Object *)
+ */
+static Object *copy(const Object *self) {
+	return NULL;
+}
+
+/**
+ * @see Object::dealloc(Object *)
+ */
+static void dealloc(Object *self) {
+
+	Cache *this = (Cache *) self;
+
+	for (size_t i = 0; i < this->locals.shardCount; i++) {
+		Shard *shard = (Shard *) this->locals.shards + i;
+
+		Entry *garbage = NULL;
+		removeAllObjects_locked(shard, &garbage);
+		releaseEntries(garbage);
+
+		release(shard->lock);
+
+		free(shard->bins);
+		free(shard->sketch);
+	}
+
+	free(this->locals.shards);
+
+	super(Object, self, dealloc);
+}
+
+/**
+ * @see Object::deepSizeInBytes(const Object *)
+ */
+static size_t deepSizeInBytes(const Object *self) {
+
+	const Cache *this = (Cache *) self;
+
+	size_t size = $(self, sizeInBytes);
+
+	for (size_t i = 0; i < this->locals.shardCount; i++) {
+		const Shard *shard = (Shard *) this->locals.shards + i;
+
+		WithLock(shard->lock, {
+			for (size_t j = 0; j < shard->capacity; j++) {
+				for (const Entry *entry = shard->bins[j]; entry; entry = entry->chain) {
+					size += $((Object *) entry->key, deepSizeInBytes) + $((Object *) entry->obj, deepSizeInBytes);
+				}
+			}
+		});
+	}
+
+	return size;
+}
+
+/**
+ * @see Object::sizeInBytes(const Object *)
+ */
+static size_t sizeInBytes(const Object *self) {
+
+	const Cache *this = (Cache *) self;
+
+	size_t size = super(Object, self, sizeInBytes) + this->locals.shardCount * sizeof(Shard);
+
+	for (size_t i = 0; i < this->locals.shardCount; i++) {
+		const Shard *shard = (Shard *) this->locals.shards + i;
+
+		size += $((Object *) shard->lock, sizeInBytes);
+
+		WithLock(shard->lock, {
+			size += shard->capacity * sizeof(Entry *) + shard->count * sizeof(Entry);
+			if (shard->sketch) {
+				size += CACHE_SKETCH_DEPTH * CACHE_SKETCH_WIDTH * sizeof(uint8_t);
+			}
+		});
+	}
+
+	return size;
+}
+
+#pragma mark - Cache
+
+/**
+ * @fn Cache *Cache::init(Cache *self)
+ *
+ * @memberof Cache
+ */
+static Cache *init(Cache *self) {
+	return $(self, initWithCostLimit, 0, CacheEvictionPolicyLRU);
+}
+
+/**
+ * @fn Cache *Cache::initWithCostLimit(Cache *self, size_t costLimit, CacheEvictionPolicy policy)
+ *
+ * @memberof Cache
+ */
+static Cache *initWithCostLimit(Cache *self, size_t costLimit, CacheEvictionPolicy policy) {
+
+	self = (Cache *) super(Object, self, init);
+	if (self) {
+
+		self->costLimit = costLimit;
+		self->policy = policy;
+
+		self->locals.shardCount = CACHE_SHARDS;
+		if (self->costLimit) {
+			while (self->locals.shardCount > 1 && costLimit / self->locals.shardCount < CACHE_SHARD_MIN_COST) {
+				self->locals.shardCount >>= 1;
+			}
+		}
+
+		self->locals.shards = calloc(self->locals.shardCount, sizeof(Shard));
+		assert(self->locals.shards);
+
+		for (size_t i = 0; i < self->locals.shardCount; i++) {
+			Shard *shard = (Shard *) self->locals.shards + i;
+
+			shard->lock = alloc(Lock, init);
+			assert(shard->lock);
+
+			shard->capacity = CACHE_DEFAULT_CAPACITY;
+			shard->bins = calloc(shard->capacity, sizeof(Entry *));
+			assert(shard->bins);
+
+			for (Segment segment = SegmentWindow; segment < SegmentCount; segment++) {
+				shard->lists[segment].head.prev = shard->lists[segment].head.next = &shard->lists[segment].head;
+			}
+
+			shard->costLimit = costLimit / self->locals.shardCount;
+			if (i < costLimit % self->locals.shardCount) {
+				shard->costLimit++;
+			}
+
+			if (self->policy == CacheEvictionPolicyTinyLFU) {
+
+				shard->sketch = calloc(CACHE_SKETCH_DEPTH * CACHE_SKETCH_WIDTH, sizeof(uint8_t));
+				assert(shard->sketch);
+
+				if (shard->costLimit) {
+					shard->windowLimit = max(shard->costLimit / 100, (size_t) 1);
+					shard->protectedLimit = (shard->costLimit - shard->windowLimit) * 8 / 10;
+				} else {
+					shard->windowLimit = shard->protectedLimit = SIZE_MAX;
+				}
+			}
+		}
+	}
+
+	return self;
+}
+
+/**
+ * @fn ident Cache::objectForKey(Cache *self, const ident key)
+ *
+ * @memberof Cache
+ */
+static ident objectForKey(Cache *self, const ident key) {
+
+	assert(key);
+
+	const uint32_t hash = hashForKey(key);
+	Shard *shard = shardForHash(self, hash);
+
+	Entry *garbage = NULL;
+	ident obj;
+
+	WithLock(shard->lock, {
+		obj = objectForKey_locked(self, shard, key, hash, &garbage);
+	});
+
+	releaseEntries(garbage);
+
+	return obj;
+}
+
+/**
+ * @fn void Cache::removeAllObjects(Cache *self)
+ *
+ * @memberof Cache
+ */
+static void removeAllObjects(Cache *self) {
+
+	for (size_t i = 0; i < self->locals.shardCount; i++) {
+		Shard *shard = (Shard *) self->locals.shards + i;
+
+		Entry *garbage = NULL;
+
+		WithLock(shard->lock, {
+			removeAllObjects_locked(shard, &garbage);
+		});
+
+		releaseEntries(garbage);
+	}
+}
+
+/**
+ * @fn void Cache::removeObjectForKey(Cache *self, const ident key)
+ *
+ * @memberof Cache
+ */
+static void removeObjectForKey(Cache *self, const ident key) {
+
+	assert(key);
+
+	const uint32_t hash = hashForKey(key);
+	Shard *shard = shardForHash(self, hash);
+
+	Entry *garbage = NULL;
+
+	WithLock(shard->lock, {
+		Entry *entry = *findEntry(shard, key, hash);
+		if (entry) {
+			removeEntry(shard, entry, &garbage);
+		}
+	});
+
+	releaseEntries(garbage);
+}
+
+/**
+ * @fn void Cache::setObjectForKey(Cache *self, const ident obj, const ident key)
+ *
+ * @memberof Cache
+ */
+static void setObjectForKey(Cache *self, const ident obj, const ident key) {
+	$(self, setObjectForKeyWithCost, obj, key, 1, NULL);
+}
+
+/**
+ * @fn void Cache::setObjectForKeyWithCost(Cache *self, const ident obj, const ident key, size_t cost, const Date *expiration)
+ *
+ * @memberof Cache
+ */
+static void setObjectForKeyWithCost(Cache *self, const ident obj, const ident key, size_t cost, const Date *expiration) {
+
+	assert(obj);
+	assert(key);
+
+	const uint32_t hash = hashForKey(key);
+	Shard *shard = shardForHash(self, hash);
+
+	Entry *garbage = NULL;
+
+	WithLock(shard->lock, {
+		setObjectForKey_locked(self, shard, obj, key, hash, cost, expiration, &garbage);
+	});
+
+	releaseEntries(garbage);
+}
+
+/**
+ * @fn CacheStatistics Cache::statistics(const Cache *self)
+ *
+ * @memberof Cache
+ */
+static CacheStatistics statistics(const Cache *self) {
+
+	CacheStatistics statistics = { 0 };
+
+	for (size_t i = 0; i < self->locals.shardCount; i++) {
+		const Shard *shard = (Shard *) self->locals.shards + i;
+
+		WithLock(shard->lock, {
+			statistics.count += shard->count;
+			statistics.cost += shard->cost;
+			statistics.hits += shard->hits;
+			statistics.misses += shard->misses;
+			statistics.evictions += shard->evictions;
+			statistics.expirations += shard->expirations;
+		});
+	}
+
+	return statistics;
+}
+
+#pragma mark - Class lifecycle
+
+/**
+ * @see Class::initialize(Class *)
+ */
+static void initialize(Class *clazz) {
+
+	((ObjectInterface *) clazz->interface)->copy = copy;
+	((ObjectInterface *) clazz->interface)->dealloc = dealloc;
+	((ObjectInterface *) clazz->interface)->deepSizeInBytes = deepSizeInBytes;
+	((ObjectInterface *) clazz->interface)->sizeInBytes = sizeInBytes;
+
+	CacheInterface *cache = (CacheInterface *) clazz->interface;
+
+	cache->init = init;
+	cache->initWithCostLimit = initWithCostLimit;
+	cache->objectForKey = objectForKey;
+	cache->removeAllObjects = removeAllObjects;
+	cache->removeObjectForKey = removeObjectForKey;
+	cache->setObjectForKey = setObjectForKey;
+	cache->setObjectForKeyWithCost = setObjectForKeyWithCost;
+	cache->statistics = statistics;
+}
+
+Class _Cache = {
+	.name = "Cache",
+	.superclass = &_Object,
+	.instanceSize = sizeof(Cache),
+	.interfaceOffset = offsetof(Cache, interface),
+	.interfaceSize = sizeof(CacheInterface),
+	.initialize = initialize,
+};
+
+#undef _Class
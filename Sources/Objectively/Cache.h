@@ -0,0 +1,279 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#pragma once
+
+#include <Objectively/Date.h>
+#include <Objectively/Lock.h>
+
+/**
+ * @file
+ *
+ * @brief Thread-safe, size-bounded caches.
+ */
+
+/**
+ * @brief The maximum count of independently locked shards of a Cache.
+ */
+#define CACHE_SHARDS 16
+
+/**
+ * @brief The minimum cost limit of a shard of a Cache.
+ */
+#define CACHE_SHARD_MIN_COST 64
+
+typedef struct Cache Cache;
+typedef struct CacheInterface CacheInterface;
+
+/**
+ * @brief The eviction policies of a Cache.
+ */
+typedef enum {
+
+	/**
+	 * @brief Evict the least recently used entry.
+	 */
+	CacheEvictionPolicyLRU,
+
+	/**
+	 * @brief Evict the first entry not used since the clock hand last passed it. Hits only set
+	 * a reference bit, so they are cheaper than with LRU.
+	 */
+	CacheEvictionPolicyCLOCK,
+
+	/**
+	 * @brief Admit new entries through a small LRU window, and retain them only if they are used
+	 * more frequently than the entry they would displace (W-TinyLFU). This resists scans, and
+	 * favors frequently used entries over merely recent ones.
+	 */
+	CacheEvictionPolicyTinyLFU,
+} CacheEvictionPolicy;
+
+/**
+ * @brief The statistics of a Cache.
+ */
+typedef struct {
+
+	/**
+	 * @brief The count of entries.
+	 */
+	size_t count;
+
+	/**
+	 * @brief The total cost of all entries.
+	 */
+	size_t cost;
+
+	/**
+	 * @brief The count of lookups that found an entry.
+	 */
+	size_t hits;
+
+	/**
+	 * @brief The count of lookups that did not find an entry.
+	 */
+	size_t misses;
+
+	/**
+	 * @brief The count of entries evicted to honor the cost limit.
+	 */
+	size_t evictions;
+
+	/**
+	 * @brief The count of entries removed because they expired.
+	 */
+	size_t expirations;
+} CacheStatistics;
+
+/**
+ * @brief Thread-safe, size-bounded caches.
+ *
+ * @details Caches map keys to Objects, like MutableDictionary, but evict entries once their
+ * total cost exceeds the cost limit. Lookups, insertions and evictions are O(1).
+ *
+ * Keys are partitioned by hash into up to `CACHE_SHARDS` shards, each with its own Lock and its
+ * own share of the cost limit, so that threads using different keys rarely contend. Because
+ * other threads may evict an entry at any time, the Objects returned by a Cache are retained on
+ * behalf of the caller.
+ *
+ * Entries may also expire at a given Date. Expired entries are removed lazily, when they are
+ * next looked up or chosen for eviction.
+ *
+ * @extends Object
+ *
+ * @ingroup Concurrency
+ */
+struct Cache {
+
+	/**
+	 * @brief The parent.
+	 *
+	 * @private
+	 */
+	Object object;
+
+	/**
+	 * @brief The typed interface.
+	 *
+	 * @private
+	 */
+	CacheInterface *interface;
+
+	/**
+	 * @private
+	 */
+	struct {
+
+		/**
+		 * @brief The shards.
+		 */
+		ident shards;
+
+		/**
+		 * @brief The count of shards, a power of two.
+		 */
+		size_t shardCount;
+
+	} locals;
+
+	/**
+	 * @brief The total cost limit, or `0` for no limit.
+	 */
+	size_t costLimit;
+
+	/**
+	 * @brief The eviction policy.
+	 */
+	CacheEvictionPolicy policy;
+};
+
+/**
+ * @brief The Cache interface.
+ */
+struct CacheInterface {
+
+	/**
+	 * @brief The parent interface.
+	 */
+	ObjectInterface objectInterface;
+
+	/**
+	 * @fn Cache *Cache::init(Cache *self)
+	 *
+	 * @brief Initializes this Cache with no cost limit.
+	 *
+	 * @return The initialized Cache, or `NULL` on error.
+	 *
+	 * @memberof Cache
+	 */
+	Cache *(*init)(Cache *self);
+
+	/**
+	 * @fn Cache *Cache::initWithCostLimit(Cache *self, size_t costLimit, CacheEvictionPolicy policy)
+	 *
+	 * @brief Initializes this Cache with the specified cost limit and eviction policy.
+	 *
+	 * @param costLimit The total cost limit, or `0` for no limit.
+	 * @param policy The CacheEvictionPolicy.
+	 *
+	 * @return The initialized Cache, or `NULL` on error.
+	 *
+	 * @memberof Cache
+	 */
+	Cache *(*initWithCostLimit)(Cache *self, size_t costLimit, CacheEvictionPolicy policy);
+
+	/**
+	 * @fn ident Cache::objectForKey(Cache *self, const ident key)
+	 *
+	 * @param key The key.
+	 *
+	 * @return The Object for `key`, retained on behalf of the caller, or `NULL`.
+	 *
+	 * @remarks The caller must release the returned Object.
+	 *
+	 * @memberof Cache
+	 */
+	ident (*objectForKey)(Cache *self, const ident key);
+
+	/**
+	 * @fn void Cache::removeAllObjects(Cache *self)
+	 *
+	 * @brief Removes all entries from this Cache.
+	 *
+	 * @memberof Cache
+	 */
+	void (*removeAllObjects)(Cache *self);
+
+	/**
+	 * @fn void Cache::removeObjectForKey(Cache *self, const ident key)
+	 *
+	 * @brief Removes the entry for `key` from this Cache.
+	 *
+	 * @param key The key.
+	 *
+	 * @memberof Cache
+	 */
+	void (*removeObjectForKey)(Cache *self, const ident key);
+
+	/**
+	 * @fn void Cache::setObjectForKey(Cache *self, const ident obj, const ident key)
+	 *
+	 * @brief Sets the Object for `key`, with a cost of `1` and no expiration.
+	 *
+	 * @param obj The Object.
+	 * @param key The key.
+	 *
+	 * @memberof Cache
+	 */
+	void (*setObjectForKey)(Cache *self, const ident obj, const ident key);
+
+	/**
+	 * @fn void Cache::setObjectForKeyWithCost(Cache *self, const ident obj, const ident key, size_t cost, const Date *expiration)
+	 *
+	 * @brief Sets the Object for `key`, with the specified cost and expiration.
+	 *
+	 * @param obj The Object.
+	 * @param key The key.
+	 * @param cost The cost of the entry, e.g. the length of a Data.
+	 * @param expiration The Date at which the entry expires, or `NULL`.
+	 *
+	 * @remarks An entry whose cost exceeds the cost limit of its shard is evicted immediately.
+	 *
+	 * @memberof Cache
+	 */
+	void (*setObjectForKeyWithCost)(Cache *self, const ident obj, const ident key, size_t cost, const Date *expiration);
+
+	/**
+	 * @fn CacheStatistics Cache::statistics(const Cache *self)
+	 *
+	 * @return The CacheStatistics of this Cache.
+	 *
+	 * @memberof Cache
+	 */
+	CacheStatistics (*statistics)(const Cache *self);
+};
+
+/**
+ * @brief The Cache Class.
+ */
+extern Class _Cache;
@@ -0,0 +1,725 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <assert.h>
+#include <sched.h>
+#include <stdlib.h>
+
+#include <Objectively/ConcurrentDictionary.h>
+#include <Objectively/Hash.h>
+#include <Objectively/MutableDictionary.h>
+
+#define _Class _ConcurrentDictionary
+
+#define CONCURRENTDICTIONARY_DEFAULT_CAPACITY 64
+#define CONCURRENTDICTIONARY_GROW_FACTOR 2
+#define CONCURRENTDICTIONARY_MAX_LOAD 0.75
+#define CONCURRENTDICTIONARY_RECLAIM_THRESHOLD 64
+
+/**
+ * @brief A pair, chained within a bucket of the table.
+ *
+ * @remarks The key and hash of an Entry never change. Its Object and successor are published
+ * with release semantics, and read with acquire semantics, so that readers always observe a
+ * consistent chain.
+ */
+typedef struct Entry {
+	uint32_t hash;
+	ident key;
+	ident volatile obj;
+	struct Entry *volatile next;
+} Entry;
+
+/**
+ * @brief A table of buckets, whose capacity is a power of two.
+ */
+typedef struct {
+	size_t capacity;
+	Entry *volatile buckets[];
+} Table;
+
+/**
+ * @brief An item retired by a writer, awaiting reclamation.
+ */
+typedef struct Garbage {
+	struct Garbage *next;
+	void (*destroy)(ident ptr);
+	ident ptr;
+} Garbage;
+
+/**
+ * @return The well-mixed hash of `key`.
+ */
+static uint32_t hashForKey(const ident key) {
+	return HashMix32((uint32_t) $((Object *) key, hash));
+}
+
+/**
+ * @return A new, empty Table with the specified capacity.
+ */
+static Table *allocTable(size_t capacity) {
+
+	Table *table = calloc(1, sizeof(Table) + capacity * sizeof(Entry *));
+	assert(table);
+
+	table->capacity = capacity;
+
+	return table;
+}
+
+/**
+ * @brief Prepends a new Entry for the given pair to its bucket of `table`, retaining the pair.
+ *
+ * @remarks The stripe of the bucket must be locked, or `table` must not yet be published.
+ */
+static void insertEntry(Table *table, uint32_t hash, const ident key, const ident obj) {
+
+	Entry *entry = calloc(1, sizeof(Entry));
+	assert(entry);
+
+	entry->hash = hash;
+	entry->key = retain(key);
+	entry->obj = retain(obj);
+
+	Entry *volatile *bucket = &table->buckets[hash & (table->capacity - 1)];
+
+	entry->next = *bucket;
+
+	__atomic_store_n(bucket, entry, __ATOMIC_RELEASE);
+}
+
+/**
+ * @return The Entry for `key` in `table`, or `NULL`.
+ */
+static Entry *findEntry(const Table *table, const ident key, uint32_t hash) {
+
+	Entry *entry = __atomic_load_n(&table->buckets[hash & (table->capacity - 1)], __ATOMIC_ACQUIRE);
+
+	while (entry) {
+		if (entry->hash == hash) {
+			if (entry->key == key || $((Object *) entry->key, isEqual, key)) {
+				break;
+			}
+		}
+		entry = __atomic_load_n(&entry->next, __ATOMIC_ACQUIRE);
+	}
+
+	return entry;
+}
+
+/**
+ * @brief Destroys a retired Entry, releasing its pair.
+ */
+static void destroyEntry(ident ptr) {
+
+	Entry *entry = ptr;
+
+	release(entry->key);
+	release(entry->obj);
+
+	free(entry);
+}
+
+/**
+ * @brief Destroys a retired Table, and every Entry still chained within it.
+ */
+static void destroyTable(ident ptr) {
+
+	Table *table = ptr;
+
+	for (size_t i = 0; i < table->capacity; i++) {
+
+		Entry *entry = table->buckets[i];
+		while (entry) {
+			Entry *next = entry->next;
+			destroyEntry(entry);
+			entry = next;
+		}
+	}
+
+	free(table);
+}
+
+/**
+ * @brief Releases a retired Object.
+ */
+static void releaseObject(ident ptr) {
+	release(ptr);
+}
+
+/**
+ * @brief Enters a read-side critical section, during which retired items are not reclaimed.
+ *
+ * @return The epoch, which must be given to exitEpoch.
+ */
+static size_t enterEpoch(const ConcurrentDictionary *self) {
+
+	ConcurrentDictionary *this = (ConcurrentDictionary *) self;
+
+	while (true) {
+
+		const size_t epoch = __atomic_load_n(&this->locals.epoch, __ATOMIC_SEQ_CST);
+
+		__sync_add_and_fetch(&this->locals.readers[epoch & 1], 1);
+
+		if (__atomic_load_n(&this->locals.epoch, __ATOMIC_SEQ_CST) == epoch) {
+			return epoch;
+		}
+
+		__sync_sub_and_fetch(&this->locals.readers[epoch & 1], 1);
+	}
+}
+
+/**
+ * @brief Exits the read-side critical section entered at `epoch`.
+ */
+static void exitEpoch(const ConcurrentDictionary *self, size_t epoch) {
+
+	ConcurrentDictionary *this = (ConcurrentDictionary *) self;
+
+	__sync_sub_and_fetch(&this->locals.readers[epoch & 1], 1);
+}
+
+/**
+ * @brief Reclaims the items retired so far, once every reader that may observe them has exited.
+ *
+ * @remarks Readers never wait for reclamation; only the reclaiming writer waits for them.
+ */
+static void reclaim(ConcurrentDictionary *self) {
+
+	$(self->locals.reclaimLock, lock);
+
+	Garbage *garbage = __sync_lock_test_and_set(&self->locals.garbage, NULL);
+	if (garbage) {
+
+		const size_t epoch = __sync_fetch_and_add(&self->locals.epoch, 1);
+
+		while (__atomic_load_n(&self->locals.readers[epoch & 1], __ATOMIC_SEQ_CST)) {
+			sched_yield();
+		}
+
+		size_t count = 0;
+
+		while (garbage) {
+			Garbage *next = garbage->next;
+
+			garbage->destroy(garbage->ptr);
+			free(garbage);
+
+			garbage = next;
+			count++;
+		}
+
+		__sync_sub_and_fetch(&self->locals.garbageCount, count);
+	}
+
+	$(self->locals.reclaimLock, unlock);
+}
+
+/**
+ * @brief Retires `ptr`, which is no longer reachable by new readers, for reclamation.
+ */
+static void retire(ConcurrentDictionary *self, void (*destroy)(ident ptr), ident ptr) {
+
+	Garbage *garbage = calloc(1, sizeof(Garbage));
+	assert(garbage);
+
+	garbage->destroy = destroy;
+	garbage->ptr = ptr;
+
+	do {
+		garbage->next = __atomic_load_n(&self->locals.garbage, __ATOMIC_RELAXED);
+	} while (__sync_bool_compare_and_swap(&self->locals.garbage, garbage->next, garbage) == false);
+
+	if (__sync_add_and_fetch(&self->locals.garbageCount, 1) >= CONCURRENTDICTIONARY_RECLAIM_THRESHOLD) {
+		reclaim(self);
+	}
+}
+
+/**
+ * @brief Locks the stripe containing `hash`.
+ *
+ * @return The current Table, which will not be replaced until the stripe is unlocked.
+ */
+static Table *lockStripe(ConcurrentDictionary *self, uint32_t hash) {
+
+	Lock *lock = self->locals.locks[hash & (CONCURRENTDICTIONARY_STRIPES - 1)];
+
+	while (true) {
+
+		Table *table = __atomic_load_n(&self->locals.table, __ATOMIC_ACQUIRE);
+
+		$(lock, lock);
+
+		if (table == __atomic_load_n(&self->locals.table, __ATOMIC_ACQUIRE)) {
+			return table;
+		}
+
+		$(lock, unlock);
+	}
+}
+
+/**
+ * @brief Unlocks the stripe containing `hash`.
+ */
+static void unlockStripe(ConcurrentDictionary *self, uint32_t hash) {
+
+	$(self->locals.locks[hash & (CONCURRENTDICTIONARY_STRIPES - 1)], unlock);
+}
+
+/**
+ * @brief Locks every stripe, in order.
+ */
+static void lockStripes(ConcurrentDictionary *self) {
+
+	for (size_t i = 0; i < CONCURRENTDICTIONARY_STRIPES; i++) {
+		$(self->locals.locks[i], lock);
+	}
+}
+
+/**
+ * @brief Unlocks every stripe, in reverse order.
+ */
+static void unlockStripes(ConcurrentDictionary *self) {
+
+	for (size_t i = CONCURRENTDICTIONARY_STRIPES; i > 0; i--) {
+		$(self->locals.locks[i - 1], unlock);
+	}
+}
+
+/**
+ * @brief Publishes `table`, retiring the current Table. Every stripe must be locked.
+ */
+static void replaceTable(ConcurrentDictionary *self, Table *table) {
+
+	Table *current = self->locals.table;
+
+	__atomic_store_n(&self->locals.table, table, __ATOMIC_RELEASE);
+
+	retire(self, destroyTable, current);
+}
+
+/**
+ * @return True if `table` should grow. Its stripe must be locked.
+ */
+static inline _Bool setObjectForKey_isFull(const ConcurrentDictionary *self, const Table *table) {
+	return __atomic_load_n(&self->count, __ATOMIC_RELAXED) >= table->capacity * CONCURRENTDICTIONARY_MAX_LOAD;
+}
+
+/**
+ * @brief Grows the Table if its load exceeds the maximum, without blocking readers.
+ */
+static void setObjectForKey_resize(ConcurrentDictionary *self) {
+
+	lockStripes(self);
+
+	const Table *table = self->locals.table;
+
+	if (setObjectForKey_isFull(self, table)) {
+
+		Table *grown = allocTable(table->capacity * CONCURRENTDICTIONARY_GROW_FACTOR);
+
+		for (size_t i = 0; i < table->capacity; i++) {
+			for (Entry *entry = table->buckets[i]; entry; entry = entry->next) {
+				insertEntry(grown, entry->hash, entry->key, entry->obj);
+			}
+		}
+
+		replaceTable(self, grown);
+	}
+
+	unlockStripes(self);
+}
+
+#pragma mark - Object
+
+/**
+ * @see Object::copy(const Object *)
+ */
+static Object *copy(const Object *self) {
+	return NULL;
+}
+
+/**
+ * @see Object::dealloc(Object *)
+ */
+static void dealloc(Object *self) {
+
+	ConcurrentDictionary *this = (ConcurrentDictionary *) self;
+
+	reclaim(this);
+
+	destroyTable(this->locals.table);
+
+	for (size_t i = 0; i < CONCURRENTDICTIONARY_STRIPES; i++) {
+		release(this->locals.locks[i]);
+	}
+
+	release(this->locals.reclaimLock);
+
+	super(Object, self, dealloc);
+}
+
+/**
+ * @see Object::deepSizeInBytes(const Object *)
+ */
+static size_t deepSizeInBytes(const Object *self) {
+
+	const ConcurrentDictionary *this = (ConcurrentDictionary *) self;
+
+	size_t size = $(self, sizeInBytes);
+
+	const size_t epoch = enterEpoch(this);
+
+	const Table *table = __atomic_load_n(&this->locals.table, __ATOMIC_ACQUIRE);
+
+	for (size_t i = 0; i < table->capacity; i++) {
+
+		const Entry *entry = __atomic_load_n(&table->buckets[i], __ATOMIC_ACQUIRE);
+		while (entry) {
+
+			const Object *obj = __atomic_load_n(&entry->obj, __ATOMIC_ACQUIRE);
+
+			size += $((Object *) entry->key, deepSizeInBytes) + $(obj, deepSizeInBytes);
+
+			entry = __atomic_load_n(&entry->next, __ATOMIC_ACQUIRE);
+		}
+	}
+
+	exitEpoch(this, epoch);
+
+	return size;
+}
+
+/**
+ * @see Object::description(const Object *)
+ */
+static String *description(const Object *self) {
+
+	Dictionary *dictionary = $((ConcurrentDictionary *) self, dictionary);
+
+	String *description = $((Object *) dictionary, description);
+
+	release(dictionary);
+
+	return description;
+}
+
+/**
+ * @see Object::sizeInBytes(const Object *)
+ *
+ * @remarks Tables and Entries retired but not yet reclaimed are not counted.
+ */
+static size_t sizeInBytes(const Object *self) {
+
+	const ConcurrentDictionary *this = (ConcurrentDictionary *) self;
+
+	size_t size = super(Object, self, sizeInBytes) + $((Object *) this->locals.reclaimLock, sizeInBytes);
+
+	for (size_t i = 0; i < CONCURRENTDICTIONARY_STRIPES; i++) {
+		size += $((Object *) this->locals.locks[i], sizeInBytes);
+	}
+
+	const size_t epoch = enterEpoch(this);
+
+	const Table *table = __atomic_load_n(&this->locals.table, __ATOMIC_ACQUIRE);
+
+	size += sizeof(Table) + table->capacity * sizeof(Entry *);
+
+	for (size_t i = 0; i < table->capacity; i++) {
+
+		const Entry *entry = __atomic_load_n(&table->buckets[i], __ATOMIC_ACQUIRE);
+		while (entry) {
+
+			size += sizeof(Entry);
+
+			entry = __atomic_load_n(&entry->next, __ATOMIC_ACQUIRE);
+		}
+	}
+
+	exitEpoch(this, epoch);
+
+	return size;
+}
+
+#pragma mark - ConcurrentDictionary
+
+/**
+ * @fn Dictionary *ConcurrentDictionary::dictionary(const ConcurrentDictionary *self)
+ *
+ * @memberof ConcurrentDictionary
+ */
+static Dictionary *dictionary(const ConcurrentDictionary *self) {
+
+	MutableDictionary *dictionary = alloc(MutableDictionary, initWithCapacity, __atomic_load_n(&self->count, __ATOMIC_RELAXED));
+
+	const size_t epoch = enterEpoch(self);
+
+	const Table *table = __atomic_load_n(&self->locals.table, __ATOMIC_ACQUIRE);
+
+	for (size_t i = 0; i < table->capacity; i++) {
+
+		const Entry *entry = __atomic_load_n(&table->buckets[i], __ATOMIC_ACQUIRE);
+		while (entry) {
+
+			$(dictionary, setObjectForKey, __atomic_load_n(&entry->obj, __ATOMIC_ACQUIRE), entry->key);
+
+			entry = __atomic_load_n(&entry->next, __ATOMIC_ACQUIRE);
+		}
+	}
+
+	exitEpoch(self, epoch);
+
+	return (Dictionary *) dictionary;
+}
+
+/**
+ * @fn ConcurrentDictionary *ConcurrentDictionary::init(ConcurrentDictionary *self)
+ *
+ * @memberof ConcurrentDictionary
+ */
+static ConcurrentDictionary *init(ConcurrentDictionary *self) {
+
+	return $(self, initWithCapacity, CONCURRENTDICTIONARY_DEFAULT_CAPACITY);
+}
+
+/**
+ * @fn ConcurrentDictionary *ConcurrentDictionary::initWithCapacity(ConcurrentDictionary *self, size_t capacity)
+ *
+ * @memberof ConcurrentDictionary
+ */
+static ConcurrentDictionary *initWithCapacity(ConcurrentDictionary *self, size_t capacity) {
+
+	self = (ConcurrentDictionary *) super(Object, self, init);
+	if (self) {
+
+		size_t size = CONCURRENTDICTIONARY_STRIPES;
+		while (size < capacity) {
+			size <<= 1;
+		}
+
+		self->locals.table = allocTable(size);
+
+		for (size_t i = 0; i < CONCURRENTDICTIONARY_STRIPES; i++) {
+			self->locals.locks[i] = alloc(Lock, init);
+			assert(self->locals.locks[i]);
+		}
+
+		self->locals.reclaimLock = alloc(Lock, init);
+		assert(self->locals.reclaimLock);
+	}
+
+	return self;
+}
+
+/**
+ * @fn ident ConcurrentDictionary::objectForKey(const ConcurrentDictionary *self, const ident key)
+ *
+ * @memberof ConcurrentDictionary
+ */
+static ident objectForKey(const ConcurrentDictionary *self, const ident key) {
+
+	assert(key);
+
+	const uint32_t hash = hashForKey(key);
+
+	const size_t epoch = enterEpoch(self);
+
+	const Entry *entry = findEntry(__atomic_load_n(&self->locals.table, __ATOMIC_ACQUIRE), key, hash);
+
+	ident obj = entry ? retain(__atomic_load_n(&entry->obj, __ATOMIC_ACQUIRE)) : NULL;
+
+	exitEpoch(self, epoch);
+
+	return obj;
+}
+
+/**
+ * @fn ident ConcurrentDictionary::objectForKeyOrInsert(ConcurrentDictionary *self, const ident key, Functor functor, ident data)
+ *
+ * @memberof ConcurrentDictionary
+ */
+static ident objectForKeyOrInsert(ConcurrentDictionary *self, const ident key, Functor functor, ident data) {
+
+	assert(functor);
+
+	ident obj = $(self, objectForKey, key);
+	if (obj) {
+		return obj;
+	}
+
+	const uint32_t hash = hashForKey(key);
+
+	Table *table = lockStripe(self, hash);
+
+	const Entry *entry = findEntry(table, key, hash);
+	if (entry) {
+		obj = retain(entry->obj);
+	} else {
+		obj = functor(key, data);
+		assert(obj);
+
+		insertEntry(table, hash, key, obj);
+		__sync_add_and_fetch(&self->count, 1);
+	}
+
+	const _Bool isFull = setObjectForKey_isFull(self, table);
+
+	unlockStripe(self, hash);
+
+	if (isFull) {
+		setObjectForKey_resize(self);
+	}
+
+	return obj;
+}
+
+/**
+ * @fn void ConcurrentDictionary::removeAllObjects(ConcurrentDictionary *self)
+ *
+ * @memberof ConcurrentDictionary
+ */
+static void removeAllObjects(ConcurrentDictionary *self) {
+
+	lockStripes(self);
+
+	const Table *table = self->locals.table;
+
+	replaceTable(self, allocTable(table->capacity));
+
+	__atomic_store_n(&self->count, 0, __ATOMIC_RELAXED);
+
+	unlockStripes(self);
+}
+
+/**
+ * @fn void ConcurrentDictionary::removeObjectForKey(ConcurrentDictionary *self, const ident key)
+ *
+ * @memberof ConcurrentDictionary
+ */
+static void removeObjectForKey(ConcurrentDictionary *self, const ident key) {
+
+	assert(key);
+
+	const uint32_t hash = hashForKey(key);
+
+	Table *table = lockStripe(self, hash);
+
+	Entry *volatile *link = &table->buckets[hash & (table->capacity - 1)];
+
+	while (*link) {
+
+		Entry *entry = *link;
+
+		if (entry->hash == hash) {
+			if (entry->key == key || $((Object *) entry->key, isEqual, key)) {
+
+				__atomic_store_n(link, entry->next, __ATOMIC_RELEASE);
+				__sync_sub_and_fetch(&self->count, 1);
+
+				retire(self, destroyEntry, entry);
+				break;
+			}
+		}
+
+		link = &entry->next;
+	}
+
+	unlockStripe(self, hash);
+}
+
+/**
+ * @fn void ConcurrentDictionary::setObjectForKey(ConcurrentDictionary *self, const ident obj, const ident key)
+ *
+ * @memberof ConcurrentDictionary
+ */
+static void setObjectForKey(ConcurrentDictionary *self, const ident obj, const ident key) {
+
+	assert(obj);
+	assert(key);
+
+	const uint32_t hash = hashForKey(key);
+
+	Table *table = lockStripe(self, hash);
+
+	Entry *entry = findEntry(table, key, hash);
+	if (entry) {
+
+		ident replaced = entry->obj;
+		if (replaced != obj) {
+
+			__atomic_store_n(&entry->obj, retain(obj), __ATOMIC_RELEASE);
+
+			retire(self, releaseObject, replaced);
+		}
+	} else {
+		insertEntry(table, hash, key, obj);
+		__sync_add_and_fetch(&self->count, 1);
+	}
+
+	const _Bool isFull = setObjectForKey_isFull(self, table);
+
+	unlockStripe(self, hash);
+
+	if (isFull) {
+		setObjectForKey_resize(self);
+	}
+}
+
+#pragma mark - Class lifecycle
+
+/**
+ * @see Class::initialize(Class *)
+ */
+static void initialize(Class *clazz) {
+
+	ObjectInterface *object = (ObjectInterface *) clazz->interface;
+
+	object->copy = copy;
+	object->dealloc = dealloc;
+	object->deepSizeInBytes = deepSizeInBytes;
+	object->description = description;
+	object->sizeInBytes = sizeInBytes;
+
+	ConcurrentDictionaryInterface *concurrentDictionary = (ConcurrentDictionaryInterface *) clazz->interface;
+
+	concurrentDictionary->dictionary = dictionary;
+	concurrentDictionary->init = init;
+	concurrentDictionary->initWithCapacity = initWithCapacity;
+	concurrentDictionary->objectForKey = objectForKey;
+	concurrentDictionary->objectForKeyOrInsert = objectForKeyOrInsert;
+	concurrentDictionary->removeAllObjects = removeAllObjects;
+	concurrentDictionary->removeObjectForKey = removeObjectForKey;
+	concurrentDictionary->setObjectForKey = setObjectForKey;
+}
+
+Class _ConcurrentDictionary = {
+	.name = "ConcurrentDictionary",
+	.superclass = &_Object,
+	.instanceSize = sizeof(ConcurrentDictionary),
+	.interfaceOffset = offsetof(ConcurrentDictionary, interface),
+	.interfaceSize = sizeof(ConcurrentDictionaryInterface),
+	.initialize = initialize,
+};
+
+#undef _Class
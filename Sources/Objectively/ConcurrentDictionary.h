@@ -0,0 +1,234 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#pragma once
+
+#include <Objectively/Dictionary.h>
+#include <Objectively/Lock.h>
+
+/**
+ * @file
+ *
+ * @brief Thread-safe key-value stores with lock-free reads.
+ */
+
+/**
+ * @brief The count of Locks that stripe the writes to a ConcurrentDictionary.
+ */
+#define CONCURRENTDICTIONARY_STRIPES 16
+
+typedef struct ConcurrentDictionary ConcurrentDictionary;
+typedef struct ConcurrentDictionaryInterface ConcurrentDictionaryInterface;
+
+/**
+ * @brief Thread-safe key-value stores with lock-free reads.
+ *
+ * @details Lookups never take a lock, and never wait for writers, even while the table is
+ * resized. Writers lock only the stripe of the table that contains the key, so writes to
+ * different keys rarely contend.
+ *
+ * Entries, Objects and tables that writers replace are retired rather than released, and
+ * reclaimed in batches once every reader that might have observed them has finished (epoch
+ * based reclamation). Because of this, the Objects returned by ConcurrentDictionary are retained
+ * on behalf of the caller, and remain valid no matter what other threads do.
+ *
+ * @extends Object
+ *
+ * @ingroup Concurrency
+ */
+struct ConcurrentDictionary {
+
+	/**
+	 * @brief The parent.
+	 *
+	 * @private
+	 */
+	Object object;
+
+	/**
+	 * @brief The typed interface.
+	 *
+	 * @private
+	 */
+	ConcurrentDictionaryInterface *interface;
+
+	/**
+	 * @private
+	 */
+	struct {
+
+		/**
+		 * @brief The current epoch.
+		 */
+		volatile size_t epoch;
+
+		/**
+		 * @brief The retired entries, Objects and tables, awaiting reclamation.
+		 */
+		ident volatile garbage;
+
+		/**
+		 * @brief The count of retired items.
+		 */
+		volatile size_t garbageCount;
+
+		/**
+		 * @brief The Locks striping writes.
+		 */
+		Lock *locks[CONCURRENTDICTIONARY_STRIPES];
+
+		/**
+		 * @brief The count of readers within each of the two most recent epochs.
+		 */
+		volatile size_t readers[2];
+
+		/**
+		 * @brief The Lock serializing reclamation.
+		 */
+		Lock *reclaimLock;
+
+		/**
+		 * @brief The table.
+		 */
+		ident volatile table;
+
+	} locals;
+
+	/**
+	 * @brief The count of elements.
+	 */
+	volatile size_t count;
+};
+
+/**
+ * @brief The ConcurrentDictionary interface.
+ */
+struct ConcurrentDictionaryInterface {
+
+	/**
+	 * @brief The parent interface.
+	 */
+	ObjectInterface objectInterface;
+
+	/**
+	 * @fn Dictionary *ConcurrentDictionary::dictionary(const ConcurrentDictionary *self)
+	 *
+	 * @return A new Dictionary containing a snapshot of the elements of this
+	 * ConcurrentDictionary.
+	 *
+	 * @remarks The snapshot is consistent per key, but not across keys written concurrently.
+	 *
+	 * @memberof ConcurrentDictionary
+	 */
+	Dictionary *(*dictionary)(const ConcurrentDictionary *self);
+
+	/**
+	 * @fn ConcurrentDictionary *ConcurrentDictionary::init(ConcurrentDictionary *self)
+	 *
+	 * @brief Initializes this ConcurrentDictionary.
+	 *
+	 * @return The initialized ConcurrentDictionary, or `NULL` on error.
+	 *
+	 * @memberof ConcurrentDictionary
+	 */
+	ConcurrentDictionary *(*init)(ConcurrentDictionary *self);
+
+	/**
+	 * @fn ConcurrentDictionary *ConcurrentDictionary::initWithCapacity(ConcurrentDictionary *self, size_t capacity)
+	 *
+	 * @brief Initializes this ConcurrentDictionary with the specified capacity.
+	 *
+	 * @param capacity The initial capacity.
+	 *
+	 * @return The initialized ConcurrentDictionary, or `NULL` on error.
+	 *
+	 * @memberof ConcurrentDictionary
+	 */
+	ConcurrentDictionary *(*initWithCapacity)(ConcurrentDictionary *self, size_t capacity);
+
+	/**
+	 * @fn ident ConcurrentDictionary::objectForKey(const ConcurrentDictionary *self, const ident key)
+	 *
+	 * @return The Object stored at the specified key, retained, or `NULL`.
+	 *
+	 * @remarks The caller must release the returned Object. This method never blocks.
+	 *
+	 * @memberof ConcurrentDictionary
+	 */
+	ident (*objectForKey)(const ConcurrentDictionary *self, const ident key);
+
+	/**
+	 * @fn ident ConcurrentDictionary::objectForKeyOrInsert(ConcurrentDictionary *self, const ident key, Functor functor, ident data)
+	 *
+	 * @brief Atomically retrieves the Object stored at `key`, or creates and stores it.
+	 *
+	 * @param key The key.
+	 * @param functor The Functor creating the Object, which is given `key` and `data`.
+	 * @param data User data.
+	 *
+	 * @return The existing or created Object, retained.
+	 *
+	 * @remarks The caller must release the returned Object. `functor` is called at most once,
+	 * while the key's stripe is locked, so it must not modify this ConcurrentDictionary.
+	 *
+	 * @memberof ConcurrentDictionary
+	 */
+	ident (*objectForKeyOrInsert)(ConcurrentDictionary *self, const ident key, Functor functor, ident data);
+
+	/**
+	 * @fn void ConcurrentDictionary::removeAllObjects(ConcurrentDictionary *self)
+	 *
+	 * @brief Removes all Objects from this ConcurrentDictionary.
+	 *
+	 * @memberof ConcurrentDictionary
+	 */
+	void (*removeAllObjects)(ConcurrentDictionary *self);
+
+	/**
+	 * @fn void ConcurrentDictionary::removeObjectForKey(ConcurrentDictionary *self, const ident key)
+	 *
+	 * @brief Removes the Object with the specified key from this ConcurrentDictionary.
+	 *
+	 * @param key The key of the Object to remove.
+	 *
+	 * @memberof ConcurrentDictionary
+	 */
+	void (*removeObjectForKey)(ConcurrentDictionary *self, const ident key);
+
+	/**
+	 * @fn void ConcurrentDictionary::setObjectForKey(ConcurrentDictionary *self, const ident obj, const ident key)
+	 *
+	 * @brief Sets a pair in this ConcurrentDictionary.
+	 *
+	 * @param obj The Object to set.
+	 * @param key The key of the Object to set.
+	 *
+	 * @memberof ConcurrentDictionary
+	 */
+	void (*setObjectForKey)(ConcurrentDictionary *self, const ident obj, const ident key);
+};
+
+/**
+ * @brief The ConcurrentDictionary Class.
+ */
+extern Class _ConcurrentDictionary;
@@ -0,0 +1,504 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <Objectively/CuckooFilter.h>
+#include <Objectively/Hash.h>
+
+#include "LittleEndian.h"
+
+#define _Class _CuckooFilter
+
+#define CUCKOOFILTER_MAGIC 0x464b434f /* "OCKF" */
+#define CUCKOOFILTER_VERSION 1
+#define CUCKOOFILTER_HEADER_SIZE 40
+#define CUCKOOFILTER_MAX_LOAD 0.95
+#define CUCKOOFILTER_MAX_KICKS 500
+
+#define LANES_LOW 0x0001000100010001ull
+#define LANES_HIGH 0x8000800080008000ull
+
+/**
+ * @return The hash of `obj`.
+ */
+static uint64_t hashForObject(const ident obj) {
+
+	const int hash = $((Object *) obj, hash);
+
+	return HashForBytes64(HASH_SEED, (const uint8_t *) &hash, sizeof(hash));
+}
+
+/**
+ * @return The non-zero fingerprint for `hash`.
+ */
+static uint16_t fingerprintForHash(uint64_t hash) {
+
+	const uint16_t fingerprint = hash >> 48;
+
+	return fingerprint ? fingerprint : 1;
+}
+
+/**
+ * @return The alternate bucket index of `fingerprint` in bucket `index`.
+ */
+static size_t alternateIndex(const CuckooFilter *self, size_t index, uint16_t fingerprint) {
+	return (index ^ (fingerprint * 0x5bd1e995u)) & (self->bucketCount - 1);
+}
+
+/**
+ * @return The lane of `bucket` holding `fingerprint`, or `-1`. A fingerprint of `0` finds an
+ * empty lane.
+ */
+static int laneOfFingerprint(uint64_t bucket, uint16_t fingerprint) {
+
+	const uint64_t x = bucket ^ (fingerprint * LANES_LOW);
+	const uint64_t zero = (x - LANES_LOW) & ~x & LANES_HIGH;
+
+	return zero ? __builtin_ctzll(zero) >> 4 : -1;
+}
+
+/**
+ * @brief Stores `fingerprint` in `lane` of bucket `index`.
+ */
+static void setLane(CuckooFilter *self, size_t index, int lane, uint16_t fingerprint) {
+
+	uint64_t *bucket = &self->locals.buckets[index];
+
+	*bucket &= ~(0xffffull << (lane << 4));
+	*bucket |= ((uint64_t) fingerprint) << (lane << 4);
+}
+
+/**
+ * @return True if `fingerprint` was stored in an empty lane of bucket `index`.
+ */
+static _Bool insertFingerprint(CuckooFilter *self, size_t index, uint16_t fingerprint) {
+
+	const int lane = laneOfFingerprint(self->locals.buckets[index], 0);
+	if (lane > -1) {
+		setLane(self, index, lane, fingerprint);
+		return true;
+	}
+
+	return false;
+}
+
+/**
+ * @return The next pseudo-random number of `self`.
+ */
+static uint64_t nextRandom(CuckooFilter *self) {
+
+	uint64_t x = self->locals.random;
+
+	x ^= x << 13;
+	x ^= x >> 7;
+	x ^= x << 17;
+
+	return self->locals.random = x;
+}
+
+/**
+ * @brief Adds `fingerprint` to bucket `index` or its alternate, relocating other fingerprints
+ * as needed. If no room can be made, the last displaced fingerprint becomes the victim.
+ */
+static void addFingerprint(CuckooFilter *self, size_t index, uint16_t fingerprint) {
+
+	const size_t alternate = alternateIndex(self, index, fingerprint);
+
+	if (insertFingerprint(self, index, fingerprint) || insertFingerprint(self, alternate, fingerprint)) {
+		return;
+	}
+
+	if (nextRandom(self) & 1) {
+		index = alternate;
+	}
+
+	for (int i = 0; i < CUCKOOFILTER_MAX_KICKS; i++) {
+
+		const int lane = nextRandom(self) % CUCKOOFILTER_BUCKET_SIZE;
+		const uint16_t displaced = self->locals.buckets[index] >> (lane << 4);
+
+		setLane(self, index, lane, fingerprint);
+
+		fingerprint = displaced;
+		index = alternateIndex(self, index, fingerprint);
+
+		if (insertFingerprint(self, index, fingerprint)) {
+			return;
+		}
+	}
+
+	self->locals.victim.index = index;
+	self->locals.victim.fingerprint = fingerprint;
+	self->locals.victim.isUsed = true;
+}
+
+/**
+ * @return True if `hash` was added to `self`.
+ */
+static _Bool addHash(CuckooFilter *self, uint64_t hash) {
+
+	if (self->locals.victim.isUsed) {
+		return false;
+	}
+
+	addFingerprint(self, hash & (self->bucketCount - 1), fingerprintForHash(hash));
+
+	self->count++;
+	return true;
+}
+
+/**
+ * @return True if `self` might contain `hash`.
+ */
+static _Bool containsHash(const CuckooFilter *self, uint64_t hash) {
+
+	const uint16_t fingerprint = fingerprintForHash(hash);
+
+	const size_t index = hash & (self->bucketCount - 1);
+	const size_t alternate = alternateIndex(self, index, fingerprint);
+
+	if (laneOfFingerprint(self->locals.buckets[index], fingerprint) > -1 ||
+		laneOfFingerprint(self->locals.buckets[alternate], fingerprint) > -1) {
+		return true;
+	}
+
+	return self->locals.victim.isUsed &&
+		self->locals.victim.fingerprint == fingerprint &&
+		(self->locals.victim.index == index || self->locals.victim.index == alternate);
+}
+
+/**
+ * @return True if `hash` was removed from `self`.
+ */
+static _Bool removeHash(CuckooFilter *self, uint64_t hash) {
+
+	const uint16_t fingerprint = fingerprintForHash(hash);
+
+	const size_t index = hash & (self->bucketCount - 1);
+	const size_t alternate = alternateIndex(self, index, fingerprint);
+
+	const size_t indexes[] = { index, alternate };
+	for (size_t i = 0; i < lengthof(indexes); i++) {
+
+		const int lane = laneOfFingerprint(self->locals.buckets[indexes[i]], fingerprint);
+		if (lane > -1) {
+			setLane(self, indexes[i], lane, 0);
+			self->count--;
+
+			if (self->locals.victim.isUsed) {
+				self->locals.victim.isUsed = false;
+				addFingerprint(self, self->locals.victim.index, self->locals.victim.fingerprint);
+			}
+
+			return true;
+		}
+	}
+
+	if (self->locals.victim.isUsed && self->locals.victim.fingerprint == fingerprint &&
+		(self->locals.victim.index == index || self->locals.victim.index == alternate)) {
+		self->locals.victim.isUsed = false;
+		self->count--;
+		return true;
+	}
+
+	return false;
+}
+
+/**
+ * @brief Allocates `bucketCount` zeroed buckets for `self`.
+ */
+static void allocBuckets(CuckooFilter *self, size_t bucketCount) {
+
+	self->bucketCount = bucketCount;
+
+	self->locals.buckets = calloc(self->bucketCount, sizeof(uint64_t));
+	assert(self->locals.buckets);
+
+	self->locals.random = 0x2545f4914f6cdd1dull;
+}
+
+#pragma mark - Object
+
+/**
+ * @see Object::copy(const Object *)
+ */
+static Object *copy(const Object *self) {
+
+	const CuckooFilter *this = (CuckooFilter *) self;
+
+	CuckooFilter *that = (CuckooFilter *) super(Object, _alloc(&_CuckooFilter), init);
+	if (that) {
+		allocBuckets(that, this->bucketCount);
+		memcpy(that->locals.buckets, this->locals.buckets, this->bucketCount * sizeof(uint64_t));
+
+		that->locals.victim = this->locals.victim;
+		that->count = this->count;
+	}
+
+	return (Object *) that;
+}
+
+/**
+ * @see Object::dealloc(Object *)
+ */
+static void dealloc(Object *self) {
+
+	CuckooFilter *this = (CuckooFilter *) self;
+
+	free(this->locals.buckets);
+
+	super(Object, self, dealloc);
+}
+
+/**
+ * @see Object::sizeInBytes(const Object *)
+ */
+static size_t sizeInBytes(const Object *self) {
+
+	const CuckooFilter *this = (CuckooFilter *) self;
+
+	return super(Object, self, sizeInBytes) + this->bucketCount * sizeof(uint64_t);
+}
+
+#pragma mark - CuckooFilter
+
+/**
+ * @fn _Bool CuckooFilter::addBytes(CuckooFilter *self, const uint8_t *bytes, size_t length)
+ *
+ * @memberof CuckooFilter
+ */
+static _Bool addBytes(CuckooFilter *self, const uint8_t *bytes, size_t length) {
+
+	assert(bytes || length == 0);
+
+	return addHash(self, HashForBytes64(HASH_SEED, bytes, length));
+}
+
+/**
+ * @fn _Bool CuckooFilter::addObject(CuckooFilter *self, const ident obj)
+ *
+ * @memberof CuckooFilter
+ */
+static _Bool addObject(CuckooFilter *self, const ident obj) {
+
+	assert(obj);
+
+	return addHash(self, hashForObject(obj));
+}
+
+/**
+ * @fn _Bool CuckooFilter::containsBytes(const CuckooFilter *self, const uint8_t *bytes, size_t length)
+ *
+ * @memberof CuckooFilter
+ */
+static _Bool containsBytes(const CuckooFilter *self, const uint8_t *bytes, size_t length) {
+
+	assert(bytes || length == 0);
+
+	return containsHash(self, HashForBytes64(HASH_SEED, bytes, length));
+}
+
+/**
+ * @fn _Bool CuckooFilter::containsObject(const CuckooFilter *self, const ident obj)
+ *
+ * @memberof CuckooFilter
+ */
+static _Bool containsObject(const CuckooFilter *self, const ident obj) {
+
+	assert(obj);
+
+	return containsHash(self, hashForObject(obj));
+}
+
+/**
+ * @fn Data *CuckooFilter::data(const CuckooFilter *self)
+ *
+ * @memberof CuckooFilter
+ */
+static Data *data(const CuckooFilter *self) {
+
+	const size_t length = CUCKOOFILTER_HEADER_SIZE + self->bucketCount * sizeof(uint64_t);
+
+	uint8_t *bytes = malloc(length);
+	assert(bytes);
+
+	writeLittleEndian(bytes + 0, CUCKOOFILTER_MAGIC, 4);
+	writeLittleEndian(bytes + 4, CUCKOOFILTER_VERSION, 4);
+	writeLittleEndian(bytes + 8, self->bucketCount, 8);
+	writeLittleEndian(bytes + 16, self->count, 8);
+	writeLittleEndian(bytes + 24, self->locals.victim.index, 8);
+	writeLittleEndian(bytes + 32, self->locals.victim.fingerprint, 2);
+	writeLittleEndian(bytes + 34, self->locals.victim.isUsed, 2);
+	writeLittleEndian(bytes + 36, 0, 4);
+
+	for (size_t i = 0; i < self->bucketCount; i++) {
+		writeLittleEndian(bytes + CUCKOOFILTER_HEADER_SIZE + i * sizeof(uint64_t), self->locals.buckets[i], 8);
+	}
+
+	return $$(Data, dataWithMemory, bytes, length);
+}
+
+/**
+ * @fn CuckooFilter *CuckooFilter::initWithCapacity(CuckooFilter *self, size_t capacity)
+ *
+ * @memberof CuckooFilter
+ */
+static CuckooFilter *initWithCapacity(CuckooFilter *self, size_t capacity) {
+
+	self = (CuckooFilter *) super(Object, self, init);
+	if (self) {
+
+		const size_t buckets = capacity / (CUCKOOFILTER_BUCKET_SIZE * CUCKOOFILTER_MAX_LOAD) + 1;
+
+		size_t bucketCount = 1;
+		while (bucketCount < buckets) {
+			bucketCount <<= 1;
+		}
+
+		allocBuckets(self, bucketCount);
+	}
+
+	return self;
+}
+
+/**
+ * @fn CuckooFilter *CuckooFilter::initWithData(CuckooFilter *self, const Data *data)
+ *
+ * @memberof CuckooFilter
+ */
+static CuckooFilter *initWithData(CuckooFilter *self, const Data *data) {
+
+	assert(data);
+
+	self = (CuckooFilter *) super(Object, self, init);
+	if (self) {
+
+		const uint8_t *bytes = data->bytes;
+
+		if (data->length < CUCKOOFILTER_HEADER_SIZE ||
+			readLittleEndian(bytes + 0, 4) != CUCKOOFILTER_MAGIC ||
+			readLittleEndian(bytes + 4, 4) != CUCKOOFILTER_VERSION) {
+			release(self);
+			return NULL;
+		}
+
+		const uint64_t bucketCount = readLittleEndian(bytes + 8, 8);
+		const size_t size = data->length - CUCKOOFILTER_HEADER_SIZE;
+
+		if (bucketCount == 0 || (bucketCount & (bucketCount - 1)) || size / sizeof(uint64_t) != bucketCount ||
+			size % sizeof(uint64_t) || readLittleEndian(bytes + 24, 8) >= bucketCount) {
+			release(self);
+			return NULL;
+		}
+
+		allocBuckets(self, bucketCount);
+
+		for (size_t i = 0; i < bucketCount; i++) {
+			self->locals.buckets[i] = readLittleEndian(bytes + CUCKOOFILTER_HEADER_SIZE + i * sizeof(uint64_t), 8);
+		}
+
+		self->count = readLittleEndian(bytes + 16, 8);
+
+		self->locals.victim.index = readLittleEndian(bytes + 24, 8);
+		self->locals.victim.fingerprint = readLittleEndian(bytes + 32, 2);
+		self->locals.victim.isUsed = readLittleEndian(bytes + 34, 2) != 0;
+	}
+
+	return self;
+}
+
+/**
+ * @fn void CuckooFilter::removeAllObjects(CuckooFilter *self)
+ *
+ * @memberof CuckooFilter
+ */
+static void removeAllObjects(CuckooFilter *self) {
+
+	memset(self->locals.buckets, 0, self->bucketCount * sizeof(uint64_t));
+	memset(&self->locals.victim, 0, sizeof(self->locals.victim));
+
+	self->count = 0;
+}
+
+/**
+ * @fn _Bool CuckooFilter::removeBytes(CuckooFilter *self, const uint8_t *bytes, size_t length)
+ *
+ * @memberof CuckooFilter
+ */
+static _Bool removeBytes(CuckooFilter *self, const uint8_t *bytes, size_t length) {
+
+	assert(bytes || length == 0);
+
+	return removeHash(self, HashForBytes64(HASH_SEED, bytes, length));
+}
+
+/**
+ * @fn _Bool CuckooFilter::removeObject(CuckooFilter *self, const ident obj)
+ *
+ * @memberof CuckooFilter
+ */
+static _Bool removeObject(CuckooFilter *self, const ident obj) {
+
+	assert(obj);
+
+	return removeHash(self, hashForObject(obj));
+}
+
+#pragma mark - Class lifecycle
+
+/**
+ * @see Class::initialize(Class *)
+ */
+static void initialize(Class *clazz) {
+
+	((ObjectInterface *) clazz->interface)->copy = copy;
+	((ObjectInterface *) clazz->interface)->dealloc = dealloc;
+	((ObjectInterface *) clazz->interface)->sizeInBytes = sizeInBytes;
+
+	CuckooFilterInterface *cuckooFilter = (CuckooFilterInterface *) clazz->interface;
+
+	cuckooFilter->addBytes = addBytes;
+	cuckooFilter->addObject = addObject;
+	cuckooFilter->containsBytes = containsBytes;
+	cuckooFilter->containsObject = containsObject;
+	cuckooFilter->data = data;
+	cuckooFilter->initWithCapacity = initWithCapacity;
+	cuckooFilter->initWithData = initWithData;
+	cuckooFilter->removeAllObjects = removeAllObjects;
+	cuckooFilter->removeBytes = removeBytes;
+	cuckooFilter->removeObject = removeObject;
+}
+
+Class _CuckooFilter = {
+	.name = "CuckooFilter",
+	.superclass = &_Object,
+	.instanceSize = sizeof(CuckooFilter),
+	.interfaceOffset = offsetof(CuckooFilter, interface),
+	.interfaceSize = sizeof(CuckooFilterInterface),
+	.initialize = initialize,
+};
+
+#undef _Class
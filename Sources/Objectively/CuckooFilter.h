@@ -0,0 +1,250 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#pragma once
+
+#include <Objectively/Data.h>
+
+/**
+ * @file
+ *
+ * @brief Probabilistic set membership with deletion.
+ */
+
+/**
+ * @brief The count of fingerprints in each bucket of a CuckooFilter.
+ */
+#define CUCKOOFILTER_BUCKET_SIZE 4
+
+typedef struct CuckooFilter CuckooFilter;
+typedef struct CuckooFilterInterface CuckooFilterInterface;
+
+/**
+ * @brief Probabilistic set membership with deletion.
+ *
+ * @details CuckooFilters store a 16 bit fingerprint of each member in one of two candidate
+ * buckets of four fingerprints, relocating existing fingerprints to their alternate buckets to
+ * make room when both candidates are full. Unlike BloomFilter, members may be removed. Each
+ * bucket is a single 64 bit word, so a query touches at most two words, and tests all four
+ * fingerprints of each at once.
+ *
+ * @remarks Removing a member that was never added may remove another member that shares its
+ * fingerprint, causing a false negative.
+ *
+ * @extends Object
+ *
+ * @ingroup Collections
+ */
+struct CuckooFilter {
+
+	/**
+	 * @brief The parent.
+	 *
+	 * @private
+	 */
+	Object object;
+
+	/**
+	 * @brief The typed interface.
+	 *
+	 * @private
+	 */
+	CuckooFilterInterface *interface;
+
+	/**
+	 * @private
+	 */
+	struct {
+
+		/**
+		 * @brief The buckets.
+		 */
+		uint64_t *buckets;
+
+		/**
+		 * @brief The state of the random number generator that selects fingerprints to relocate.
+		 */
+		uint64_t random;
+
+		/**
+		 * @brief The fingerprint that could not be relocated when this CuckooFilter filled.
+		 */
+		struct {
+			size_t index;
+			uint16_t fingerprint;
+			_Bool isUsed;
+		} victim;
+
+	} locals;
+
+	/**
+	 * @brief The count of buckets, a power of two.
+	 */
+	size_t bucketCount;
+
+	/**
+	 * @brief The count of members.
+	 */
+	size_t count;
+};
+
+/**
+ * @brief The CuckooFilter interface.
+ */
+struct CuckooFilterInterface {
+
+	/**
+	 * @brief The parent interface.
+	 */
+	ObjectInterface objectInterface;
+
+	/**
+	 * @fn _Bool CuckooFilter::addBytes(CuckooFilter *self, const uint8_t *bytes, size_t length)
+	 *
+	 * @brief Adds the specified bytes to this CuckooFilter.
+	 *
+	 * @param bytes The bytes.
+	 * @param length The count of `bytes`.
+	 *
+	 * @return True if `bytes` was added, false if this CuckooFilter is full.
+	 *
+	 * @memberof CuckooFilter
+	 */
+	_Bool (*addBytes)(CuckooFilter *self, const uint8_t *bytes, size_t length);
+
+	/**
+	 * @fn _Bool CuckooFilter::addObject(CuckooFilter *self, const ident obj)
+	 *
+	 * @brief Adds the specified Object to this CuckooFilter.
+	 *
+	 * @param obj The Object.
+	 *
+	 * @return True if `obj` was added, false if this CuckooFilter is full.
+	 *
+	 * @memberof CuckooFilter
+	 */
+	_Bool (*addObject)(CuckooFilter *self, const ident obj);
+
+	/**
+	 * @fn _Bool CuckooFilter::containsBytes(const CuckooFilter *self, const uint8_t *bytes, size_t length)
+	 *
+	 * @param bytes The bytes.
+	 * @param length The count of `bytes`.
+	 *
+	 * @return False if this CuckooFilter definitely does not contain `bytes`, true if it might.
+	 *
+	 * @memberof CuckooFilter
+	 */
+	_Bool (*containsBytes)(const CuckooFilter *self, const uint8_t *bytes, size_t length);
+
+	/**
+	 * @fn _Bool CuckooFilter::containsObject(const CuckooFilter *self, const ident obj)
+	 *
+	 * @param obj The Object.
+	 *
+	 * @return False if this CuckooFilter definitely does not contain `obj`, true if it might.
+	 *
+	 * @memberof CuckooFilter
+	 */
+	_Bool (*containsObject)(const CuckooFilter *self, const ident obj);
+
+	/**
+	 * @fn Data *CuckooFilter::data(const CuckooFilter *self)
+	 *
+	 * @return A new Data containing the serialized representation of this CuckooFilter.
+	 *
+	 * @see CuckooFilter::initWithData(CuckooFilter *, const Data *)
+	 *
+	 * @memberof CuckooFilter
+	 */
+	Data *(*data)(const CuckooFilter *self);
+
+	/**
+	 * @fn CuckooFilter *CuckooFilter::initWithCapacity(CuckooFilter *self, size_t capacity)
+	 *
+	 * @brief Initializes this CuckooFilter to hold `capacity` members.
+	 *
+	 * @param capacity The expected count of members.
+	 *
+	 * @return The initialized CuckooFilter, or `NULL` on error.
+	 *
+	 * @remarks The rate of false positives is roughly `8 / 65536` when the filter is full.
+	 *
+	 * @memberof CuckooFilter
+	 */
+	CuckooFilter *(*initWithCapacity)(CuckooFilter *self, size_t capacity);
+
+	/**
+	 * @fn CuckooFilter *CuckooFilter::initWithData(CuckooFilter *self, const Data *data)
+	 *
+	 * @brief Initializes this CuckooFilter from its serialized representation.
+	 *
+	 * @param data The Data, as returned by CuckooFilter::data.
+	 *
+	 * @return The initialized CuckooFilter, or `NULL` if `data` is not a valid CuckooFilter.
+	 *
+	 * @memberof CuckooFilter
+	 */
+	CuckooFilter *(*initWithData)(CuckooFilter *self, const Data *data);
+
+	/**
+	 * @fn void CuckooFilter::removeAllObjects(CuckooFilter *self)
+	 *
+	 * @brief Removes all members from this CuckooFilter.
+	 *
+	 * @memberof CuckooFilter
+	 */
+	void (*removeAllObjects)(CuckooFilter *self);
+
+	/**
+	 * @fn _Bool CuckooFilter::removeBytes(CuckooFilter *self, const uint8_t *bytes, size_t length)
+	 *
+	 * @brief Removes the specified bytes from this CuckooFilter.
+	 *
+	 * @param bytes The bytes, which must have been added.
+	 * @param length The count of `bytes`.
+	 *
+	 * @return True if `bytes` was removed, false if it was not found.
+	 *
+	 * @memberof CuckooFilter
+	 */
+	_Bool (*removeBytes)(CuckooFilter *self, const uint8_t *bytes, size_t length);
+
+	/**
+	 * @fn _Bool CuckooFilter::removeObject(CuckooFilter *self, const ident obj)
+	 *
+	 * @brief Removes the specified Object from this CuckooFilter.
+	 *
+	 * @param obj The Object, which must have been added.
+	 *
+	 * @return True if `obj` was removed, false if it was not found.
+	 *
+	 * @memberof CuckooFilter
+	 */
+	_Bool (*removeObject)(CuckooFilter *self, const ident obj);
+};
+
+/**
+ * @brief The CuckooFilter Class.
+ */
+extern Class _CuckooFilter;
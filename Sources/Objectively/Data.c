@@ -98,6 +98,16 @@ static _Bool isEqual(const Object *self, const Object *other) {
 	return false;
 }
 
+/**
+ * @see Object::sizeInBytes(const Object *)
+ */
+static size_t sizeInBytes(const Object *self) {
+
+	const Data *this = (Data *) self;
+
+	return super(Object, self, sizeInBytes) + this->length;
+}
+
 #pragma mark - Data
 
 /**
@@ -249,6 +259,7 @@ static void initialize(Class *clazz) {
 	object->dealloc = dealloc;
 	object->hash = hash;
 	object->isEqual = isEqual;
+	object->sizeInBytes = sizeInBytes;
 
 	DataInterface *data = (DataInterface *) clazz->interface;
 
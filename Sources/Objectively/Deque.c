@@ -0,0 +1,405 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <assert.h>
+#include <stdlib.h>
+
+#include <Objectively/Deque.h>
+#include <Objectively/Hash.h>
+#include <Objectively/MutableArray.h>
+#include <Objectively/MutableDeque.h>
+#include <Objectively/MutableString.h>
+
+#define _Class _Deque
+
+/**
+ * @return The element at `index`, counted from the first, in the ring buffer of `self`.
+ */
+static inline ident elementAtIndex(const Deque *self, size_t index) {
+	return self->elements[(self->head + index) & (self->capacity - 1)];
+}
+
+#pragma mark - Object
+
+/**
+ * @see Object::copy(const Object *)
+ */
+static Object *copy(const Object *self) {
+
+	const Deque *this = (Deque *) self;
+
+	return (Object *) alloc(Deque, initWithDeque, this);
+}
+
+/**
+ * @see Object::dealloc(Object *)
+ */
+static void dealloc(Object *self) {
+
+	Deque *this = (Deque *) self;
+
+	for (size_t i = 0; i < this->count; i++) {
+		release(elementAtIndex(this, i));
+	}
+
+	free(this->elements);
+
+	super(Object, self, dealloc);
+}
+
+/**
+ * @see Object::deepSizeInBytes(const Object *)
+ */
+static size_t deepSizeInBytes(const Object *self) {
+
+	const Deque *this = (Deque *) self;
+
+	size_t size = $(self, sizeInBytes);
+
+	for (size_t i = 0; i < this->count; i++) {
+		size += $((Object *) this->elements[(this->head + i) & (this->capacity - 1)], deepSizeInBytes);
+	}
+
+	return size;
+}
+
+/**
+ * @see Object::description(const Object *)
+ */
+static String *description(const Object *self) {
+
+	const Deque *this = (Deque *) self;
+
+	MutableString *desc = alloc(MutableString, init);
+
+	$(desc, appendCharacters, "[");
+
+	for (size_t i = 0; i < this->count; i++) {
+
+		String *string = $((Object *) elementAtIndex(this, i), description);
+		$(desc, appendString, string);
+
+		release(string);
+
+		if (i < this->count - 1) {
+			$(desc, appendCharacters, ", ");
+		}
+	}
+
+	$(desc, appendCharacters, "]");
+
+	return (String *) desc;
+}
+
+/**
+ * @see Object::hash(const Object *)
+ */
+static int hash(const Object *self) {
+
+	const Deque *this = (Deque *) self;
+
+	int hash = HashForInteger(HASH_SEED, this->count);
+
+	for (size_t i = 0; i < this->count; i++) {
+		hash = HashForObject(hash, elementAtIndex(this, i));
+	}
+
+	return hash;
+}
+
+/**
+ * @see Object::isEqual(const Object *, const Object *)
+ */
+static _Bool isEqual(const Object *self, const Object *other) {
+
+	if (super(Object, self, isEqual, other)) {
+		return true;
+	}
+
+	if (other && $(other, isKindOfClass, &_Deque)) {
+
+		const Deque *this = (Deque *) self;
+		const Deque *that = (Deque *) other;
+
+		if (this->count == that->count) {
+
+			for (size_t i = 0; i < this->count; i++) {
+
+				const Object *thisObject = elementAtIndex(this, i);
+				const Object *thatObject = elementAtIndex(that, i);
+
+				if ($(thisObject, isEqual, thatObject) == false) {
+					return false;
+				}
+			}
+
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/**
+ * @see Object::sizeInBytes(const Object *)
+ */
+static size_t sizeInBytes(const Object *self) {
+
+	const Deque *this = (Deque *) self;
+
+	return super(Object, self, sizeInBytes) + this->capacity * sizeof(ident);
+}
+
+#pragma mark - Deque
+
+/**
+ * @fn Array *Deque::allObjects(const Deque *self)
+ *
+ * @memberof Deque
+ */
+static Array *allObjects(const Deque *self) {
+
+	MutableArray *array = alloc(MutableArray, initWithCapacity, self->count);
+	if (array) {
+
+		for (size_t i = 0; i < self->count; i++) {
+			$(array, addObject, elementAtIndex(self, i));
+		}
+	}
+
+	return (Array *) array;
+}
+
+/**
+ * @fn _Bool Deque::containsObject(const Deque *self, const ident obj)
+ *
+ * @memberof Deque
+ */
+static _Bool containsObject(const Deque *self, const ident obj) {
+
+	return $(self, indexOfObject, obj) != -1;
+}
+
+/**
+ * @fn Deque *Deque::dequeWithArray(const Array *array)
+ *
+ * @memberof Deque
+ */
+static Deque *dequeWithArray(const Array *array) {
+
+	return alloc(Deque, initWithArray, array);
+}
+
+/**
+ * @fn void Deque::enumerateObjects(const Deque *self, DequeEnumerator enumerator, ident data)
+ *
+ * @memberof Deque
+ */
+static void enumerateObjects(const Deque *self, DequeEnumerator enumerator, ident data) {
+
+	assert(enumerator);
+
+	for (size_t i = 0; i < self->count; i++) {
+		if (enumerator(self, elementAtIndex(self, i), data)) {
+			return;
+		}
+	}
+}
+
+/**
+ * @fn ident Deque::firstObject(const Deque *self)
+ *
+ * @memberof Deque
+ */
+static ident firstObject(const Deque *self) {
+
+	return self->count ? elementAtIndex(self, 0) : NULL;
+}
+
+/**
+ * @fn int Deque::indexOfObject(const Deque *self, const ident obj)
+ *
+ * @memberof Deque
+ */
+static int indexOfObject(const Deque *self, const ident obj) {
+
+	Object *object = cast(Object, obj);
+
+	assert(object);
+
+	for (size_t i = 0; i < self->count; i++) {
+
+		const ident element = elementAtIndex(self, i);
+		if (element == obj || $(object, isEqual, (Object *) element)) {
+			return (int) i;
+		}
+	}
+
+	return -1;
+}
+
+/**
+ * @brief Allocates the ring buffer of `self` to hold at least `count` elements.
+ */
+static void allocateElements(Deque *self, size_t count) {
+
+	self->capacity = 1;
+	while (self->capacity < count) {
+		self->capacity <<= 1;
+	}
+
+	self->elements = calloc(self->capacity, sizeof(ident));
+	assert(self->elements);
+}
+
+/**
+ * @fn Deque *Deque::initWithArray(Deque *self, const Array *array)
+ *
+ * @memberof Deque
+ */
+static Deque *initWithArray(Deque *self, const Array *array) {
+
+	assert(array);
+
+	self = (Deque *) super(Object, self, init);
+	if (self) {
+
+		allocateElements(self, array->count);
+
+		for (size_t i = 0; i < array->count; i++) {
+			self->elements[i] = retain(array->elements[i]);
+		}
+
+		self->count = array->count;
+	}
+
+	return self;
+}
+
+/**
+ * @fn Deque *Deque::initWithDeque(Deque *self, const Deque *deque)
+ *
+ * @memberof Deque
+ */
+static Deque *initWithDeque(Deque *self, const Deque *deque) {
+
+	assert(deque);
+
+	self = (Deque *) super(Object, self, init);
+	if (self) {
+
+		allocateElements(self, deque->count);
+
+		for (size_t i = 0; i < deque->count; i++) {
+			self->elements[i] = retain(elementAtIndex(deque, i));
+		}
+
+		self->count = deque->count;
+	}
+
+	return self;
+}
+
+/**
+ * @fn ident Deque::lastObject(const Deque *self)
+ *
+ * @memberof Deque
+ */
+static ident lastObject(const Deque *self) {
+
+	return self->count ? elementAtIndex(self, self->count - 1) : NULL;
+}
+
+/**
+ * @fn MutableDeque *Deque::mutableCopy(const Deque *self)
+ *
+ * @memberof Deque
+ */
+static MutableDeque *mutableCopy(const Deque *self) {
+
+	MutableDeque *copy = alloc(MutableDeque, initWithCapacity, self->count);
+	if (copy) {
+
+		for (size_t i = 0; i < self->count; i++) {
+			$(copy, pushLastObject, elementAtIndex(self, i));
+		}
+	}
+
+	return copy;
+}
+
+/**
+ * @fn ident Deque::objectAtIndex(const Deque *self, int index)
+ *
+ * @memberof Deque
+ */
+static ident objectAtIndex(const Deque *self, int index) {
+
+	assert(index > -1);
+	assert(index < self->count);
+
+	return elementAtIndex(self, index);
+}
+
+#pragma mark - Class lifecycle
+
+/**
+ * @see Class::initialize(Class *)
+ */
+static void initialize(Class *clazz) {
+
+	ObjectInterface *object = (ObjectInterface *) clazz->interface;
+
+	object->copy = copy;
+	object->dealloc = dealloc;
+	object->deepSizeInBytes = deepSizeInBytes;
+	object->description = description;
+	object->hash = hash;
+	object->isEqual = isEqual;
+	object->sizeInBytes = sizeInBytes;
+
+	DequeInterface *deque = (DequeInterface *) clazz->interface;
+
+	deque->allObjects = allObjects;
+	deque->containsObject = containsObject;
+	deque->dequeWithArray = dequeWithArray;
+	deque->enumerateObjects = enumerateObjects;
+	deque->firstObject = firstObject;
+	deque->indexOfObject = indexOfObject;
+	deque->initWithArray = initWithArray;
+	deque->initWithDeque = initWithDeque;
+	deque->lastObject = lastObject;
+	deque->mutableCopy = mutableCopy;
+	deque->objectAtIndex = objectAtIndex;
+}
+
+Class _Deque = {
+	.name = "Deque",
+	.superclass = &_Object,
+	.instanceSize = sizeof(Deque),
+	.interfaceOffset = offsetof(Deque, interface),
+	.interfaceSize = sizeof(DequeInterface),
+	.initialize = initialize,
+};
+
+#undef _Class
@@ -0,0 +1,241 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#pragma once
+
+#include <Objectively/Array.h>
+
+/**
+ * @file
+ *
+ * @brief Immutable double-ended queues.
+ */
+
+typedef struct Deque Deque;
+typedef struct DequeInterface DequeInterface;
+
+/**
+ * @brief A function pointer for Deque enumeration (iteration).
+ *
+ * @param deque The Deque.
+ * @param obj The Object for the current iteration.
+ * @param data User data.
+ *
+ * @return True to stop enumeration, false to continue.
+ */
+typedef _Bool (*DequeEnumerator)(const Deque *deque, ident obj, ident data);
+
+/**
+ * @brief Immutable double-ended queues.
+ *
+ * @details Deques store their elements in a power-of-two ring buffer, so that MutableDeque may
+ * add and remove elements at either end in constant time.
+ *
+ * @extends Object
+ *
+ * @ingroup Collections
+ */
+struct Deque {
+
+	/**
+	 * @brief The parent.
+	 *
+	 * @private
+	 */
+	Object object;
+
+	/**
+	 * @brief The typed interface.
+	 *
+	 * @private
+	 */
+	DequeInterface *interface;
+
+	/**
+	 * @brief The count of elements.
+	 */
+	size_t count;
+
+	/**
+	 * @brief The ring buffer capacity, a power of two.
+	 *
+	 * @private
+	 */
+	size_t capacity;
+
+	/**
+	 * @brief The index of the first element in the ring buffer.
+	 *
+	 * @private
+	 */
+	size_t head;
+
+	/**
+	 * @brief The ring buffer.
+	 *
+	 * @private
+	 */
+	ident *elements;
+};
+
+typedef struct MutableDeque MutableDeque;
+
+/**
+ * @brief The Deque interface.
+ */
+struct DequeInterface {
+
+	/**
+	 * @brief The parent interface.
+	 */
+	ObjectInterface objectInterface;
+
+	/**
+	 * @fn Array *Deque::allObjects(const Deque *self)
+	 *
+	 * @return An Array containing the elements of this Deque, from first to last.
+	 *
+	 * @memberof Deque
+	 */
+	Array *(*allObjects)(const Deque *self);
+
+	/**
+	 * @fn _Bool Deque::containsObject(const Deque *self, const ident obj)
+	 *
+	 * @param obj An Object.
+	 *
+	 * @return True if this Deque contains the given Object, false otherwise.
+	 *
+	 * @memberof Deque
+	 */
+	_Bool (*containsObject)(const Deque *self, const ident obj);
+
+	/**
+	 * @static
+	 *
+	 * @fn Deque *Deque::dequeWithArray(const Array *array)
+	 *
+	 * @brief Returns a new Deque containing the contents of `array`.
+	 *
+	 * @param array An Array.
+	 *
+	 * @return The new Deque, or `NULL` on error.
+	 *
+	 * @memberof Deque
+	 */
+	Deque *(*dequeWithArray)(const Array *array);
+
+	/**
+	 * @fn void Deque::enumerateObjects(const Deque *self, DequeEnumerator enumerator, ident data)
+	 *
+	 * @brief Enumerate the elements of this Deque, from first to last.
+	 *
+	 * @param enumerator The enumerator function.
+	 * @param data User data.
+	 *
+	 * @remarks The enumerator should return `true` to break the iteration.
+	 *
+	 * @memberof Deque
+	 */
+	void (*enumerateObjects)(const Deque *self, DequeEnumerator enumerator, ident data);
+
+	/**
+	 * @fn ident Deque::firstObject(const Deque *self)
+	 *
+	 * @return The first element of this Deque, or `NULL` if this Deque is empty.
+	 *
+	 * @memberof Deque
+	 */
+	ident (*firstObject)(const Deque *self);
+
+	/**
+	 * @fn int Deque::indexOfObject(const Deque *self, const ident obj)
+	 *
+	 * @param obj An Object.
+	 *
+	 * @return The index of the given Object, or `-1` if not found.
+	 *
+	 * @memberof Deque
+	 */
+	int (*indexOfObject)(const Deque *self, const ident obj);
+
+	/**
+	 * @fn Deque *Deque::initWithArray(Deque *self, const Array *array)
+	 *
+	 * @brief Initializes this Deque to contain the Objects in `array`.
+	 *
+	 * @param array An Array.
+	 *
+	 * @return The initialized Deque, or `NULL` on error.
+	 *
+	 * @memberof Deque
+	 */
+	Deque *(*initWithArray)(Deque *self, const Array *array);
+
+	/**
+	 * @fn Deque *Deque::initWithDeque(Deque *self, const Deque *deque)
+	 *
+	 * @brief Initializes this Deque to contain the Objects in `deque`.
+	 *
+	 * @param deque A Deque.
+	 *
+	 * @return The initialized Deque, or `NULL` on error.
+	 *
+	 * @memberof Deque
+	 */
+	Deque *(*initWithDeque)(Deque *self, const Deque *deque);
+
+	/**
+	 * @fn ident Deque::lastObject(const Deque *self)
+	 *
+	 * @return The last element of this Deque, or `NULL` if this Deque is empty.
+	 *
+	 * @memberof Deque
+	 */
+	ident (*lastObject)(const Deque *self);
+
+	/**
+	 * @fn MutableDeque *Deque::mutableCopy(const Deque *self)
+	 *
+	 * @return A MutableDeque with the contents of this Deque.
+	 *
+	 * @memberof Deque
+	 */
+	MutableDeque *(*mutableCopy)(const Deque *self);
+
+	/**
+	 * @fn ident Deque::objectAtIndex(const Deque *self, int index)
+	 *
+	 * @param index The index of the desired Object, counted from the first.
+	 *
+	 * @return The Object at the specified index.
+	 *
+	 * @memberof Deque
+	 */
+	ident (*objectAtIndex)(const Deque *self, int index);
+};
+
+/**
+ * @brief The Deque Class.
+ */
+extern Class _Deque;
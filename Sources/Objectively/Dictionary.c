@@ -30,6 +30,7 @@
 #include <Objectively/MutableArray.h>
 #include <Objectively/MutableDictionary.h>
 #include <Objectively/MutableString.h>
+#include <Objectively/Parallel.h>
 
 #define _Class _Dictionary
 
@@ -60,9 +61,30 @@ static void dealloc(Object *self) {
 
 	free(this->elements);
 
+	for (size_t i = 0; i < lengthof(this->pairs); i++) {
+		release(this->pairs[i]);
+	}
+
 	super(Object, self, dealloc);
 }
 
+/**
+ * @see Object::deepSizeInBytes(const Object *)
+ */
+static size_t deepSizeInBytes(const Object *self) {
+
+	const Dictionary *this = (Dictionary *) self;
+
+	size_t size = $(self, sizeInBytes);
+
+	const Object *key, *obj;
+	DictionaryForEach(key, obj, this) {
+		size += $(key, deepSizeInBytes) + $(obj, deepSizeInBytes);
+	}
+
+	return size;
+}
+
 /**
  * @brief A DictionaryEnumerator for description.
  */
@@ -101,20 +123,22 @@ static String *description(const Object *self) {
 
 /**
  * @see Object::hash(const Object *)
+ *
+ * @remarks The pairs are combined without regard to order, as their order depends on how the
+ * Dictionary was populated.
  */
 static int hash(const Object *self) {
 
 	const Dictionary *this = (Dictionary *) self;
 
-	int hash = HashForInteger(HASH_SEED, this->count);
+	unsigned int pairs = 0;
 
-	for (size_t i = 0; i < this->capacity; i++) {
-		if (this->elements[i]) {
-			hash = HashForObject(hash, this->elements[i]);
-		}
+	ident key, obj;
+	DictionaryForEach(key, obj, this) {
+		pairs += HashForObject(HashForObject(HASH_SEED, key), obj);
 	}
 
-	return hash;
+	return HashForInteger(HashForInteger(HASH_SEED, this->count), pairs);
 }
 
 /**
@@ -133,21 +157,18 @@ static _Bool isEqual(const Object *self, const Object *other) {
 
 		if (this->count == that->count) {
 
-			Array *keys = $(this, allKeys);
+			ident key;
+			const Object *thisObject;
 
-			for (size_t i = 0; i < keys->count; i++) {
-				const ident key = $(keys, objectAtIndex, i);
+			DictionaryForEach(key, thisObject, this) {
 
-				const Object *thisObject = $(this, objectForKey, key);
 				const Object *thatObject = $(that, objectForKey, key);
 
 				if ($(thisObject, isEqual, thatObject) == false) {
-					release(keys);
 					return false;
 				}
 			}
 
-			release(keys);
 			return true;
 		}
 	}
@@ -155,6 +176,24 @@ static _Bool isEqual(const Object *self, const Object *other) {
 	return false;
 }
 
+/**
+ * @see Object::sizeInBytes(const Object *)
+ */
+static size_t sizeInBytes(const Object *self) {
+
+	const Dictionary *this = (Dictionary *) self;
+
+	size_t size = super(Object, self, sizeInBytes) + this->capacity * sizeof(ident);
+
+	for (size_t i = 0; i < this->capacity; i++) {
+		if (this->elements[i]) {
+			size += $((Object *) this->elements[i], sizeInBytes);
+		}
+	}
+
+	return size;
+}
+
 #pragma mark - Dictionary
 
 /**
@@ -236,6 +275,54 @@ static Dictionary *dictionaryWithObjectsAndKeys(ident obj, ...) {
 	return dict;
 }
 
+/**
+ * @return The inline slot of `key` in `dict`, the first vacant slot in its probe sequence if
+ * `dict` does not contain `key`, or `DICTIONARY_INLINE_CAPACITY` if neither exists.
+ */
+static size_t inlineSlotForKey(const Dictionary *dict, const ident key) {
+
+	size_t slot = (size_t) HashForObject(HASH_SEED, key) % DICTIONARY_INLINE_CAPACITY;
+
+	for (size_t i = 0; i < DICTIONARY_INLINE_CAPACITY; i++) {
+
+		const ident k = dict->pairs[slot << 1];
+		if (k == NULL || k == key || $((Object *) k, isEqual, key)) {
+			return slot;
+		}
+
+		slot = (slot + 1) % DICTIONARY_INLINE_CAPACITY;
+	}
+
+	return DICTIONARY_INLINE_CAPACITY;
+}
+
+/**
+ * @return The count of table slots of `dict`: its bins, or its inline pairs.
+ */
+static size_t slotCount(const Dictionary *dict) {
+	return dict->elements ? dict->capacity : DICTIONARY_INLINE_CAPACITY;
+}
+
+/**
+ * @return The count of keys and objects, interleaved in `pairs`, in table slot `slot` of `dict`.
+ */
+static size_t pairsInSlot(const Dictionary *dict, size_t slot, ident **pairs) {
+
+	if (dict->elements) {
+
+		const Array *array = dict->elements[slot];
+		if (array) {
+			*pairs = array->elements;
+			return array->count;
+		}
+
+		return 0;
+	}
+
+	*pairs = (ident *) dict->pairs + (slot << 1);
+	return **pairs ? 2 : 0;
+}
+
 /**
  * @fn void Dictionary::enumerateObjectsAndKeys(const Dictionary *self, DictionaryEnumerator enumerator, ident data)
  *
@@ -246,53 +333,191 @@ static void enumerateObjectsAndKeys(const Dictionary *self, DictionaryEnumerator
 
 	assert(enumerator);
 
-	for (size_t i = 0; i < self->capacity; i++) {
+	ident key, obj;
+	DictionaryForEach(key, obj, self) {
+		if (enumerator(self, obj, key, data)) {
+			return;
+		}
+	}
+}
 
-		Array *array = self->elements[i];
-		if (array) {
+/**
+ * @brief The context of Dictionary::enumerateObjectsConcurrently.
+ */
+typedef struct {
+	const Dictionary *dictionary;
+	DictionaryEnumerator enumerator;
+	ident data;
+	volatile _Bool stop;
+} EnumerateConcurrently;
 
-			for (size_t j = 0; j < array->count; j += 2) {
+/**
+ * @brief ParallelFunction for enumerateObjectsConcurrently.
+ */
+static void enumerateObjectsConcurrently_parallel(size_t chunk, size_t begin, size_t end, ident data) {
 
-				ident key = $(array, objectAtIndex, j);
-				ident obj = $(array, objectAtIndex, j + 1);
+	EnumerateConcurrently *context = data;
 
-				if (enumerator(self, obj, key, data)) {
-					return;
-				}
+	for (size_t i = begin; i < end && context->stop == false; i++) {
+
+		ident *pairs;
+		const size_t count = pairsInSlot(context->dictionary, i, &pairs);
+
+		for (size_t j = 0; j < count && context->stop == false; j += 2) {
+			if (context->enumerator(context->dictionary, pairs[j + 1], pairs[j], context->data)) {
+				context->stop = true;
 			}
 		}
 	}
 }
 
 /**
- * @fn void Dictionary::filterObjectsAndKeys(const Dictionary *self, DictionaryEnumerator enumerator, ident data)
+ * @fn void Dictionary::enumerateObjectsConcurrently(const Dictionary *self, DictionaryEnumerator enumerator, ident data, size_t chunkSize)
  *
  * @memberof Dictionary
  */
-static Dictionary *filterObjectsAndKeys(const Dictionary *self, DictionaryEnumerator enumerator,
-		ident data) {
+static void enumerateObjectsConcurrently(const Dictionary *self, DictionaryEnumerator enumerator,
+		ident data, size_t chunkSize) {
 
 	assert(enumerator);
 
-	MutableDictionary *dictionary = alloc(MutableDictionary, init);
+	EnumerateConcurrently context = {
+		.dictionary = self,
+		.enumerator = enumerator,
+		.data = data
+	};
+
+	ParallelFor(slotCount(self), chunkSize, enumerateObjectsConcurrently_parallel, &context);
+}
+
+/**
+ * @brief Allocates an empty Dictionary with the same table size as `dictionary`, so that its
+ * slots may be populated independently, and concurrently.
+ */
+static Dictionary *allocWithTableOf(const Dictionary *dictionary) {
+
+	Dictionary *self = (Dictionary *) super(Object, _alloc(&_Dictionary), init);
+	if (self) {
 
-	for (size_t i = 0; i < self->capacity; i++) {
+		self->capacity = dictionary->capacity;
 
-		Array *array = self->elements[i];
+		if (self->capacity) {
+			self->elements = calloc(self->capacity, sizeof(ident));
+			assert(self->elements);
+		}
+	}
+
+	return self;
+}
+
+/**
+ * @brief The context of Dictionary::filterConcurrently and Dictionary::mapConcurrently.
+ */
+typedef struct {
+	const Dictionary *dictionary;
+	Dictionary *result;
+	DictionaryEnumerator enumerator;
+	Functor functor;
+	ident data;
+} TransformConcurrently;
+
+/**
+ * @brief ParallelFunction for filterConcurrently.
+ */
+static void filterConcurrently_parallel(size_t chunk, size_t begin, size_t end, ident data) {
+
+	TransformConcurrently *context = data;
+
+	size_t count = 0;
+
+	for (size_t i = begin; i < end; i++) {
+
+		const Array *array = context->dictionary->elements[i];
 		if (array) {
 
+			MutableArray *pairs = NULL;
+
 			for (size_t j = 0; j < array->count; j += 2) {
 
-				ident key = $(array, objectAtIndex, j);
-				ident obj = $(array, objectAtIndex, j + 1);
+				ident key = array->elements[j];
+				ident obj = array->elements[j + 1];
+
+				if (context->enumerator(context->dictionary, obj, key, context->data)) {
+
+					if (pairs == NULL) {
+						pairs = alloc(MutableArray, initWithCapacity, array->count);
+					}
+
+					$(pairs, addObject, key);
+					$(pairs, addObject, obj);
+
+					count++;
+				}
+			}
+
+			context->result->elements[i] = pairs;
+		}
+	}
+
+	__sync_fetch_and_add(&context->result->count, count);
+}
+
+/**
+ * @fn Dictionary *Dictionary::filterConcurrently(const Dictionary *self, DictionaryEnumerator enumerator, ident data, size_t chunkSize)
+ *
+ * @memberof Dictionary
+ */
+static Dictionary *filterConcurrently(const Dictionary *self, DictionaryEnumerator enumerator,
+		ident data, size_t chunkSize) {
+
+	assert(enumerator);
+
+	Dictionary *dictionary = allocWithTableOf(self);
+	if (dictionary) {
+
+		if (self->elements) {
 
+			TransformConcurrently context = {
+				.dictionary = self,
+				.result = dictionary,
+				.enumerator = enumerator,
+				.data = data
+			};
+
+			ParallelFor(self->capacity, chunkSize, filterConcurrently_parallel, &context);
+		} else {
+
+			ident key, obj;
+			DictionaryForEach(key, obj, self) {
 				if (enumerator(self, obj, key, data)) {
-					$(dictionary, setObjectForKey, obj, key);
+					$$(MutableDictionary, setObjectForKey, (MutableDictionary *) dictionary, obj, key);
 				}
 			}
 		}
 	}
 
+	return dictionary;
+}
+
+/**
+ * @fn void Dictionary::filterObjectsAndKeys(const Dictionary *self, DictionaryEnumerator enumerator, ident data)
+ *
+ * @memberof Dictionary
+ */
+static Dictionary *filterObjectsAndKeys(const Dictionary *self, DictionaryEnumerator enumerator,
+		ident data) {
+
+	assert(enumerator);
+
+	MutableDictionary *dictionary = alloc(MutableDictionary, init);
+
+	ident key, obj;
+	DictionaryForEach(key, obj, self) {
+		if (enumerator(self, obj, key, data)) {
+			$(dictionary, setObjectForKey, obj, key);
+		}
+	}
+
 	return (Dictionary *) dictionary;
 }
 
@@ -309,14 +534,24 @@ static Dictionary *initWithDictionary(Dictionary *self, const Dictionary *dictio
 
 			self->capacity = dictionary->capacity;
 
-			self->elements = calloc(self->capacity, sizeof(ident));
-			assert(self->elements);
+			if (self->capacity) {
 
-			for (size_t i = 0; i < dictionary->capacity; i++) {
+				self->elements = calloc(self->capacity, sizeof(ident));
+				assert(self->elements);
 
-				Array *array = dictionary->elements[i];
-				if (array) {
-					self->elements[i] = $((Object *) array, copy);
+				for (size_t i = 0; i < dictionary->capacity; i++) {
+
+					Array *array = dictionary->elements[i];
+					if (array) {
+						self->elements[i] = $((Object *) array, copy);
+					}
+				}
+			} else {
+
+				for (size_t i = 0; i < lengthof(self->pairs); i++) {
+					if (dictionary->pairs[i]) {
+						self->pairs[i] = retain(dictionary->pairs[i]);
+					}
 				}
 			}
 
@@ -358,6 +593,74 @@ static Dictionary *initWithObjectsAndKeys(Dictionary *self, ...) {
 	return self;
 }
 
+/**
+ * @brief ParallelFunction for mapConcurrently.
+ */
+static void mapConcurrently_parallel(size_t chunk, size_t begin, size_t end, ident data) {
+
+	TransformConcurrently *context = data;
+
+	for (size_t i = begin; i < end; i++) {
+
+		const Array *array = context->dictionary->elements[i];
+		if (array) {
+
+			MutableArray *pairs = alloc(MutableArray, initWithCapacity, array->count);
+
+			for (size_t j = 0; j < array->count; j += 2) {
+
+				ident key = array->elements[j];
+				ident obj = context->functor(array->elements[j + 1], context->data);
+
+				$(pairs, addObject, key);
+				$(pairs, addObject, obj);
+
+				release(obj);
+			}
+
+			context->result->elements[i] = pairs;
+		}
+	}
+}
+
+/**
+ * @fn Dictionary *Dictionary::mapConcurrently(const Dictionary *self, Functor functor, ident data, size_t chunkSize)
+ *
+ * @memberof Dictionary
+ */
+static Dictionary *mapConcurrently(const Dictionary *self, Functor functor, ident data, size_t chunkSize) {
+
+	assert(functor);
+
+	Dictionary *dictionary = allocWithTableOf(self);
+	if (dictionary) {
+
+		if (self->elements) {
+
+			TransformConcurrently context = {
+				.dictionary = self,
+				.result = dictionary,
+				.functor = functor,
+				.data = data
+			};
+
+			ParallelFor(self->capacity, chunkSize, mapConcurrently_parallel, &context);
+		} else {
+
+			for (size_t i = 0; i < lengthof(self->pairs); i += 2) {
+				if (self->pairs[i]) {
+					dictionary->pairs[i] = retain(self->pairs[i]);
+					dictionary->pairs[i + 1] = functor(self->pairs[i + 1], data);
+				}
+			}
+		}
+
+		dictionary->count = self->count;
+	}
+
+	return dictionary;
+}
+
 /**
  * @fn MutableDictionary *Dictionary::mutableCopy(const Dictionary *self)
  *
@@ -380,6 +683,16 @@ static MutableDictionary *mutableCopy(const Dictionary *self) {
  */
 static ident objectForKey(const Dictionary *self, const ident key) {
 
+	if (self->elements == NULL) {
+
+		const size_t slot = inlineSlotForKey(self, key);
+		if (slot < DICTIONARY_INLINE_CAPACITY) {
+			return self->pairs[(slot << 1) + 1];
+		}
+
+		return NULL;
+	}
+
 	const size_t bin = HashForObject(HASH_SEED, key) % self->capacity;
 
 	Array *array = self->elements[bin];
@@ -394,6 +707,86 @@ static ident objectForKey(const Dictionary *self, const ident key) {
 	return NULL;
 }
 
+/**
+ * @brief The context of Dictionary::reduceConcurrently.
+ */
+typedef struct {
+	const Dictionary *dictionary;
+	Reducer reducer;
+	ident data;
+	ident *results;
+} ReduceConcurrently;
+
+/**
+ * @brief ParallelFunction for reduceConcurrently.
+ */
+static void reduceConcurrently_parallel(size_t chunk, size_t begin, size_t end, ident data) {
+
+	ReduceConcurrently *context = data;
+
+	ident accumulator = NULL;
+
+	for (size_t i = begin; i < end; i++) {
+
+		ident *pairs;
+		const size_t count = pairsInSlot(context->dictionary, i, &pairs);
+
+		for (size_t j = 0; j < count; j += 2) {
+			accumulator = ParallelFold(context->reducer, pairs[j + 1], accumulator, context->data);
+		}
+	}
+
+	context->results[chunk] = accumulator;
+}
+
+/**
+ * @fn ident Dictionary::reduceConcurrently(const Dictionary *self, Reducer reducer, Reducer combiner, ident data, size_t chunkSize)
+ *
+ * @memberof Dictionary
+ */
+static ident reduceConcurrently(const Dictionary *self, Reducer reducer, Reducer combiner,
+		ident data, size_t chunkSize) {
+
+	assert(reducer);
+
+	if (self->count == 0) {
+		return NULL;
+	}
+
+	const size_t slots = slotCount(self);
+
+	chunkSize = ParallelChunkSize(slots, chunkSize);
+	const size_t chunks = (slots + chunkSize - 1) / chunkSize;
+
+	ReduceConcurrently context = {
+		.dictionary = self,
+		.reducer = reducer,
+		.data = data,
+		.results = calloc(chunks, sizeof(ident))
+	};
+
+	assert(context.results);
+
+	ParallelFor(slots, chunkSize, reduceConcurrently_parallel, &context);
+
+	ident accumulator = NULL;
+
+	for (size_t i = 0; i < chunks; i++) {
+		if (context.results[i]) {
+			if (accumulator) {
+				accumulator = ParallelFold(combiner ?: reducer, context.results[i], accumulator, data);
+				release(context.results[i]);
+			} else {
+				accumulator = context.results[i];
+			}
+		}
+	}
+
+	free(context.results);
+
+	return accumulator;
+}
+
 /**
  * @fn ident Dictionary::objectForKeyPath(const Dictionary *self, const char *path)
  *
@@ -423,9 +816,11 @@ static void initialize(Class *clazz) {
 
 	object->copy = copy;
 	object->dealloc = dealloc;
+	object->deepSizeInBytes = deepSizeInBytes;
 	object->description = description;
 	object->hash = hash;
 	object->isEqual = isEqual;
+	object->sizeInBytes = sizeInBytes;
 
 	DictionaryInterface *dictionary = (DictionaryInterface *) clazz->interface;
 
@@ -434,12 +829,16 @@ static void initialize(Class *clazz) {
 	dictionary->dictionaryWithDictionary = dictionaryWithDictionary;
 	dictionary->dictionaryWithObjectsAndKeys = dictionaryWithObjectsAndKeys;
 	dictionary->enumerateObjectsAndKeys = enumerateObjectsAndKeys;
+	dictionary->enumerateObjectsConcurrently = enumerateObjectsConcurrently;
+	dictionary->filterConcurrently = filterConcurrently;
 	dictionary->filterObjectsAndKeys = filterObjectsAndKeys;
 	dictionary->initWithDictionary = initWithDictionary;
 	dictionary->initWithObjectsAndKeys = initWithObjectsAndKeys;
+	dictionary->mapConcurrently = mapConcurrently;
 	dictionary->mutableCopy = mutableCopy;
 	dictionary->objectForKey = objectForKey;
 	dictionary->objectForKeyPath = objectForKeyPath;
+	dictionary->reduceConcurrently = reduceConcurrently;
 }
 
 Class _Dictionary = {
@@ -32,6 +32,11 @@
  * @brief Immutable key-value stores.
  */
 
+/**
+ * @brief The count of pairs a Dictionary stores inline, before allocating its hash table.
+ */
+#define DICTIONARY_INLINE_CAPACITY 8
+
 typedef struct Dictionary Dictionary;
 typedef struct DictionaryInterface DictionaryInterface;
 
@@ -71,7 +76,7 @@ struct Dictionary {
 	DictionaryInterface *interface;
 
 	/**
-	 * @brief The internal size (number of bins).
+	 * @brief The internal size (number of bins), or `0` while the pairs are stored inline.
 	 *
 	 * @private
 	 */
@@ -83,11 +88,19 @@ struct Dictionary {
 	size_t count;
 
 	/**
-	 * @brief The elements.
+	 * @brief The elements, or `NULL` while the pairs are stored inline.
 	 *
 	 * @private
 	 */
 	ident *elements;
+
+	/**
+	 * @brief The keys and objects of up to `DICTIONARY_INLINE_CAPACITY` pairs, linearly probed
+	 * by key.
+	 *
+	 * @private
+	 */
+	ident pairs[DICTIONARY_INLINE_CAPACITY * 2];
 };
 
 typedef struct MutableDictionary MutableDictionary;
@@ -164,6 +177,37 @@ struct DictionaryInterface {
 	 */
 	void (*enumerateObjectsAndKeys)(const Dictionary *self, DictionaryEnumerator enumerator, ident data);
 
+	/**
+	 * @fn void Dictionary::enumerateObjectsConcurrently(const Dictionary *self, DictionaryEnumerator enumerator, ident data, size_t chunkSize)
+	 *
+	 * @brief Enumerate the pairs of this Dictionary concurrently, in chunks of table slots.
+	 *
+	 * @param enumerator The enumerator function, which must be thread safe.
+	 * @param data User data.
+	 * @param chunkSize The count of table slots per chunk, or `0` to choose one automatically.
+	 *
+	 * @remarks The enumerator may return `true` to stop the enumeration as soon as possible.
+	 * The calling thread participates, and returns once every chunk has completed.
+	 *
+	 * @memberof Dictionary
+	 */
+	void (*enumerateObjectsConcurrently)(const Dictionary *self, DictionaryEnumerator enumerator, ident data, size_t chunkSize);
+
+	/**
+	 * @fn Dictionary *Dictionary::filterConcurrently(const Dictionary *self, DictionaryEnumerator enumerator, ident data, size_t chunkSize)
+	 *
+	 * @brief Creates a new Dictionary with pairs that pass `enumerator`, evaluated concurrently.
+	 *
+	 * @param enumerator The enumerator function, which must be thread safe.
+	 * @param data User data.
+	 * @param chunkSize The count of table slots per chunk, or `0` to choose one automatically.
+	 *
+	 * @return The new, filtered Dictionary.
+	 *
+	 * @memberof Dictionary
+	 */
+	Dictionary *(*filterConcurrently)(const Dictionary *self, DictionaryEnumerator enumerator, ident data, size_t chunkSize);
+
 	/**
 	 * @fn void Dictionary::filterObjectsAndKeys(const Dictionary *self, DictionaryEnumerator enumerator, ident data)
 	 *
@@ -203,6 +247,22 @@ struct DictionaryInterface {
 	 */
 	Dictionary *(*initWithObjectsAndKeys)(Dictionary *self, ...);
 
+	/**
+	 * @fn Dictionary *Dictionary::mapConcurrently(const Dictionary *self, Functor functor, ident data, size_t chunkSize)
+	 *
+	 * @brief Creates a new Dictionary with the same keys, and the results of `functor` applied
+	 * to each object.
+	 *
+	 * @param functor The Functor, which must be thread safe.
+	 * @param data User data.
+	 * @param chunkSize The count of table slots per chunk, or `0` to choose one automatically.
+	 *
+	 * @return The new, mapped Dictionary.
+	 *
+	 * @memberof Dictionary
+	 */
+	Dictionary *(*mapConcurrently)(const Dictionary *self, Functor functor, ident data, size_t chunkSize);
+
 	/**
 	 * @fn MutableDictionary *Dictionary::mutableCopy(const Dictionary *self)
 	 *
@@ -233,9 +293,120 @@ struct DictionaryInterface {
 	 * @memberof Dictionary
 	 */
 	ident (*objectForKeyPath)(const Dictionary *self, const char *path);
+
+	/**
+	 * @fn ident Dictionary::reduceConcurrently(const Dictionary *self, Reducer reducer, Reducer combiner, ident data, size_t chunkSize)
+	 *
+	 * @brief Reduces the objects of this Dictionary concurrently, in chunks of table slots.
+	 *
+	 * @param reducer The Reducer applied to the objects of each chunk, which must be thread safe.
+	 * @param combiner The Reducer applied to the results of the chunks, in order, or `NULL` to
+	 * use `reducer`.
+	 * @param data User data.
+	 * @param chunkSize The count of table slots per chunk, or `0` to choose one automatically.
+	 *
+	 * @return The accumulated result, which the caller must release, or `NULL` if this
+	 * Dictionary is empty.
+	 *
+	 * @memberof Dictionary
+	 */
+	ident (*reduceConcurrently)(const Dictionary *self, Reducer reducer, Reducer combiner, ident data, size_t chunkSize);
 };
 
 /**
  * @brief The Dictionary Class.
  */
 extern Class _Dictionary;
+
+/**
+ * @brief A stack-allocated cursor over the keys and objects of a Dictionary.
+ *
+ * @remarks Iterators do not retain the Dictionary, and must not outlive it. The Dictionary
+ * must not be modified while it is being iterated.
+ */
+typedef struct {
+
+	/**
+	 * @brief The Dictionary.
+	 */
+	const Dictionary *dictionary;
+
+	/**
+	 * @brief The current bin, or inline pair.
+	 */
+	size_t bin;
+
+	/**
+	 * @brief The index of the next key within the current bin.
+	 */
+	size_t index;
+} DictionaryIterator;
+
+/**
+ * @return A DictionaryIterator positioned before the first key of `dictionary`.
+ */
+static inline DictionaryIterator MakeDictionaryIterator(const Dictionary *dictionary) {
+	return (DictionaryIterator) { .dictionary = dictionary, .bin = 0, .index = 0 };
+}
+
+/**
+ * @brief Advances `iterator` to the next key and object.
+ *
+ * @param iterator The DictionaryIterator.
+ * @param key Receives the next key, if not `NULL`.
+ * @param obj Receives the next object, if not `NULL`.
+ *
+ * @return True if a pair was available, false if `iterator` is exhausted.
+ */
+static inline _Bool DictionaryIteratorNext(DictionaryIterator *iterator, ident *key, ident *obj) {
+
+	const Dictionary *dictionary = iterator->dictionary;
+
+	if (dictionary->elements == NULL) {
+
+		for (; iterator->bin < DICTIONARY_INLINE_CAPACITY; iterator->bin++) {
+
+			const ident *pair = dictionary->pairs + (iterator->bin << 1);
+			if (pair[0]) {
+
+				if (key) {
+					*key = pair[0];
+				}
+				if (obj) {
+					*obj = pair[1];
+				}
+
+				iterator->bin++;
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	for (; iterator->bin < dictionary->capacity; iterator->bin++, iterator->index = 0) {
+
+		const Array *array = (const Array *) dictionary->elements[iterator->bin];
+		if (array && iterator->index < array->count) {
+
+			if (key) {
+				*key = array->elements[iterator->index];
+			}
+			if (obj) {
+				*obj = array->elements[iterator->index + 1];
+			}
+
+			iterator->index += 2;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/**
+ * @brief Iterates the pairs of `dictionary`, assigning each to `key` and `obj`.
+ */
+#define DictionaryForEach(key, obj, dictionary) \
+	for (DictionaryIterator _iterator = MakeDictionaryIterator(dictionary); \
+		DictionaryIteratorNext(&_iterator, (ident *) &(key), (ident *) &(obj)); )
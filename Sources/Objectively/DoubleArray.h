@@ -0,0 +1,237 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#pragma once
+
+#include <Objectively/Array.h>
+
+/**
+ * @file
+ *
+ * @brief Immutable arrays of unboxed `double` values.
+ */
+
+typedef struct DoubleArray DoubleArray;
+typedef struct DoubleArrayInterface DoubleArrayInterface;
+
+/**
+ * @brief Immutable arrays of unboxed `double` values.
+ *
+ * @details Unlike Array, the values are stored contiguously and without boxing, so that
+ * reductions such as DoubleArray::sum(const DoubleArray *) may be vectorized.
+ *
+ * @extends Object
+ *
+ * @ingroup Collections
+ */
+struct DoubleArray {
+
+	/**
+	 * @brief The parent.
+	 *
+	 * @private
+	 */
+	Object object;
+
+	/**
+	 * @brief The typed interface.
+	 *
+	 * @private
+	 */
+	DoubleArrayInterface *interface;
+
+	/**
+	 * @brief The count of values.
+	 */
+	size_t count;
+
+	/**
+	 * @brief The values.
+	 */
+	double *values;
+};
+
+typedef struct MutableDoubleArray MutableDoubleArray;
+
+/**
+ * @brief The DoubleArray interface.
+ */
+struct DoubleArrayInterface {
+
+	/**
+	 * @brief The parent interface.
+	 */
+	ObjectInterface objectInterface;
+
+	/**
+	 * @static
+	 *
+	 * @fn DoubleArray *DoubleArray::arrayWithArray(const Array *array)
+	 *
+	 * @brief Returns a new DoubleArray containing the values of the Numbers in `array`.
+	 *
+	 * @param array An Array of Numbers.
+	 *
+	 * @return The new DoubleArray, or `NULL` on error.
+	 *
+	 * @memberof DoubleArray
+	 */
+	DoubleArray *(*arrayWithArray)(const Array *array);
+
+	/**
+	 * @static
+	 *
+	 * @fn DoubleArray *DoubleArray::arrayWithValues(const double *values, size_t count)
+	 *
+	 * @brief Returns a new DoubleArray containing a copy of `values`.
+	 *
+	 * @param values The values.
+	 * @param count The count of `values`.
+	 *
+	 * @return The new DoubleArray, or `NULL` on error.
+	 *
+	 * @memberof DoubleArray
+	 */
+	DoubleArray *(*arrayWithValues)(const double *values, size_t count);
+
+	/**
+	 * @fn double DoubleArray::dot(const DoubleArray *self, const DoubleArray *other)
+	 *
+	 * @param other Another DoubleArray of the same count.
+	 *
+	 * @return The dot product of this DoubleArray and `other`.
+	 *
+	 * @memberof DoubleArray
+	 */
+	double (*dot)(const DoubleArray *self, const DoubleArray *other);
+
+	/**
+	 * @fn int DoubleArray::indexOfValue(const DoubleArray *self, double value)
+	 *
+	 * @param value The value.
+	 *
+	 * @return The index of the first occurrence of `value`, or `-1` if not found.
+	 *
+	 * @memberof DoubleArray
+	 */
+	int (*indexOfValue)(const DoubleArray *self, double value);
+
+	/**
+	 * @fn DoubleArray *DoubleArray::initWithArray(DoubleArray *self, const Array *array)
+	 *
+	 * @brief Initializes this DoubleArray with the values of the Numbers in `array`.
+	 *
+	 * @param array An Array of Numbers.
+	 *
+	 * @return The initialized DoubleArray, or `NULL` on error.
+	 *
+	 * @memberof DoubleArray
+	 */
+	DoubleArray *(*initWithArray)(DoubleArray *self, const Array *array);
+
+	/**
+	 * @fn DoubleArray *DoubleArray::initWithValues(DoubleArray *self, const double *values, size_t count)
+	 *
+	 * @brief Initializes this DoubleArray with a copy of `values`.
+	 *
+	 * @param values The values.
+	 * @param count The count of `values`.
+	 *
+	 * @return The initialized DoubleArray, or `NULL` on error.
+	 *
+	 * @memberof DoubleArray
+	 */
+	DoubleArray *(*initWithValues)(DoubleArray *self, const double *values, size_t count);
+
+	/**
+	 * @fn double DoubleArray::maxValue(const DoubleArray *self)
+	 *
+	 * @return The greatest value in this DoubleArray, which must not be empty.
+	 *
+	 * @memberof DoubleArray
+	 */
+	double (*maxValue)(const DoubleArray *self);
+
+	/**
+	 * @fn double DoubleArray::minValue(const DoubleArray *self)
+	 *
+	 * @return The least value in this DoubleArray, which must not be empty.
+	 *
+	 * @memberof DoubleArray
+	 */
+	double (*minValue)(const DoubleArray *self);
+
+	/**
+	 * @fn MutableDoubleArray *DoubleArray::mutableCopy(const DoubleArray *self)
+	 *
+	 * @return A MutableDoubleArray with the contents of this DoubleArray.
+	 *
+	 * @memberof DoubleArray
+	 */
+	MutableDoubleArray *(*mutableCopy)(const DoubleArray *self);
+
+	/**
+	 * @fn Array *DoubleArray::numbers(const DoubleArray *self)
+	 *
+	 * @return An Array of Numbers boxing the values of this DoubleArray.
+	 *
+	 * @memberof DoubleArray
+	 */
+	Array *(*numbers)(const DoubleArray *self);
+
+	/**
+	 * @fn DoubleArray *DoubleArray::scaledArray(const DoubleArray *self, double scalar)
+	 *
+	 * @param scalar The scalar.
+	 *
+	 * @return A copy of this DoubleArray with each value multiplied by `scalar`.
+	 *
+	 * @memberof DoubleArray
+	 */
+	DoubleArray *(*scaledArray)(const DoubleArray *self, double scalar);
+
+	/**
+	 * @fn double DoubleArray::sum(const DoubleArray *self)
+	 *
+	 * @return The sum of the values in this DoubleArray.
+	 *
+	 * @memberof DoubleArray
+	 */
+	double (*sum)(const DoubleArray *self);
+
+	/**
+	 * @fn double DoubleArray::valueAtIndex(const DoubleArray *self, int index)
+	 *
+	 * @param index The index of the desired value.
+	 *
+	 * @return The value at the specified index.
+	 *
+	 * @memberof DoubleArray
+	 */
+	double (*valueAtIndex)(const DoubleArray *self, int index);
+};
+
+/**
+ * @brief The DoubleArray Class.
+ */
+extern Class _DoubleArray;
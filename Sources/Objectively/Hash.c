@@ -42,6 +42,48 @@ int HashForBytes(int hash, const uint8_t *bytes, const Range range) {
 	return hash;
 }
 
+/**
+ * @return `x` rotated left by `r` bits.
+ */
+static inline uint64_t rotl64(uint64_t x, int r) {
+	return (x << r) | (x >> (64 - r));
+}
+
+uint64_t HashForBytes64(uint64_t hash, const uint8_t *bytes, size_t length) {
+
+	const uint64_t c1 = 0x87c37b91114253d5ull;
+	const uint64_t c2 = 0x4cf5ad432745937full;
+
+	size_t i = 0;
+
+	for (; i + sizeof(uint64_t) <= length; i += sizeof(uint64_t)) {
+
+		uint64_t k;
+		memcpy(&k, bytes + i, sizeof(k));
+
+		k *= c1;
+		k = rotl64(k, 31);
+		k *= c2;
+
+		hash ^= k;
+		hash = rotl64(hash, 27) * 5 + 0x52dce729;
+	}
+
+	uint64_t k = 0;
+	for (size_t j = 0; i + j < length; j++) {
+		k |= ((uint64_t) bytes[i + j]) << (j * 8);
+	}
+
+	k *= c1;
+	k = rotl64(k, 31);
+	k *= c2;
+
+	hash ^= k;
+	hash ^= length;
+
+	return HashMix64(hash);
+}
+
 int HashForCharacters(int hash, const char *chars, const Range range) {
 
 	return HashForBytes(hash, (const uint8_t *) chars, range);
@@ -71,3 +113,25 @@ int HashForObject(int hash, const ident obj) {
 
 	return 0;
 }
+
+uint32_t HashMix32(uint32_t hash) {
+
+	hash ^= hash >> 16;
+	hash *= 0x85ebca6b;
+	hash ^= hash >> 13;
+	hash *= 0xc2b2ae35;
+	hash ^= hash >> 16;
+
+	return hash;
+}
+
+uint64_t HashMix64(uint64_t hash) {
+
+	hash ^= hash >> 33;
+	hash *= 0xff51afd7ed558ccdull;
+	hash ^= hash >> 33;
+	hash *= 0xc4ceb9fe1a85ec53ull;
+	hash ^= hash >> 33;
+
+	return hash;
+}
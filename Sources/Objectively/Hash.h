@@ -49,6 +49,20 @@
  */
 extern int HashForBytes(int hash, const uint8_t *bytes, const Range range);
 
+/**
+ * @brief Accumulates a well-mixed, 64 bit hash value of `bytes` into `hash`.
+ *
+ * @param hash The hash accumulator.
+ * @param bytes The bytes to hash.
+ * @param length The count of `bytes`.
+ *
+ * @return The accumulated hash value.
+ *
+ * @remarks Unlike HashForBytes, every bit of the result depends on every bit of the input,
+ * which makes it suitable for probabilistic structures such as BloomFilter.
+ */
+extern uint64_t HashForBytes64(uint64_t hash, const uint8_t *bytes, size_t length);
+
 /**
  * @brief Accumulates the hash value of `chars` into `hash`.
  *
@@ -99,3 +113,26 @@ extern int HashForInteger(int hash, const long integer);
  * @return The accumulated hash value.
  */
 extern int HashForObject(int hash, const ident obj);
+
+/**
+ * @brief Finalizes a 32 bit hash, so that every bit of `hash` affects every bit of the result.
+ *
+ * @param hash The hash value, typically from Object::hash.
+ *
+ * @return The mixed hash value.
+ *
+ * @remarks This is the MurmurHash3 `fmix32` finalizer. It spreads weak or sequential hashes
+ * across the bins of a power-of-two table.
+ */
+extern uint32_t HashMix32(uint32_t hash);
+
+/**
+ * @brief Finalizes a 64 bit hash, so that every bit of `hash` affects every bit of the result.
+ *
+ * @param hash The hash value.
+ *
+ * @return The mixed hash value.
+ *
+ * @remarks This is the MurmurHash3 `fmix64` finalizer.
+ */
+extern uint64_t HashMix64(uint64_t hash);
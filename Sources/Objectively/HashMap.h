@@ -0,0 +1,199 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#pragma once
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <Objectively/Hash.h>
+
+/**
+ * @file
+ *
+ * @brief Unboxed, type-specialized hash maps.
+ *
+ * @details `DECLARE_HASHMAP(name, K, V, hashfn, eqfn)` declares the struct `name`, an open
+ * addressing hash map from `K` to `V`, and inline functions prefixed with `name` to operate on
+ * it. Entries are stored by value in a single power-of-two table with linear probing, and are
+ * removed by backward shifting, so that no tombstones accumulate. There is no dynamic dispatch
+ * and no reference counting.
+ *
+ * @code
+ * DECLARE_HASHMAP(Counts, int64_t, int, HashMapHashInteger, HashMapEqualIntegers);
+ *
+ * Counts counts = { 0 };
+ * int *count = CountsGet(&counts, 42);
+ * CountsSet(&counts, 42, count ? *count + 1 : 1);
+ * CountsFree(&counts);
+ * @endcode
+ */
+
+/**
+ * @brief Mixes the bits of `integer` for use as a HashMap hash.
+ */
+static inline __attribute__((unused)) size_t HashMapHashInteger(uint64_t integer) {
+	return (size_t) HashMix64(integer);
+}
+
+/**
+ * @brief Mixes the bits of `pointer` for use as a HashMap hash.
+ */
+static inline __attribute__((unused)) size_t HashMapHashPointer(const void *pointer) {
+	return HashMapHashInteger((uintptr_t) pointer);
+}
+
+/**
+ * @return True if the integers `a` and `b` are equal.
+ */
+static inline __attribute__((unused)) _Bool HashMapEqualIntegers(uint64_t a, uint64_t b) {
+	return a == b;
+}
+
+/**
+ * @return True if the pointers `a` and `b` are equal.
+ */
+static inline __attribute__((unused)) _Bool HashMapEqualPointers(const void *a, const void *b) {
+	return a == b;
+}
+
+/**
+ * @brief Declares the hash map type `name` from keys of type `K` to values of type `V`.
+ *
+ * @param name The type name, also the prefix of the generated functions and entry type.
+ * @param K The key type.
+ * @param V The value type.
+ * @param hashfn A function or macro returning a `size_t` hash for a `K`.
+ * @param eqfn A function or macro returning true if two `K` are equal.
+ */
+#define DECLARE_HASHMAP(name, K, V, hashfn, eqfn) \
+	\
+	typedef struct { \
+		K key; \
+		V value; \
+		_Bool occupied; \
+	} name##Entry; \
+	\
+	typedef struct { \
+		name##Entry *entries; \
+		size_t count; \
+		size_t capacity; \
+	} name; \
+	\
+	/** @brief Releases the storage of `map`, leaving it empty and reusable. */ \
+	static inline __attribute__((unused)) void name##Free(name *map) { \
+		free(map->entries); \
+		memset(map, 0, sizeof(*map)); \
+	} \
+	\
+	/** @return The index of the entry for `key`, or of the empty slot where it belongs. */ \
+	static inline __attribute__((unused)) size_t name##Probe(const name *map, K key) { \
+		const size_t mask = map->capacity - 1; \
+		size_t i = (hashfn(key)) & mask; \
+		while (map->entries[i].occupied && !(eqfn(map->entries[i].key, key))) { \
+			i = (i + 1) & mask; \
+		} \
+		return i; \
+	} \
+	\
+	/** @return A pointer to the value for `key`, or `NULL`. The pointer is valid until `map` is next modified. */ \
+	static inline __attribute__((unused)) V *name##Get(const name *map, K key) { \
+		if (map->count) { \
+			name##Entry *entry = &map->entries[name##Probe(map, key)]; \
+			if (entry->occupied) { \
+				return &entry->value; \
+			} \
+		} \
+		return NULL; \
+	} \
+	\
+	/** @brief Rehashes `map` into a table of `capacity` entries, a power of two. */ \
+	static inline __attribute__((unused)) void name##Resize(name *map, size_t capacity) { \
+		name##Entry *entries = map->entries; \
+		const size_t oldCapacity = map->capacity; \
+		map->entries = (name##Entry *) calloc(capacity, sizeof(name##Entry)); \
+		assert(map->entries); \
+		map->capacity = capacity; \
+		for (size_t j = 0; j < oldCapacity; j++) { \
+			if (entries[j].occupied) { \
+				map->entries[name##Probe(map, entries[j].key)] = entries[j]; \
+			} \
+		} \
+		free(entries); \
+	} \
+	\
+	/** @brief Sets the value for `key` to `value`, replacing any existing value. */ \
+	static inline __attribute__((unused)) void name##Set(name *map, K key, V value) { \
+		if ((map->count + 1) * 4 > map->capacity * 3) { \
+			name##Resize(map, map->capacity ? map->capacity * 2 : 16); \
+		} \
+		name##Entry *entry = &map->entries[name##Probe(map, key)]; \
+		if (entry->occupied == false) { \
+			entry->key = key; \
+			entry->occupied = true; \
+			map->count++; \
+		} \
+		entry->value = value; \
+	} \
+	\
+	/** @brief Removes the entry for `key`, returning true if it was present. */ \
+	static inline __attribute__((unused)) _Bool name##Remove(name *map, K key) { \
+		if (map->count == 0) { \
+			return false; \
+		} \
+		const size_t mask = map->capacity - 1; \
+		size_t i = name##Probe(map, key); \
+		if (map->entries[i].occupied == false) { \
+			return false; \
+		} \
+		for (size_t j = (i + 1) & mask; map->entries[j].occupied; j = (j + 1) & mask) { \
+			const size_t home = (hashfn(map->entries[j].key)) & mask; \
+			if (((j - home) & mask) >= ((j - i) & mask)) { \
+				map->entries[i] = map->entries[j]; \
+				i = j; \
+			} \
+		} \
+		map->entries[i].occupied = false; \
+		map->count--; \
+		return true; \
+	} \
+	\
+	/** @brief Removes all entries from `map`, retaining its capacity. */ \
+	static inline __attribute__((unused)) void name##Clear(name *map) { \
+		if (map->entries) { \
+			memset(map->entries, 0, map->capacity * sizeof(name##Entry)); \
+		} \
+		map->count = 0; \
+	} \
+	\
+	/** @return The next occupied entry at or after `*index`, advancing `*index` past it, or `NULL`. */ \
+	static inline __attribute__((unused)) name##Entry *name##Next(const name *map, size_t *index) { \
+		while (*index < map->capacity) { \
+			name##Entry *entry = &map->entries[(*index)++]; \
+			if (entry->occupied) { \
+				return entry; \
+			} \
+		} \
+		return NULL; \
+	}
@@ -0,0 +1,1077 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <Objectively/Hash.h>
+#include <Objectively/ImmutableMap.h>
+#include <Objectively/MutableDictionary.h>
+#include <Objectively/MutableString.h>
+
+#define _Class _ImmutableMap
+
+/**
+ * @brief The count of hash bits consumed by each level of the trie.
+ */
+#define IMMUTABLEMAP_BITS 5
+
+/**
+ * @brief The mask of hash bits consumed by each level of the trie.
+ */
+#define IMMUTABLEMAP_MASK ((1 << IMMUTABLEMAP_BITS) - 1)
+
+/**
+ * @brief The count of hash bits, beyond which keys are stored in collision nodes.
+ */
+#define IMMUTABLEMAP_HASH_BITS 32
+
+/**
+ * @brief A node of the trie.
+ *
+ * @details Bitmap nodes store their inline pairs (key, object) first, followed by their child
+ * nodes, each indexed by the population count of their bitmap below the hash fragment. Collision
+ * nodes store pairs whose hashes are identical in all bits, and are searched linearly.
+ *
+ * Nodes are reference counted, so that they may be shared between versions. A node may only be
+ * modified in place by the transient ImmutableMap whose edit token it carries.
+ */
+typedef struct {
+	unsigned referenceCount;
+	size_t edit;
+	_Bool isCollision;
+	uint32_t dataMap;
+	uint32_t nodeMap;
+	size_t dataCount;
+	size_t nodeCount;
+	size_t capacity;
+	ident *slots;
+} Node;
+
+/**
+ * @brief The most recently issued edit token.
+ */
+static volatile size_t _edit;
+
+/**
+ * @return A new, unique edit token.
+ */
+static size_t nextEdit(void) {
+	return __sync_add_and_fetch(&_edit, 1);
+}
+
+/**
+ * @return The well-mixed hash of `key`, so that sequential hashes spread across the trie.
+ */
+static uint32_t hashForKey(const ident key) {
+	return HashMix32((uint32_t) $((Object *) key, hash));
+}
+
+/**
+ * @return True if the keys are equal.
+ */
+static inline _Bool keysAreEqual(const ident a, const ident b) {
+	return a == b || $((Object *) a, isEqual, b);
+}
+
+/**
+ * @return The bit of `hash` at the level of `shift`.
+ */
+static inline uint32_t bitForHash(uint32_t hash, unsigned shift) {
+	return 1u << ((hash >> shift) & IMMUTABLEMAP_MASK);
+}
+
+/**
+ * @return The index of `bit` within `bitmap`.
+ */
+static inline size_t indexForBit(uint32_t bitmap, uint32_t bit) {
+	return __builtin_popcount(bitmap & (bit - 1));
+}
+
+/**
+ * @return A new node with room for `capacity` slots.
+ */
+static Node *allocNode(size_t edit, size_t capacity) {
+
+	Node *node = calloc(1, sizeof(Node));
+	assert(node);
+
+	node->referenceCount = 1;
+	node->edit = edit;
+	node->capacity = max(capacity, (size_t) 2);
+
+	node->slots = calloc(node->capacity, sizeof(ident));
+	assert(node->slots);
+
+	return node;
+}
+
+/**
+ * @return `node`, with its reference count incremented.
+ */
+static Node *retainNode(Node *node) {
+
+	__sync_add_and_fetch(&node->referenceCount, 1);
+
+	return node;
+}
+
+/**
+ * @brief Decrements the reference count of `node`, freeing it and its contents at zero.
+ */
+static void releaseNode(Node *node) {
+
+	if (node && __sync_add_and_fetch(&node->referenceCount, -1) == 0) {
+
+		for (size_t i = 0; i < node->dataCount * 2; i++) {
+			release(node->slots[i]);
+		}
+
+		for (size_t i = 0; i < node->nodeCount; i++) {
+			releaseNode(node->slots[node->dataCount * 2 + i]);
+		}
+
+		free(node->slots);
+		free(node);
+	}
+}
+
+/**
+ * @return A node that the edit `edit` may modify in place: `node` itself, if it carries
+ * `edit`, or else a copy of it carrying `edit`.
+ */
+static Node *editableNode(Node *node, size_t edit) {
+
+	if (edit && node->edit == edit) {
+		return retainNode(node);
+	}
+
+	const size_t count = node->dataCount * 2 + node->nodeCount;
+
+	Node *copy = allocNode(edit, count + 2);
+
+	copy->isCollision = node->isCollision;
+	copy->dataMap = node->dataMap;
+	copy->nodeMap = node->nodeMap;
+	copy->dataCount = node->dataCount;
+	copy->nodeCount = node->nodeCount;
+
+	memcpy(copy->slots, node->slots, count * sizeof(ident));
+
+	for (size_t i = 0; i < copy->dataCount * 2; i++) {
+		retain(copy->slots[i]);
+	}
+
+	for (size_t i = 0; i < copy->nodeCount; i++) {
+		retainNode(copy->slots[copy->dataCount * 2 + i]);
+	}
+
+	return copy;
+}
+
+/**
+ * @brief Ensures that `node` has room for `count` more slots.
+ */
+static void reserveSlots(Node *node, size_t count) {
+
+	const size_t required = node->dataCount * 2 + node->nodeCount + count;
+	if (required > node->capacity) {
+
+		node->capacity = max(required, node->capacity * 2);
+
+		node->slots = realloc(node->slots, node->capacity * sizeof(ident));
+		assert(node->slots);
+	}
+}
+
+/**
+ * @brief Inserts a pair at `index` of the editable `node`, retaining it.
+ */
+static void insertPair(Node *node, size_t index, const ident key, const ident obj) {
+
+	reserveSlots(node, 2);
+
+	ident *slot = node->slots + index * 2;
+	const size_t count = node->dataCount * 2 + node->nodeCount - index * 2;
+
+	memmove(slot + 2, slot, count * sizeof(ident));
+
+	slot[0] = retain(key);
+	slot[1] = retain(obj);
+
+	node->dataCount++;
+}
+
+/**
+ * @brief Removes the pair at `index` of the editable `node`, releasing it.
+ */
+static void removePair(Node *node, size_t index) {
+
+	ident *slot = node->slots + index * 2;
+
+	release(slot[0]);
+	release(slot[1]);
+
+	const size_t count = node->dataCount * 2 + node->nodeCount - index * 2 - 2;
+
+	memmove(slot, slot + 2, count * sizeof(ident));
+
+	node->dataCount--;
+}
+
+/**
+ * @brief Inserts `child` at `index` of the editable `node`, transferring its reference.
+ */
+static void insertChild(Node *node, size_t index, Node *child) {
+
+	reserveSlots(node, 1);
+
+	ident *slot = node->slots + node->dataCount * 2 + index;
+	const size_t count = node->nodeCount - index;
+
+	memmove(slot + 1, slot, count * sizeof(ident));
+
+	slot[0] = child;
+
+	node->nodeCount++;
+}
+
+/**
+ * @brief Removes the child at `index` of the editable `node`, releasing it.
+ */
+static void removeChild(Node *node, size_t index) {
+
+	ident *slot = node->slots + node->dataCount * 2 + index;
+
+	releaseNode(slot[0]);
+
+	const size_t count = node->nodeCount - index - 1;
+
+	memmove(slot, slot + 1, count * sizeof(ident));
+
+	node->nodeCount--;
+}
+
+/**
+ * @brief Replaces the Object of the pair at `index` of the editable `node`.
+ */
+static void replaceObject(Node *node, size_t index, const ident obj) {
+
+	ident *slot = node->slots + index * 2 + 1;
+
+	release(*slot);
+	*slot = retain(obj);
+}
+
+/**
+ * @return A new node containing both pairs, whose hashes are equal below `shift`.
+ */
+static Node *mergePairs(size_t edit, unsigned shift,
+		const ident key1, const ident obj1, uint32_t hash1,
+		const ident key2, const ident obj2, uint32_t hash2) {
+
+	if (shift >= IMMUTABLEMAP_HASH_BITS) {
+
+		Node *node = allocNode(edit, 4);
+		node->isCollision = true;
+
+		insertPair(node, 0, key1, obj1);
+		insertPair(node, 1, key2, obj2);
+
+		return node;
+	}
+
+	const uint32_t bit1 = bitForHash(hash1, shift);
+	const uint32_t bit2 = bitForHash(hash2, shift);
+
+	if (bit1 == bit2) {
+
+		Node *node = allocNode(edit, 1);
+		node->nodeMap = bit1;
+
+		insertChild(node, 0, mergePairs(edit, shift + IMMUTABLEMAP_BITS, key1, obj1, hash1, key2, obj2, hash2));
+
+		return node;
+	}
+
+	Node *node = allocNode(edit, 4);
+	node->dataMap = bit1 | bit2;
+
+	if (bit1 < bit2) {
+		insertPair(node, 0, key1, obj1);
+		insertPair(node, 1, key2, obj2);
+	} else {
+		insertPair(node, 0, key2, obj2);
+		insertPair(node, 1, key1, obj1);
+	}
+
+	return node;
+}
+
+/**
+ * @return The Object stored at `key` beneath `node`, or `NULL`.
+ */
+static ident objectInNode(const Node *node, const ident key, uint32_t hash) {
+
+	for (unsigned shift = 0; node; shift += IMMUTABLEMAP_BITS) {
+
+		if (node->isCollision) {
+
+			for (size_t i = 0; i < node->dataCount; i++) {
+				if (keysAreEqual(node->slots[i * 2], key)) {
+					return node->slots[i * 2 + 1];
+				}
+			}
+
+			return NULL;
+		}
+
+		const uint32_t bit = bitForHash(hash, shift);
+
+		if (node->dataMap & bit) {
+
+			const size_t index = indexForBit(node->dataMap, bit);
+
+			if (keysAreEqual(node->slots[index * 2], key)) {
+				return node->slots[index * 2 + 1];
+			}
+
+			return NULL;
+		}
+
+		if (node->nodeMap & bit) {
+			node = node->slots[node->dataCount * 2 + indexForBit(node->nodeMap, bit)];
+		} else {
+			node = NULL;
+		}
+	}
+
+	return NULL;
+}
+
+/**
+ * @brief Stores `obj` at `key` beneath `node`.
+ *
+ * @return A new reference to the resulting node, which is `node` itself if it was unchanged
+ * or modified in place.
+ */
+static Node *setInNode(Node *node, size_t edit, unsigned shift,
+		const ident key, const ident obj, uint32_t hash, _Bool *added) {
+
+	if (node->isCollision) {
+
+		for (size_t i = 0; i < node->dataCount; i++) {
+			if (keysAreEqual(node->slots[i * 2], key)) {
+
+				if (node->slots[i * 2 + 1] == obj) {
+					return retainNode(node);
+				}
+
+				Node *editable = editableNode(node, edit);
+				replaceObject(editable, i, obj);
+				return editable;
+			}
+		}
+
+		Node *editable = editableNode(node, edit);
+		insertPair(editable, editable->dataCount, key, obj);
+		*added = true;
+		return editable;
+	}
+
+	const uint32_t bit = bitForHash(hash, shift);
+
+	if (node->dataMap & bit) {
+
+		const size_t index = indexForBit(node->dataMap, bit);
+
+		const ident existingKey = node->slots[index * 2];
+		const ident existingObj = node->slots[index * 2 + 1];
+
+		if (keysAreEqual(existingKey, key)) {
+
+			if (existingObj == obj) {
+				return retainNode(node);
+			}
+
+			Node *editable = editableNode(node, edit);
+			replaceObject(editable, index, obj);
+			return editable;
+		}
+
+		Node *child = mergePairs(edit, shift + IMMUTABLEMAP_BITS,
+								 existingKey, existingObj, hashForKey(existingKey),
+								 key, obj, hash);
+
+		Node *editable = editableNode(node, edit);
+
+		removePair(editable, index);
+		editable->dataMap &= ~bit;
+
+		insertChild(editable, indexForBit(editable->nodeMap, bit), child);
+		editable->nodeMap |= bit;
+
+		*added = true;
+		return editable;
+	}
+
+	if (node->nodeMap & bit) {
+
+		const size_t index = indexForBit(node->nodeMap, bit);
+
+		Node *child = node->slots[node->dataCount * 2 + index];
+		Node *result = setInNode(child, edit, shift + IMMUTABLEMAP_BITS, key, obj, hash, added);
+
+		if (result == child) {
+			releaseNode(result);
+			return retainNode(node);
+		}
+
+		Node *editable = editableNode(node, edit);
+
+		ident *slot = editable->slots + editable->dataCount * 2 + index;
+
+		releaseNode(*slot);
+		*slot = result;
+
+		return editable;
+	}
+
+	Node *editable = editableNode(node, edit);
+
+	insertPair(editable, indexForBit(editable->dataMap, bit), key, obj);
+	editable->dataMap |= bit;
+
+	*added = true;
+	return editable;
+}
+
+/**
+ * @brief Removes `key` from beneath `node`.
+ *
+ * @return A new reference to the resulting node, which is `node` itself if it was unchanged
+ * or modified in place, or `NULL` if the resulting node is empty.
+ */
+static Node *removeFromNode(Node *node, size_t edit, unsigned shift,
+		const ident key, uint32_t hash, _Bool *removed) {
+
+	if (node->isCollision) {
+
+		for (size_t i = 0; i < node->dataCount; i++) {
+			if (keysAreEqual(node->slots[i * 2], key)) {
+
+				Node *editable = editableNode(node, edit);
+				removePair(editable, i);
+				*removed = true;
+				return editable;
+			}
+		}
+
+		return retainNode(node);
+	}
+
+	const uint32_t bit = bitForHash(hash, shift);
+
+	if (node->dataMap & bit) {
+
+		const size_t index = indexForBit(node->dataMap, bit);
+
+		if (keysAreEqual(node->slots[index * 2], key) == false) {
+			return retainNode(node);
+		}
+
+		Node *editable = editableNode(node, edit);
+
+		removePair(editable, index);
+		editable->dataMap &= ~bit;
+
+		*removed = true;
+
+		if (editable->dataCount == 0 && editable->nodeCount == 0) {
+			releaseNode(editable);
+			return NULL;
+		}
+
+		return editable;
+	}
+
+	if (node->nodeMap & bit) {
+
+		const size_t index = indexForBit(node->nodeMap, bit);
+
+		Node *child = node->slots[node->dataCount * 2 + index];
+		Node *result = removeFromNode(child, edit, shift + IMMUTABLEMAP_BITS, key, hash, removed);
+
+		if (*removed == false) {
+			releaseNode(result);
+			return retainNode(node);
+		}
+
+		Node *editable = editableNode(node, edit);
+
+		if (result && (result->dataCount > 1 || result->nodeCount)) {
+
+			if (result == child) {
+				releaseNode(result);
+			} else {
+				ident *slot = editable->slots + editable->dataCount * 2 + index;
+
+				releaseNode(*slot);
+				*slot = result;
+			}
+
+			return editable;
+		}
+
+		removeChild(editable, index);
+		editable->nodeMap &= ~bit;
+
+		if (result) {
+
+			insertPair(editable, indexForBit(editable->dataMap, bit), result->slots[0], result->slots[1]);
+			editable->dataMap |= bit;
+
+			releaseNode(result);
+		}
+
+		if (editable->dataCount == 0 && editable->nodeCount == 0) {
+			releaseNode(editable);
+			return NULL;
+		}
+
+		return editable;
+	}
+
+	return retainNode(node);
+}
+
+/**
+ * @brief Enumerates the pairs beneath `node`.
+ *
+ * @return True if the enumeration was stopped.
+ */
+static _Bool enumerateNode(const ImmutableMap *map, const Node *node,
+		ImmutableMapEnumerator enumerator, ident data) {
+
+	for (size_t i = 0; i < node->dataCount; i++) {
+		if (enumerator(map, node->slots[i * 2 + 1], node->slots[i * 2], data)) {
+			return true;
+		}
+	}
+
+	for (size_t i = 0; i < node->nodeCount; i++) {
+		if (enumerateNode(map, node->slots[node->dataCount * 2 + i], enumerator, data)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/**
+ * @return The size of `node` and of the nodes beneath it, in bytes.
+ */
+static size_t sizeOfNode(const Node *node) {
+
+	size_t size = sizeof(Node) + node->capacity * sizeof(ident);
+
+	for (size_t i = 0; i < node->nodeCount; i++) {
+		size += sizeOfNode(node->slots[node->dataCount * 2 + i]);
+	}
+
+	return size;
+}
+
+/**
+ * @brief Stores `obj` at `key` in `map`, which must be newly allocated or transient.
+ */
+static void setObjectForKey_edit(ImmutableMap *map, size_t edit, const ident obj, const ident key) {
+
+	assert(obj);
+	assert(key);
+
+	const uint32_t hash = hashForKey(key);
+
+	if (map->root == NULL) {
+
+		Node *root = allocNode(edit, 2);
+
+		insertPair(root, 0, key, obj);
+		root->dataMap = bitForHash(hash, 0);
+
+		map->root = root;
+		map->count = 1;
+		return;
+	}
+
+	_Bool added = false;
+
+	Node *root = setInNode(map->root, edit, 0, key, obj, hash, &added);
+
+	releaseNode(map->root);
+	map->root = root;
+
+	if (added) {
+		map->count++;
+	}
+}
+
+/**
+ * @brief Removes `key` from `map`, which must be newly allocated or transient.
+ */
+static void removeObjectForKey_edit(ImmutableMap *map, size_t edit, const ident key) {
+
+	assert(key);
+
+	if (map->root) {
+
+		_Bool removed = false;
+
+		Node *root = removeFromNode(map->root, edit, 0, key, hashForKey(key), &removed);
+
+		releaseNode(map->root);
+		map->root = root;
+
+		if (removed) {
+			map->count--;
+		}
+	}
+}
+
+/**
+ * @brief Ensures that the nodes of a transient `map` will be copied, rather than modified in
+ * place, by its subsequent edits, because they are about to be shared.
+ */
+static void shareNodes(const ImmutableMap *map) {
+
+	if (map->isTransient) {
+		((ImmutableMap *) map)->edit = nextEdit();
+	}
+}
+
+/**
+ * @return A new ImmutableMap sharing the nodes of `map`.
+ */
+static ImmutableMap *mapWithNodes(const ImmutableMap *map) {
+
+	shareNodes(map);
+
+	ImmutableMap *that = alloc(ImmutableMap, init);
+	if (that) {
+		if (map->root) {
+			that->root = retainNode(map->root);
+		}
+		that->count = map->count;
+	}
+
+	return that;
+}
+
+#pragma mark - Object
+
+/**
+ * @see Object::copy(const Object *)
+ */
+static Object *copy(const Object *self) {
+
+	const ImmutableMap *this = (ImmutableMap *) self;
+
+	return (Object *) $(this, persistentCopy);
+}
+
+/**
+ * @see Object::dealloc(Object *)
+ */
+static void dealloc(Object *self) {
+
+	ImmutableMap *this = (ImmutableMap *) self;
+
+	releaseNode(this->root);
+
+	super(Object, self, dealloc);
+}
+
+/**
+ * @brief An ImmutableMapEnumerator for deepSizeInBytes.
+ */
+static _Bool deepSizeInBytes_enumerator(const ImmutableMap *map, ident obj, ident key, ident data) {
+
+	*(size_t *) data += $((Object *) key, deepSizeInBytes) + $((Object *) obj, deepSizeInBytes);
+
+	return false;
+}
+
+/**
+ * @see Object::deepSizeInBytes(const Object *)
+ */
+static size_t deepSizeInBytes(const Object *self) {
+
+	const ImmutableMap *this = (ImmutableMap *) self;
+
+	size_t size = $(self, sizeInBytes);
+
+	$(this, enumerateObjectsAndKeys, deepSizeInBytes_enumerator, &size);
+
+	return size;
+}
+
+/**
+ * @brief An ImmutableMapEnumerator for description.
+ */
+static _Bool description_enumerator(const ImmutableMap *map, ident obj, ident key, ident data) {
+
+	MutableString *desc = (MutableString *) data;
+
+	String *objDesc = $((Object *) obj, description);
+	String *keyDesc = $((Object *) key, description);
+
+	$(desc, appendFormat, "%s: %s, ", keyDesc->chars, objDesc->chars);
+
+	release(objDesc);
+	release(keyDesc);
+
+	return false;
+}
+
+/**
+ * @see Object::description(const Object *)
+ */
+static String *description(const Object *self) {
+
+	const ImmutableMap *this = (ImmutableMap *) self;
+
+	MutableString *desc = alloc(MutableString, init);
+
+	$(desc, appendCharacters, "{");
+
+	$(this, enumerateObjectsAndKeys, description_enumerator, desc);
+
+	$(desc, appendCharacters, "}");
+
+	return (String *) desc;
+}
+
+/**
+ * @brief An ImmutableMapEnumerator for hash.
+ */
+static _Bool hash_enumerator(const ImmutableMap *map, ident obj, ident key, ident data) {
+
+	*(unsigned *) data += (unsigned) HashForObject(HashForObject(HASH_SEED, key), obj);
+
+	return false;
+}
+
+/**
+ * @see Object::hash(const Object *)
+ *
+ * @remarks The hash is independent of the order of the pairs.
+ */
+static int hash(const Object *self) {
+
+	const ImmutableMap *this = (ImmutableMap *) self;
+
+	unsigned hash = HashForInteger(HASH_SEED, this->count);
+
+	$(this, enumerateObjectsAndKeys, hash_enumerator, &hash);
+
+	return (int) hash;
+}
+
+/**
+ * @brief An ImmutableMapEnumerator for isEqual.
+ */
+static _Bool isEqual_enumerator(const ImmutableMap *map, ident obj, ident key, ident data) {
+
+	const ImmutableMap *that = (ImmutableMap *) data;
+
+	const Object *thatObject = $(that, objectForKey, key);
+
+	return $((Object *) obj, isEqual, thatObject) == false;
+}
+
+/**
+ * @see Object::isEqual(const Object *, const Object *)
+ */
+static _Bool isEqual(const Object *self, const Object *other) {
+
+	if (super(Object, self, isEqual, other)) {
+		return true;
+	}
+
+	if (other && $(other, isKindOfClass, &_ImmutableMap)) {
+
+		const ImmutableMap *this = (ImmutableMap *) self;
+		const ImmutableMap *that = (ImmutableMap *) other;
+
+		if (this->count == that->count) {
+
+			if (this->root == that->root) {
+				return true;
+			}
+
+			_Bool mismatched = false;
+
+			if (this->root) {
+				mismatched = enumerateNode(this, this->root, isEqual_enumerator, (ident) that);
+			}
+
+			return mismatched == false;
+		}
+	}
+
+	return false;
+}
+
+/**
+ * @see Object::sizeInBytes(const Object *)
+ */
+static size_t sizeInBytes(const Object *self) {
+
+	const ImmutableMap *this = (ImmutableMap *) self;
+
+	size_t size = super(Object, self, sizeInBytes);
+
+	if (this->root) {
+		size += sizeOfNode(this->root);
+	}
+
+	return size;
+}
+
+#pragma mark - ImmutableMap
+
+/**
+ * @brief An ImmutableMapEnumerator for dictionary.
+ */
+static _Bool dictionary_enumerator(const ImmutableMap *map, ident obj, ident key, ident data) {
+
+	$((MutableDictionary *) data, setObjectForKey, obj, key); return false;
+}
+
+/**
+ * @fn Dictionary *ImmutableMap::dictionary(const ImmutableMap *self)
+ *
+ * @memberof ImmutableMap
+ */
+static Dictionary *dictionary(const ImmutableMap *self) {
+
+	MutableDictionary *dictionary = alloc(MutableDictionary, initWithCapacity, self->count);
+
+	$(self, enumerateObjectsAndKeys, dictionary_enumerator, dictionary);
+
+	return (Dictionary *) dictionary;
+}
+
+/**
+ * @fn void ImmutableMap::enumerateObjectsAndKeys(const ImmutableMap *self, ImmutableMapEnumerator enumerator, ident data)
+ *
+ * @memberof ImmutableMap
+ */
+static void enumerateObjectsAndKeys(const ImmutableMap *self, ImmutableMapEnumerator enumerator, ident data) {
+
+	assert(enumerator);
+
+	if (self->root) {
+		enumerateNode(self, self->root, enumerator, data);
+	}
+}
+
+/**
+ * @fn ImmutableMap *ImmutableMap::init(ImmutableMap *self)
+ *
+ * @memberof ImmutableMap
+ */
+static ImmutableMap *init(ImmutableMap *self) {
+
+	return (ImmutableMap *) super(Object, self, init);
+}
+
+/**
+ * @fn ImmutableMap *ImmutableMap::initWithDictionary(ImmutableMap *self, const Dictionary *dictionary)
+ *
+ * @memberof ImmutableMap
+ */
+static ImmutableMap *initWithDictionary(ImmutableMap *self, const Dictionary *dictionary) {
+
+	self = $(self, init);
+	if (self) {
+		if (dictionary) {
+
+			const size_t edit = nextEdit();
+
+			ident key, obj;
+			DictionaryForEach(key, obj, dictionary) {
+				setObjectForKey_edit(self, edit, obj, key);
+			}
+		}
+	}
+
+	return self;
+}
+
+/**
+ * @fn ImmutableMap *ImmutableMap::mapWithDictionary(const Dictionary *dictionary)
+ *
+ * @memberof ImmutableMap
+ */
+static ImmutableMap *mapWithDictionary(const Dictionary *dictionary) {
+
+	return alloc(ImmutableMap, initWithDictionary, dictionary);
+}
+
+/**
+ * @fn ident ImmutableMap::objectForKey(const ImmutableMap *self, const ident key)
+ *
+ * @memberof ImmutableMap
+ */
+static ident objectForKey(const ImmutableMap *self, const ident key) {
+
+	assert(key);
+
+	return objectInNode(self->root, key, hashForKey(key));
+}
+
+/**
+ * @fn ImmutableMap *ImmutableMap::persistentCopy(const ImmutableMap *self)
+ *
+ * @memberof ImmutableMap
+ */
+static ImmutableMap *persistentCopy(const ImmutableMap *self) {
+
+	return mapWithNodes(self);
+}
+
+/**
+ * @fn ImmutableMap *ImmutableMap::removeObjectForKey(const ImmutableMap *self, const ident key)
+ *
+ * @memberof ImmutableMap
+ */
+static ImmutableMap *removeObjectForKey(const ImmutableMap *self, const ident key) {
+
+	ImmutableMap *map = mapWithNodes(self);
+	if (map) {
+		removeObjectForKey_edit(map, 0, key);
+	}
+
+	return map;
+}
+
+/**
+ * @fn ImmutableMap *ImmutableMap::setObjectForKey(const ImmutableMap *self, const ident obj, const ident key)
+ *
+ * @memberof ImmutableMap
+ */
+static ImmutableMap *setObjectForKey(const ImmutableMap *self, const ident obj, const ident key) {
+
+	ImmutableMap *map = mapWithNodes(self);
+	if (map) {
+		setObjectForKey_edit(map, 0, obj, key);
+	}
+
+	return map;
+}
+
+/**
+ * @fn ImmutableMap *ImmutableMap::transientCopy(const ImmutableMap *self)
+ *
+ * @memberof ImmutableMap
+ */
+static ImmutableMap *transientCopy(const ImmutableMap *self) {
+
+	ImmutableMap *map = mapWithNodes(self);
+	if (map) {
+		map->isTransient = true;
+		map->edit = nextEdit();
+	}
+
+	return map;
+}
+
+/**
+ * @fn void ImmutableMap::transientRemoveObjectForKey(ImmutableMap *self, const ident key)
+ *
+ * @memberof ImmutableMap
+ */
+static void transientRemoveObjectForKey(ImmutableMap *self, const ident key) {
+
+	assert(self->isTransient);
+
+	removeObjectForKey_edit(self, self->edit, key);
+}
+
+/**
+ * @fn void ImmutableMap::transientSetObjectForKey(ImmutableMap *self, const ident obj, const ident key)
+ *
+ * @memberof ImmutableMap
+ */
+static void transientSetObjectForKey(ImmutableMap *self, const ident obj, const ident key) {
+
+	assert(self->isTransient);
+
+	setObjectForKey_edit(self, self->edit, obj, key);
+}
+
+#pragma mark - Class lifecycle
+
+/**
+ * @see Class::initialize(Class *)
+ */
+static void initialize(Class *clazz) {
+
+	ObjectInterface *object = (ObjectInterface *) clazz->interface;
+
+	object->copy = copy;
+	object->dealloc = dealloc;
+	object->deepSizeInBytes = deepSizeInBytes;
+	object->description = description;
+	object->hash = hash;
+	object->isEqual = isEqual;
+	object->sizeInBytes = sizeInBytes;
+
+	ImmutableMapInterface *map = (ImmutableMapInterface *) clazz->interface;
+
+	map->dictionary = dictionary;
+	map->enumerateObjectsAndKeys = enumerateObjectsAndKeys;
+	map->init = init;
+	map->initWithDictionary = initWithDictionary;
+	map->mapWithDictionary = mapWithDictionary;
+	map->objectForKey = objectForKey;
+	map->persistentCopy = persistentCopy;
+	map->removeObjectForKey = removeObjectForKey;
+	map->setObjectForKey = setObjectForKey;
+	map->transientCopy = transientCopy;
+	map->transientRemoveObjectForKey = transientRemoveObjectForKey;
+	map->transientSetObjectForKey = transientSetObjectForKey;
+}
+
+Class _ImmutableMap = {
+	.name = "ImmutableMap",
+	.superclass = &_Object,
+	.instanceSize = sizeof(ImmutableMap),
+	.interfaceOffset = offsetof(ImmutableMap, interface),
+	.interfaceSize = sizeof(ImmutableMapInterface),
+	.initialize = initialize,
+};
+
+#undef _Class
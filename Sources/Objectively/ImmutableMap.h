@@ -0,0 +1,266 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#pragma once
+
+#include <Objectively/Dictionary.h>
+
+/**
+ * @file
+ *
+ * @brief Persistent key-value stores with structural sharing.
+ */
+
+typedef struct ImmutableMap ImmutableMap;
+typedef struct ImmutableMapInterface ImmutableMapInterface;
+
+/**
+ * @brief A function pointer for ImmutableMap enumeration (iteration).
+ *
+ * @param map The ImmutableMap.
+ * @param obj The Object for the current iteration.
+ * @param key The key for the current iteration.
+ * @param data User data.
+ *
+ * @return True to stop enumeration, false to continue.
+ *
+ * @remarks The parameters match those of DictionaryEnumerator.
+ */
+typedef _Bool (*ImmutableMapEnumerator)(const ImmutableMap *map, ident obj, ident key, ident data);
+
+/**
+ * @brief Persistent key-value stores with structural sharing.
+ *
+ * @details ImmutableMaps are hash array mapped tries. Modifying an ImmutableMap returns a new
+ * version that shares every unchanged node with the original, in `O(log32 n)` time and space.
+ * Both versions remain valid, and may be read from any thread.
+ *
+ * A transient ImmutableMap, created with ImmutableMap::transientCopy, may be edited in place to
+ * batch many changes without copying the nodes it has already copied. Take a persistent
+ * snapshot with ImmutableMap::persistentCopy when the batch is complete.
+ *
+ * Because versions share nodes, Object::sizeInBytes counts every node reachable from a version,
+ * including those it shares with other versions, so the sizes of several versions overstate their
+ * combined footprint.
+ *
+ * @extends Object
+ *
+ * @ingroup Collections
+ */
+struct ImmutableMap {
+
+	/**
+	 * @brief The parent.
+	 *
+	 * @private
+	 */
+	Object object;
+
+	/**
+	 * @brief The typed interface.
+	 *
+	 * @private
+	 */
+	ImmutableMapInterface *interface;
+
+	/**
+	 * @brief The count of elements.
+	 */
+	size_t count;
+
+	/**
+	 * @brief The edit token of a transient ImmutableMap, or `0`.
+	 *
+	 * @private
+	 */
+	size_t edit;
+
+	/**
+	 * @brief True if this ImmutableMap may be edited in place.
+	 */
+	_Bool isTransient;
+
+	/**
+	 * @brief The root node.
+	 *
+	 * @private
+	 */
+	ident root;
+};
+
+/**
+ * @brief The ImmutableMap interface.
+ */
+struct ImmutableMapInterface {
+
+	/**
+	 * @brief The parent interface.
+	 */
+	ObjectInterface objectInterface;
+
+	/**
+	 * @fn Dictionary *ImmutableMap::dictionary(const ImmutableMap *self)
+	 *
+	 * @return A new Dictionary containing the elements of this ImmutableMap.
+	 *
+	 * @memberof ImmutableMap
+	 */
+	Dictionary *(*dictionary)(const ImmutableMap *self);
+
+	/**
+	 * @fn void ImmutableMap::enumerateObjectsAndKeys(const ImmutableMap *self, ImmutableMapEnumerator enumerator, ident data)
+	 *
+	 * @brief Enumerate the pairs of this ImmutableMap with the given function.
+	 *
+	 * @param enumerator The enumerator function.
+	 * @param data User data.
+	 *
+	 * @remarks The enumerator should return `true` to break the iteration.
+	 *
+	 * @memberof ImmutableMap
+	 */
+	void (*enumerateObjectsAndKeys)(const ImmutableMap *self, ImmutableMapEnumerator enumerator, ident data);
+
+	/**
+	 * @fn ImmutableMap *ImmutableMap::init(ImmutableMap *self)
+	 *
+	 * @brief Initializes this ImmutableMap to be empty.
+	 *
+	 * @return The initialized ImmutableMap, or `NULL` on error.
+	 *
+	 * @memberof ImmutableMap
+	 */
+	ImmutableMap *(*init)(ImmutableMap *self);
+
+	/**
+	 * @fn ImmutableMap *ImmutableMap::initWithDictionary(ImmutableMap *self, const Dictionary *dictionary)
+	 *
+	 * @brief Initializes this ImmutableMap to contain elements of `dictionary`.
+	 *
+	 * @param dictionary A Dictionary.
+	 *
+	 * @return The initialized ImmutableMap, or `NULL` on error.
+	 *
+	 * @memberof ImmutableMap
+	 */
+	ImmutableMap *(*initWithDictionary)(ImmutableMap *self, const Dictionary *dictionary);
+
+	/**
+	 * @fn ImmutableMap *ImmutableMap::mapWithDictionary(const Dictionary *dictionary)
+	 *
+	 * @brief Returns a new ImmutableMap containing the elements of `dictionary`.
+	 *
+	 * @param dictionary A Dictionary.
+	 *
+	 * @return The new ImmutableMap, or `NULL` on error.
+	 *
+	 * @memberof ImmutableMap
+	 * @static
+	 */
+	ImmutableMap *(*mapWithDictionary)(const Dictionary *dictionary);
+
+	/**
+	 * @fn ident ImmutableMap::objectForKey(const ImmutableMap *self, const ident key)
+	 *
+	 * @return The Object stored at the specified key in this ImmutableMap, or `NULL`.
+	 *
+	 * @memberof ImmutableMap
+	 */
+	ident (*objectForKey)(const ImmutableMap *self, const ident key);
+
+	/**
+	 * @fn ImmutableMap *ImmutableMap::persistentCopy(const ImmutableMap *self)
+	 *
+	 * @return A new, persistent ImmutableMap with the elements of this ImmutableMap.
+	 *
+	 * @remarks If this ImmutableMap is transient, it remains so, but subsequent edits will copy
+	 * the nodes it now shares with the snapshot.
+	 *
+	 * @memberof ImmutableMap
+	 */
+	ImmutableMap *(*persistentCopy)(const ImmutableMap *self);
+
+	/**
+	 * @fn ImmutableMap *ImmutableMap::removeObjectForKey(const ImmutableMap *self, const ident key)
+	 *
+	 * @brief Returns a new version of this ImmutableMap without the specified key.
+	 *
+	 * @param key The key.
+	 *
+	 * @return The new, persistent ImmutableMap.
+	 *
+	 * @memberof ImmutableMap
+	 */
+	ImmutableMap *(*removeObjectForKey)(const ImmutableMap *self, const ident key);
+
+	/**
+	 * @fn ImmutableMap *ImmutableMap::setObjectForKey(const ImmutableMap *self, const ident obj, const ident key)
+	 *
+	 * @brief Returns a new version of this ImmutableMap with `obj` stored at `key`.
+	 *
+	 * @param obj The Object.
+	 * @param key The key.
+	 *
+	 * @return The new, persistent ImmutableMap.
+	 *
+	 * @memberof ImmutableMap
+	 */
+	ImmutableMap *(*setObjectForKey)(const ImmutableMap *self, const ident obj, const ident key);
+
+	/**
+	 * @fn ImmutableMap *ImmutableMap::transientCopy(const ImmutableMap *self)
+	 *
+	 * @return A new, transient ImmutableMap with the elements of this ImmutableMap.
+	 *
+	 * @memberof ImmutableMap
+	 */
+	ImmutableMap *(*transientCopy)(const ImmutableMap *self);
+
+	/**
+	 * @fn void ImmutableMap::transientRemoveObjectForKey(ImmutableMap *self, const ident key)
+	 *
+	 * @brief Removes the specified key from this transient ImmutableMap, in place.
+	 *
+	 * @param key The key.
+	 *
+	 * @memberof ImmutableMap
+	 */
+	void (*transientRemoveObjectForKey)(ImmutableMap *self, const ident key);
+
+	/**
+	 * @fn void ImmutableMap::transientSetObjectForKey(ImmutableMap *self, const ident obj, const ident key)
+	 *
+	 * @brief Stores `obj` at `key` in this transient ImmutableMap, in place.
+	 *
+	 * @param obj The Object.
+	 * @param key The key.
+	 *
+	 * @memberof ImmutableMap
+	 */
+	void (*transientSetObjectForKey)(ImmutableMap *self, const ident obj, const ident key);
+};
+
+/**
+ * @brief The ImmutableMap Class.
+ */
+extern Class _ImmutableMap;
@@ -113,6 +113,16 @@ static _Bool isEqual(const Object *self, const Object *other) {
 	return false;
 }
 
+/**
+ * @see Object::sizeInBytes(const Object *)
+ */
+static size_t sizeInBytes(const Object *self) {
+
+	const IndexPath *this = (IndexPath *) self;
+
+	return super(Object, self, sizeInBytes) + this->length * sizeof(int);
+}
+
 #pragma mark - IndexPath
 
 /**
@@ -178,6 +188,7 @@ static void initialize(Class *clazz) {
 	((ObjectInterface *) clazz->interface)->description = description;
 	((ObjectInterface *) clazz->interface)->hash = hash;
 	((ObjectInterface *) clazz->interface)->isEqual = isEqual;
+	((ObjectInterface *) clazz->interface)->sizeInBytes = sizeInBytes;
 
 	((IndexPathInterface *) clazz->interface)->indexAtPosition = indexAtPosition;
 	((IndexPathInterface *) clazz->interface)->initWithIndex = initWithIndex;
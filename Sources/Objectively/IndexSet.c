@@ -27,13 +27,52 @@
 
 #include <Objectively/Hash.h>
 #include <Objectively/IndexSet.h>
+#include <Objectively/MutableIndexSet.h>
 #include <Objectively/MutableString.h>
 
+/**
+ * @brief The count of 64 bit words in a bitmap container.
+ */
+#define INDEXSET_WORDS 1024
+
+/**
+ * @brief A block of words, operated on as a vector.
+ */
+typedef uint64_t Block __attribute__((vector_size(16)));
+
+#define INDEXSET_WORDS_PER_BLOCK (sizeof(Block) / sizeof(uint64_t))
+
+/**
+ * @brief The set operations.
+ */
+typedef enum {
+	OperationIntersect,
+	OperationMinus,
+	OperationUnion,
+} Operation;
+
+/**
+ * @return The unsigned value of `index`, which sorts in the same order as `index`.
+ */
+static inline uint32_t valueForIndex(int index) {
+	return ((uint32_t) index) ^ 0x80000000u;
+}
+
+/**
+ * @return The index of the unsigned `value`.
+ */
+static inline int indexForValue(uint32_t value) {
+	return (int) (value ^ 0x80000000u);
+}
+
 /**
  * @brief qsort comparator for indexes.
  */
 static int compare(const void *a, const void *b) {
-	return (*(int *) a - *(int *) b);
+
+	const int i = *(int *) a, j = *(int *) b;
+
+	return (i > j) - (i < j);
 }
 
 /**
@@ -58,6 +97,656 @@ static size_t compact(int *indexes, size_t count) {
 	return size;
 }
 
+/**
+ * @return The index of the first element of `values` not less than `value`.
+ */
+static size_t lowerBound(const uint16_t *values, size_t length, uint16_t value) {
+
+	size_t low = 0, high = length;
+
+	while (low < high) {
+		const size_t mid = (low + high) >> 1;
+		if (values[mid] < value) {
+			low = mid + 1;
+		} else {
+			high = mid;
+		}
+	}
+
+	return low;
+}
+
+/**
+ * @return The index of the container with `key` in `self`, or where it would be inserted.
+ */
+static size_t indexOfContainer(const IndexSet *self, uint16_t key) {
+
+	size_t low = 0, high = self->containerCount;
+
+	while (low < high) {
+		const size_t mid = (low + high) >> 1;
+		if (self->containers[mid].key < key) {
+			low = mid + 1;
+		} else {
+			high = mid;
+		}
+	}
+
+	return low;
+}
+
+/**
+ * @brief Allocates storage for `capacity` values, words or runs in `container`.
+ */
+static void allocContainer(IndexSetContainer *container, uint16_t key, IndexSetContainerType type, uint32_t capacity) {
+
+	memset(container, 0, sizeof(*container));
+
+	container->key = key;
+	container->type = type;
+
+	switch (type) {
+		case IndexSetContainerArray:
+			container->capacity = max(capacity, 1u);
+			container->values = malloc(container->capacity * sizeof(uint16_t));
+			break;
+		case IndexSetContainerBitmap:
+			container->capacity = INDEXSET_WORDS;
+			container->words = calloc(INDEXSET_WORDS, sizeof(uint64_t));
+			break;
+		case IndexSetContainerRun:
+			container->capacity = max(capacity, 1u);
+			container->runs = malloc(container->capacity * sizeof(IndexSetRun));
+			break;
+	}
+
+	assert(container->values);
+}
+
+/**
+ * @brief Copies `src` to `dest`, duplicating its storage.
+ */
+static void copyContainer(IndexSetContainer *dest, const IndexSetContainer *src) {
+
+	allocContainer(dest, src->key, src->type, src->length);
+
+	switch (src->type) {
+		case IndexSetContainerArray:
+			memcpy(dest->values, src->values, src->length * sizeof(uint16_t));
+			break;
+		case IndexSetContainerBitmap:
+			memcpy(dest->words, src->words, INDEXSET_WORDS * sizeof(uint64_t));
+			break;
+		case IndexSetContainerRun:
+			memcpy(dest->runs, src->runs, src->length * sizeof(IndexSetRun));
+			break;
+	}
+
+	dest->cardinality = src->cardinality;
+	dest->length = src->length;
+}
+
+/**
+ * @return True if `container` contains the low 16 bits `value`.
+ */
+static _Bool containerContains(const IndexSetContainer *container, uint16_t value) {
+
+	switch (container->type) {
+		case IndexSetContainerArray: {
+			const size_t i = lowerBound(container->values, container->length, value);
+			return i < container->length && container->values[i] == value;
+		}
+		case IndexSetContainerBitmap:
+			return (container->words[value >> 6] >> (value & 63)) & 1;
+		case IndexSetContainerRun: {
+			size_t low = 0, high = container->length;
+			while (low < high) {
+				const size_t mid = (low + high) >> 1;
+				if (container->runs[mid].start <= value) {
+					low = mid + 1;
+				} else {
+					high = mid;
+				}
+			}
+			return low && value - container->runs[low - 1].start <= container->runs[low - 1].length;
+		}
+	}
+
+	return false;
+}
+
+/**
+ * @brief Sets the bits of the values in `first` through `last`, inclusive, in `words`.
+ */
+static void fillWords(uint64_t *words, uint32_t first, uint32_t last) {
+
+	const uint32_t firstWord = first >> 6, lastWord = last >> 6;
+
+	const uint64_t firstMask = ~0ull << (first & 63);
+	const uint64_t lastMask = ~0ull >> (63 - (last & 63));
+
+	if (firstWord == lastWord) {
+		words[firstWord] |= firstMask & lastMask;
+	} else {
+		words[firstWord] |= firstMask;
+		for (uint32_t i = firstWord + 1; i < lastWord; i++) {
+			words[i] = ~0ull;
+		}
+		words[lastWord] |= lastMask;
+	}
+}
+
+/**
+ * @brief Writes the bitmap of `container` to `words`.
+ */
+static void containerWords(const IndexSetContainer *container, uint64_t *words) {
+
+	switch (container->type) {
+		case IndexSetContainerArray:
+			memset(words, 0, INDEXSET_WORDS * sizeof(uint64_t));
+			for (uint32_t i = 0; i < container->length; i++) {
+				words[container->values[i] >> 6] |= 1ull << (container->values[i] & 63);
+			}
+			break;
+		case IndexSetContainerBitmap:
+			memcpy(words, container->words, INDEXSET_WORDS * sizeof(uint64_t));
+			break;
+		case IndexSetContainerRun:
+			memset(words, 0, INDEXSET_WORDS * sizeof(uint64_t));
+			for (uint32_t i = 0; i < container->length; i++) {
+				const IndexSetRun run = container->runs[i];
+				fillWords(words, run.start, run.start + run.length);
+			}
+			break;
+	}
+}
+
+/**
+ * @brief Initializes `container` from `words`, choosing its smallest representation.
+ *
+ * @return The cardinality of the container, which is not initialized if it is zero.
+ */
+static uint32_t containerWithWords(IndexSetContainer *container, uint16_t key, const uint64_t *words) {
+
+	uint32_t cardinality = 0, runs = 0;
+	uint64_t carry = 0;
+
+	for (size_t i = 0; i < INDEXSET_WORDS; i++) {
+		const uint64_t word = words[i];
+		cardinality += __builtin_popcountll(word);
+		runs += __builtin_popcountll(word & ~((word << 1) | carry));
+		carry = word >> 63;
+	}
+
+	if (cardinality == 0) {
+		return 0;
+	}
+
+	const size_t arrayBytes = cardinality * sizeof(uint16_t);
+	const size_t runBytes = runs * sizeof(IndexSetRun);
+	const size_t bitmapBytes = INDEXSET_WORDS * sizeof(uint64_t);
+
+	if (runBytes < min(arrayBytes, bitmapBytes)) {
+
+		allocContainer(container, key, IndexSetContainerRun, runs);
+
+		uint32_t value = 0;
+		while (value < 65536) {
+
+			const uint64_t word = words[value >> 6] >> (value & 63);
+			if (word == 0) {
+				value = (value | 63) + 1;
+				continue;
+			}
+
+			value += __builtin_ctzll(word);
+
+			const uint32_t start = value;
+			while (value < 65536 && ((words[value >> 6] >> (value & 63)) & 1)) {
+				const uint64_t ones = ~(words[value >> 6] >> (value & 63));
+				value += ones ? __builtin_ctzll(ones) : 64 - (value & 63);
+			}
+
+			container->runs[container->length++] = (IndexSetRun) {
+				.start = start,
+				.length = value - start - 1
+			};
+		}
+
+	} else if (cardinality <= INDEXSET_ARRAY_MAX) {
+
+		allocContainer(container, key, IndexSetContainerArray, cardinality);
+
+		for (uint32_t i = 0; i < INDEXSET_WORDS; i++) {
+			uint64_t word = words[i];
+			while (word) {
+				container->values[container->length++] = (i << 6) | __builtin_ctzll(word);
+				word &= word - 1;
+			}
+		}
+
+	} else {
+
+		allocContainer(container, key, IndexSetContainerBitmap, INDEXSET_WORDS);
+
+		memcpy(container->words, words, INDEXSET_WORDS * sizeof(uint64_t));
+	}
+
+	container->cardinality = cardinality;
+	return cardinality;
+}
+
+/**
+ * @brief Initializes `container` from the sorted, unique `values`.
+ */
+static void containerWithValues(IndexSetContainer *container, uint16_t key, const uint16_t *values, uint32_t count) {
+
+	uint32_t runs = count ? 1 : 0;
+	for (uint32_t i = 1; i < count; i++) {
+		if (values[i] != values[i - 1] + 1) {
+			runs++;
+		}
+	}
+
+	if (count <= INDEXSET_ARRAY_MAX && runs * sizeof(IndexSetRun) >= count * sizeof(uint16_t)) {
+
+		allocContainer(container, key, IndexSetContainerArray, count);
+
+		memcpy(container->values, values, count * sizeof(uint16_t));
+
+		container->length = count;
+		container->cardinality = count;
+
+	} else {
+
+		uint64_t words[INDEXSET_WORDS] = { 0 };
+
+		for (uint32_t i = 0; i < count; i++) {
+			words[values[i] >> 6] |= 1ull << (values[i] & 63);
+		}
+
+		containerWithWords(container, key, words);
+	}
+}
+
+/**
+ * @brief Combines the words of `a` and `b` into `out`, a block at a time.
+ */
+static void combineWords(Operation operation, uint64_t *out, const uint64_t *a, const uint64_t *b) {
+
+	for (size_t i = 0; i < INDEXSET_WORDS; i += INDEXSET_WORDS_PER_BLOCK) {
+
+		Block x, y;
+
+		memcpy(&x, a + i, sizeof(x));
+		memcpy(&y, b + i, sizeof(y));
+
+		switch (operation) {
+			case OperationIntersect:
+				x &= y;
+				break;
+			case OperationMinus:
+				x &= ~y;
+				break;
+			case OperationUnion:
+				x |= y;
+				break;
+		}
+
+		memcpy(out + i, &x, sizeof(x));
+	}
+}
+
+/**
+ * @brief Combines the array containers `a` and `b` by merging their values.
+ *
+ * @return The cardinality of `out`, which is not initialized if it is zero.
+ */
+static uint32_t combineArrays(Operation operation, IndexSetContainer *out,
+		const IndexSetContainer *a, const IndexSetContainer *b) {
+
+	uint16_t values[INDEXSET_ARRAY_MAX * 2];
+	uint32_t count = 0, i = 0, j = 0;
+
+	while (i < a->length && j < b->length) {
+
+		const uint16_t x = a->values[i], y = b->values[j];
+
+		if (x < y) {
+			if (operation != OperationIntersect) {
+				values[count++] = x;
+			}
+			i++;
+		} else if (x > y) {
+			if (operation == OperationUnion) {
+				values[count++] = y;
+			}
+			j++;
+		} else {
+			if (operation != OperationMinus) {
+				values[count++] = x;
+			}
+			i++, j++;
+		}
+	}
+
+	if (operation != OperationIntersect) {
+		while (i < a->length) {
+			values[count++] = a->values[i++];
+		}
+	}
+
+	if (operation == OperationUnion) {
+		while (j < b->length) {
+			values[count++] = b->values[j++];
+		}
+	}
+
+	if (count) {
+		containerWithValues(out, a->key, values, count);
+	}
+
+	return count;
+}
+
+/**
+ * @brief Filters the array container `a` by membership in `b`.
+ *
+ * @return The cardinality of `out`, which is not initialized if it is zero.
+ */
+static uint32_t filterArray(Operation operation, IndexSetContainer *out,
+		const IndexSetContainer *a, const IndexSetContainer *b) {
+
+	uint16_t values[INDEXSET_ARRAY_MAX];
+	uint32_t count = 0;
+
+	const _Bool keep = operation == OperationIntersect;
+
+	for (uint32_t i = 0; i < a->length; i++) {
+		if (containerContains(b, a->values[i]) == keep) {
+			values[count++] = a->values[i];
+		}
+	}
+
+	if (count) {
+		containerWithValues(out, a->key, values, count);
+	}
+
+	return count;
+}
+
+/**
+ * @brief Combines the containers `a` and `b`, which share their key, into `out`.
+ *
+ * @return The cardinality of `out`, which is not initialized if it is zero.
+ */
+static uint32_t combineContainers(Operation operation, IndexSetContainer *out,
+		const IndexSetContainer *a, const IndexSetContainer *b) {
+
+	if (a->type == IndexSetContainerArray) {
+		if (b->type == IndexSetContainerArray) {
+			return combineArrays(operation, out, a, b);
+		} else if (operation != OperationUnion) {
+			return filterArray(operation, out, a, b);
+		}
+	} else if (b->type == IndexSetContainerArray && operation == OperationIntersect) {
+		return filterArray(operation, out, b, a);
+	}
+
+	uint64_t x[INDEXSET_WORDS], y[INDEXSET_WORDS];
+
+	containerWords(a, x);
+	containerWords(b, y);
+
+	combineWords(operation, x, x, y);
+
+	return containerWithWords(out, a->key, x);
+}
+
+/**
+ * @return A new IndexSet combining `a` and `b` with `operation`.
+ */
+static IndexSet *combineIndexSets(Operation operation, const IndexSet *a, const IndexSet *b) {
+
+	IndexSet *result = alloc(IndexSet, init);
+	if (result == NULL) {
+		return NULL;
+	}
+
+	const size_t capacity = a->containerCount + (operation == OperationUnion ? b->containerCount : 0);
+	if (capacity == 0) {
+		return result;
+	}
+
+	result->containers = calloc(capacity, sizeof(IndexSetContainer));
+	assert(result->containers);
+
+	size_t i = 0, j = 0;
+
+	while (i < a->containerCount || j < b->containerCount) {
+
+		const IndexSetContainer *x = i < a->containerCount ? &a->containers[i] : NULL;
+		const IndexSetContainer *y = j < b->containerCount ? &b->containers[j] : NULL;
+
+		if (x == NULL && operation != OperationUnion) {
+			break;
+		}
+
+		if (y == NULL && operation == OperationIntersect) {
+			break;
+		}
+
+		IndexSetContainer *out = &result->containers[result->containerCount];
+		uint32_t cardinality = 0;
+
+		if (x && (y == NULL || x->key < y->key)) {
+			if (operation != OperationIntersect) {
+				copyContainer(out, x);
+				cardinality = out->cardinality;
+			}
+			i++;
+		} else if (y && (x == NULL || y->key < x->key)) {
+			if (operation == OperationUnion) {
+				copyContainer(out, y);
+				cardinality = out->cardinality;
+			}
+			j++;
+		} else {
+			cardinality = combineContainers(operation, out, x, y);
+			i++, j++;
+		}
+
+		if (cardinality) {
+			result->containerCount++;
+			result->count += cardinality;
+		}
+	}
+
+	return result;
+}
+
+/**
+ * @brief Accumulates maximal ranges of consecutive values for IndexSet::enumerateRanges.
+ */
+typedef struct {
+	const IndexSet *indexSet;
+	IndexSetRangeEnumerator enumerator;
+	ident data;
+	uint32_t first;
+	uint32_t last;
+	_Bool isPending;
+} RangeAccumulator;
+
+/**
+ * @brief Flushes the pending range of `accumulator`.
+ *
+ * @return True if the enumeration was stopped.
+ */
+static _Bool flushRange(RangeAccumulator *accumulator) {
+
+	if (accumulator->isPending) {
+		accumulator->isPending = false;
+
+		const Range range = {
+			.location = indexForValue(accumulator->first),
+			.length = accumulator->last - accumulator->first + 1
+		};
+
+		return accumulator->enumerator(accumulator->indexSet, range, accumulator->data);
+	}
+
+	return false;
+}
+
+/**
+ * @brief Accumulates the values `first` through `last`, inclusive.
+ *
+ * @return True if the enumeration was stopped.
+ */
+static _Bool accumulateRange(RangeAccumulator *accumulator, uint32_t first, uint32_t last) {
+
+	if (accumulator->isPending && first == accumulator->last + 1) {
+		accumulator->last = last;
+		return false;
+	}
+
+	if (flushRange(accumulator)) {
+		return true;
+	}
+
+	accumulator->first = first;
+	accumulator->last = last;
+	accumulator->isPending = true;
+
+	return false;
+}
+
+/**
+ * @brief Accumulates the ranges of `container`.
+ *
+ * @return True if the enumeration was stopped.
+ */
+static _Bool accumulateContainer(RangeAccumulator *accumulator, const IndexSetContainer *container) {
+
+	const uint32_t base = ((uint32_t) container->key) << 16;
+
+	switch (container->type) {
+		case IndexSetContainerArray:
+			for (uint32_t i = 0; i < container->length; i++) {
+				const uint32_t value = base | container->values[i];
+				if (accumulateRange(accumulator, value, value)) {
+					return true;
+				}
+			}
+			break;
+
+		case IndexSetContainerBitmap:
+			for (uint32_t i = 0; i < INDEXSET_WORDS; i++) {
+				uint64_t word = container->words[i];
+				while (word) {
+					const uint32_t first = __builtin_ctzll(word);
+					const uint64_t rest = ~word & (~0ull << first);
+					const uint32_t last = rest ? __builtin_ctzll(rest) - 1 : 63;
+
+					if (accumulateRange(accumulator, base | (i << 6) | first, base | (i << 6) | last)) {
+						return true;
+					}
+
+					word = last == 63 ? 0 : word & (~0ull << (last + 1));
+				}
+			}
+			break;
+
+		case IndexSetContainerRun:
+			for (uint32_t i = 0; i < container->length; i++) {
+				const IndexSetRun run = container->runs[i];
+				if (accumulateRange(accumulator, base | run.start, (base | run.start) + run.length)) {
+					return true;
+				}
+			}
+			break;
+	}
+
+	return false;
+}
+
+/**
+ * @return The count of values from `first` through `last`, inclusive, in `container`.
+ */
+static uint32_t containerCountInRange(const IndexSetContainer *container, uint16_t first, uint16_t last) {
+
+	if (first == 0 && last == 0xffff) {
+		return container->cardinality;
+	}
+
+	switch (container->type) {
+		case IndexSetContainerArray: {
+			const size_t begin = lowerBound(container->values, container->length, first);
+			const size_t end = last == 0xffff ? container->length : lowerBound(container->values, container->length, last + 1);
+			return end - begin;
+		}
+
+		case IndexSetContainerBitmap: {
+			const uint32_t firstWord = first >> 6, lastWord = last >> 6;
+
+			const uint64_t firstMask = ~0ull << (first & 63);
+			const uint64_t lastMask = ~0ull >> (63 - (last & 63));
+
+			if (firstWord == lastWord) {
+				return __builtin_popcountll(container->words[firstWord] & firstMask & lastMask);
+			}
+
+			uint32_t count = __builtin_popcountll(container->words[firstWord] & firstMask);
+			for (uint32_t i = firstWord + 1; i < lastWord; i++) {
+				count += __builtin_popcountll(container->words[i]);
+			}
+			return count + __builtin_popcountll(container->words[lastWord] & lastMask);
+		}
+
+		case IndexSetContainerRun: {
+			uint32_t count = 0;
+			for (uint32_t i = 0; i < container->length; i++) {
+				const uint32_t start = container->runs[i].start;
+				const uint32_t end = start + container->runs[i].length;
+				if (start <= last && end >= first) {
+					count += min(end, (uint32_t) last) - max(start, (uint32_t) first) + 1;
+				}
+			}
+			return count;
+		}
+	}
+
+	return 0;
+}
+
+/**
+ * @return True if the containers contain the same values.
+ */
+static _Bool containersAreEqual(const IndexSetContainer *a, const IndexSetContainer *b) {
+
+	if (a->key != b->key || a->cardinality != b->cardinality) {
+		return false;
+	}
+
+	if (a->type == b->type) {
+		switch (a->type) {
+			case IndexSetContainerArray:
+				return memcmp(a->values, b->values, a->length * sizeof(uint16_t)) == 0;
+			case IndexSetContainerBitmap:
+				return memcmp(a->words, b->words, INDEXSET_WORDS * sizeof(uint64_t)) == 0;
+			case IndexSetContainerRun:
+				return a->length == b->length && memcmp(a->runs, b->runs, a->length * sizeof(IndexSetRun)) == 0;
+		}
+	}
+
+	uint64_t x[INDEXSET_WORDS], y[INDEXSET_WORDS];
+
+	containerWords(a, x);
+	containerWords(b, y);
+
+	return memcmp(x, y, sizeof(x)) == 0;
+}
+
 #define _Class _IndexSet
 
 #pragma mark - Object
@@ -68,7 +757,7 @@ static size_t compact(int *indexes, size_t count) {
 static Object *copy(const Object *self) {
 
 	IndexSet *this = (IndexSet *) self;
-	IndexSet *that = alloc(IndexSet, initWithIndexes, this->indexes, this->count);
+	IndexSet *that = alloc(IndexSet, initWithIndexSet, this);
 
 	return (Object *) that;
 }
@@ -80,11 +769,30 @@ static void dealloc(Object *self) {
 	
 	IndexSet *this = (IndexSet *) self;
 
-	free(this->indexes);
+	for (size_t i = 0; i < this->containerCount; i++) {
+		free(this->containers[i].values);
+	}
+
+	free(this->containers);
 	
 	super(Object, self, dealloc);
 }
 
+/**
+ * @brief IndexSetEnumerator for description.
+ */
+static _Bool description_enumerator(const IndexSet *indexSet, int index, ident data) {
+
+	MutableString *desc = (MutableString *) data;
+
+	if (((String *) desc)->length > 1) {
+		$(desc, appendCharacters, ", ");
+	}
+
+	$(desc, appendFormat, "%d", index);
+	return false;
+}
+
 /**
  * @see Object::description(const Object *)
  */
@@ -93,17 +801,25 @@ static String *description(const Object *self) {
 	const IndexSet *this = (IndexSet *) self;
 	MutableString *desc = mstr("[");
 
-	for (size_t i = 0; i < this->count; i++) {
-		$(desc, appendFormat, "%d", this->indexes[i]);
-		if (i < this->count - 1) {
-			$(desc, appendCharacters, ", ");
-		}
-	}
+	$(this, enumerateIndexes, description_enumerator, desc);
 
 	$(desc, appendCharacters, "]");
 	return (String *) desc;
 }
 
+/**
+ * @brief IndexSetRangeEnumerator for hash.
+ */
+static _Bool hash_enumerator(const IndexSet *indexSet, const Range range, ident data) {
+
+	int *hash = data;
+
+	*hash = HashForInteger(*hash, range.location);
+	*hash = HashForInteger(*hash, range.length);
+
+	return false;
+}
+
 /**
  * @see Object::hash(const Object *)
  */
@@ -113,9 +829,7 @@ static int hash(const Object *self) {
 
 	const IndexSet *this = (IndexSet *) self;
 
-	for (size_t i = 0; i < this->count; i++) {
-		hash = HashForInteger(hash, this->indexes[i]);
-	}
+	$(this, enumerateRanges, hash_enumerator, &hash);
 
 	return hash;
 }
@@ -134,14 +848,49 @@ static _Bool isEqual(const Object *self, const Object *other) {
 		const IndexSet *this = (IndexSet *) self;
 		const IndexSet *that = (IndexSet *) other;
 
-		if (this->count == that->count) {
-			return memcmp(this->indexes, that->indexes, this->count * sizeof(int)) == 0;
+		if (this->count == that->count && this->containerCount == that->containerCount) {
+
+			for (size_t i = 0; i < this->containerCount; i++) {
+				if (containersAreEqual(&this->containers[i], &that->containers[i]) == false) {
+					return false;
+				}
+			}
+
+			return true;
 		}
 	}
 
 	return false;
 }
 
+/**
+ * @see Object::sizeInBytes(const Object *)
+ */
+static size_t sizeInBytes(const Object *self) {
+
+	const IndexSet *this = (IndexSet *) self;
+
+	size_t size = super(Object, self, sizeInBytes) + this->containerCount * sizeof(IndexSetContainer);
+
+	for (size_t i = 0; i < this->containerCount; i++) {
+
+		const IndexSetContainer *container = &this->containers[i];
+		switch (container->type) {
+			case IndexSetContainerArray:
+				size += container->capacity * sizeof(uint16_t);
+				break;
+			case IndexSetContainerBitmap:
+				size += INDEXSET_WORDS * sizeof(uint64_t);
+				break;
+			case IndexSetContainerRun:
+				size += container->capacity * sizeof(IndexSetRun);
+				break;
+		}
+	}
+
+	return size;
+}
+
 #pragma mark - IndexSet
 
 /**
@@ -151,8 +900,67 @@ static _Bool isEqual(const Object *self, const Object *other) {
  */
 static _Bool containsIndex(const IndexSet *self, int index) {
 
-	for (size_t i = 0; i < self->count; i++) {
-		if (self->indexes[i] == index) {
+	const uint32_t value = valueForIndex(index);
+
+	const size_t i = indexOfContainer(self, value >> 16);
+	if (i < self->containerCount && self->containers[i].key == value >> 16) {
+		return containerContains(&self->containers[i], value & 0xffff);
+	}
+
+	return false;
+}
+
+/**
+ * @fn size_t IndexSet::countOfIndexesInRange(const IndexSet *self, const Range range)
+ *
+ * @memberof IndexSet
+ */
+static size_t countOfIndexesInRange(const IndexSet *self, const Range range) {
+
+	if (range.length <= 0) {
+		return 0;
+	}
+
+	const uint32_t first = valueForIndex(range.location);
+	const uint32_t last = first + (uint32_t) (range.length - 1);
+
+	assert(last >= first);
+
+	size_t count = 0;
+
+	for (size_t i = indexOfContainer(self, first >> 16); i < self->containerCount; i++) {
+
+		const IndexSetContainer *container = &self->containers[i];
+		if (container->key > last >> 16) {
+			break;
+		}
+
+		const uint16_t low = container->key == first >> 16 ? first & 0xffff : 0;
+		const uint16_t high = container->key == last >> 16 ? last & 0xffff : 0xffff;
+
+		count += containerCountInRange(container, low, high);
+	}
+
+	return count;
+}
+
+/**
+ * @brief The context of IndexSet::enumerateIndexes.
+ */
+typedef struct {
+	IndexSetEnumerator enumerator;
+	ident data;
+} EnumerateIndexes;
+
+/**
+ * @brief IndexSetRangeEnumerator for enumerateIndexes.
+ */
+static _Bool enumerateIndexes_enumerator(const IndexSet *indexSet, const Range range, ident data) {
+
+	const EnumerateIndexes *context = data;
+
+	for (int i = 0; i < range.length; i++) {
+		if (context->enumerator(indexSet, range.location + i, context->data)) {
 			return true;
 		}
 	}
@@ -160,6 +968,122 @@ static _Bool containsIndex(const IndexSet *self, int index) {
 	return false;
 }
 
+/**
+ * @fn void IndexSet::enumerateIndexes(const IndexSet *self, IndexSetEnumerator enumerator, ident data)
+ *
+ * @memberof IndexSet
+ */
+static void enumerateIndexes(const IndexSet *self, IndexSetEnumerator enumerator, ident data) {
+
+	assert(enumerator);
+
+	EnumerateIndexes context = {
+		.enumerator = enumerator,
+		.data = data
+	};
+
+	$(self, enumerateRanges, enumerateIndexes_enumerator, &context);
+}
+
+/**
+ * @fn void IndexSet::enumerateRanges(const IndexSet *self, IndexSetRangeEnumerator enumerator, ident data)
+ *
+ * @memberof IndexSet
+ */
+static void enumerateRanges(const IndexSet *self, IndexSetRangeEnumerator enumerator, ident data) {
+
+	assert(enumerator);
+
+	RangeAccumulator accumulator = {
+		.indexSet = self,
+		.enumerator = enumerator,
+		.data = data
+	};
+
+	for (size_t i = 0; i < self->containerCount; i++) {
+		if (accumulateContainer(&accumulator, &self->containers[i])) {
+			return;
+		}
+	}
+
+	flushRange(&accumulator);
+}
+
+/**
+ * @fn int IndexSet::firstIndex(const IndexSet *self)
+ *
+ * @memberof IndexSet
+ */
+static int firstIndex(const IndexSet *self) {
+
+	assert(self->count);
+
+	const IndexSetContainer *container = &self->containers[0];
+	const uint32_t base = ((uint32_t) container->key) << 16;
+
+	switch (container->type) {
+		case IndexSetContainerArray:
+			return indexForValue(base | container->values[0]);
+		case IndexSetContainerRun:
+			return indexForValue(base | container->runs[0].start);
+		case IndexSetContainerBitmap:
+			for (uint32_t i = 0; i < INDEXSET_WORDS; i++) {
+				if (container->words[i]) {
+					return indexForValue(base | (i << 6) | __builtin_ctzll(container->words[i]));
+				}
+			}
+			break;
+	}
+
+	assert(false);
+	return 0;
+}
+
+/**
+ * @fn IndexSet *IndexSet::indexSetByIntersectingIndexSet(const IndexSet *self, const IndexSet *indexSet)
+ *
+ * @memberof IndexSet
+ */
+static IndexSet *indexSetByIntersectingIndexSet(const IndexSet *self, const IndexSet *indexSet) {
+
+	assert(indexSet);
+
+	return combineIndexSets(OperationIntersect, self, indexSet);
+}
+
+/**
+ * @fn IndexSet *IndexSet::indexSetBySubtractingIndexSet(const IndexSet *self, const IndexSet *indexSet)
+ *
+ * @memberof IndexSet
+ */
+static IndexSet *indexSetBySubtractingIndexSet(const IndexSet *self, const IndexSet *indexSet) {
+
+	assert(indexSet);
+
+	return combineIndexSets(OperationMinus, self, indexSet);
+}
+
+/**
+ * @fn IndexSet *IndexSet::indexSetByUnioningIndexSet(const IndexSet *self, const IndexSet *indexSet)
+ *
+ * @memberof IndexSet
+ */
+static IndexSet *indexSetByUnioningIndexSet(const IndexSet *self, const IndexSet *indexSet) {
+
+	assert(indexSet);
+
+	return combineIndexSets(OperationUnion, self, indexSet);
+}
+
+/**
+ * @fn IndexSet *IndexSet::init(IndexSet *self)
+ *
+ * @memberof IndexSet
+ */
+static IndexSet *init(IndexSet *self) {
+	return (IndexSet *) super(Object, self, init);
+}
+
 /**
  * @fn IndexSet *IndexSet::initWithIndex(IndexSet *self, int index)
  *
@@ -172,33 +1096,157 @@ static IndexSet *initWithIndex(IndexSet *self, int index) {
 /**
  * @fn IndexSet *IndexSet::initWithIndexes(IndexSet *self, int *indexes, size_t count)
  *
- * @brief Initializes this IndexSet with the specified indexes and count.
- *
- * @param indexes The indexes.
- * @param count The count of `indexes`.
- *
- * @return The intialized IndexSet, or `NULL` on error.
- *
  * @memberof IndexSet
  */
 static IndexSet *initWithIndexes(IndexSet *self, int *indexes, size_t count) {
 	
-	self = (IndexSet *) super(Object, self, init);
+	self = $(self, init);
 	if (self) {
 
 		self->count = compact(indexes, count);
 		if (self->count) {
 
-			self->indexes = calloc(sizeof(int), self->count);
-			assert(self->indexes);
+			const size_t capacity = (valueForIndex(indexes[self->count - 1]) >> 16) - (valueForIndex(indexes[0]) >> 16) + 1;
+
+			self->containers = calloc(min(capacity, self->count), sizeof(IndexSetContainer));
+			assert(self->containers);
+
+			uint16_t *values = malloc(min(self->count, (size_t) 65536) * sizeof(uint16_t));
+			assert(values);
+
+			size_t i = 0;
+			while (i < self->count) {
+
+				const uint16_t key = valueForIndex(indexes[i]) >> 16;
 
-			memcpy(self->indexes, indexes, sizeof(int) * self->count);
+				uint32_t length = 0;
+				while (i < self->count && valueForIndex(indexes[i]) >> 16 == key) {
+					values[length++] = valueForIndex(indexes[i++]) & 0xffff;
+				}
+
+				containerWithValues(&self->containers[self->containerCount++], key, values, length);
+			}
+
+			free(values);
 		}
 	}
 	
 	return self;
 }
 
+/**
+ * @fn IndexSet *IndexSet::initWithIndexesInRange(IndexSet *self, const Range range)
+ *
+ * @memberof IndexSet
+ */
+static IndexSet *initWithIndexesInRange(IndexSet *self, const Range range) {
+
+	self = $(self, init);
+	if (self && range.length > 0) {
+
+		const uint32_t first = valueForIndex(range.location);
+		const uint32_t last = first + (uint32_t) (range.length - 1);
+
+		assert(last >= first);
+
+		self->containers = calloc((last >> 16) - (first >> 16) + 1, sizeof(IndexSetContainer));
+		assert(self->containers);
+
+		for (uint32_t key = first >> 16; key <= last >> 16; key++) {
+
+			const uint16_t low = key == first >> 16 ? first & 0xffff : 0;
+			const uint16_t high = key == last >> 16 ? last & 0xffff : 0xffff;
+
+			IndexSetContainer *container = &self->containers[self->containerCount++];
+
+			allocContainer(container, key, IndexSetContainerRun, 1);
+
+			container->runs[0] = (IndexSetRun) {
+				.start = low,
+				.length = high - low
+			};
+
+			container->length = 1;
+			container->cardinality = high - low + 1;
+		}
+
+		self->count = range.length;
+	}
+
+	return self;
+}
+
+/**
+ * @fn IndexSet *IndexSet::initWithIndexSet(IndexSet *self, const IndexSet *indexSet)
+ *
+ * @memberof IndexSet
+ */
+static IndexSet *initWithIndexSet(IndexSet *self, const IndexSet *indexSet) {
+
+	self = $(self, init);
+	if (self && indexSet && indexSet->containerCount) {
+
+		self->containers = calloc(indexSet->containerCount, sizeof(IndexSetContainer));
+		assert(self->containers);
+
+		for (size_t i = 0; i < indexSet->containerCount; i++) {
+			copyContainer(&self->containers[i], &indexSet->containers[i]);
+		}
+
+		self->containerCount = indexSet->containerCount;
+		self->count = indexSet->count;
+	}
+
+	return self;
+}
+
+/**
+ * @fn int IndexSet::lastIndex(const IndexSet *self)
+ *
+ * @memberof IndexSet
+ */
+static int lastIndex(const IndexSet *self) {
+
+	assert(self->count);
+
+	const IndexSetContainer *container = &self->containers[self->containerCount - 1];
+	const uint32_t base = ((uint32_t) container->key) << 16;
+
+	switch (container->type) {
+		case IndexSetContainerArray:
+			return indexForValue(base | container->values[container->length - 1]);
+		case IndexSetContainerRun: {
+			const IndexSetRun run = container->runs[container->length - 1];
+			return indexForValue((base | run.start) + run.length);
+		}
+		case IndexSetContainerBitmap:
+			for (uint32_t i = INDEXSET_WORDS; i > 0; i--) {
+				if (container->words[i - 1]) {
+					return indexForValue(base | ((i - 1) << 6) | (63 - __builtin_clzll(container->words[i - 1])));
+				}
+			}
+			break;
+	}
+
+	assert(false);
+	return 0;
+}
+
+/**
+ * @fn MutableIndexSet *IndexSet::mutableCopy(const IndexSet *self)
+ *
+ * @memberof IndexSet
+ */
+static MutableIndexSet *mutableCopy(const IndexSet *self) {
+
+	MutableIndexSet *copy = alloc(MutableIndexSet, init);
+	if (copy) {
+		$(copy, unionWithIndexSet, self);
+	}
+
+	return copy;
+}
+
 #pragma mark - Class lifecycle
 
 /**
@@ -211,10 +1259,23 @@ static void initialize(Class *clazz) {
 	((ObjectInterface *) clazz->interface)->description = description;
 	((ObjectInterface *) clazz->interface)->hash = hash;
 	((ObjectInterface *) clazz->interface)->isEqual = isEqual;
+	((ObjectInterface *) clazz->interface)->sizeInBytes = sizeInBytes;
 
 	((IndexSetInterface *) clazz->interface)->containsIndex = containsIndex;
+	((IndexSetInterface *) clazz->interface)->countOfIndexesInRange = countOfIndexesInRange;
+	((IndexSetInterface *) clazz->interface)->enumerateIndexes = enumerateIndexes;
+	((IndexSetInterface *) clazz->interface)->enumerateRanges = enumerateRanges;
+	((IndexSetInterface *) clazz->interface)->firstIndex = firstIndex;
+	((IndexSetInterface *) clazz->interface)->indexSetByIntersectingIndexSet = indexSetByIntersectingIndexSet;
+	((IndexSetInterface *) clazz->interface)->indexSetBySubtractingIndexSet = indexSetBySubtractingIndexSet;
+	((IndexSetInterface *) clazz->interface)->indexSetByUnioningIndexSet = indexSetByUnioningIndexSet;
+	((IndexSetInterface *) clazz->interface)->init = init;
 	((IndexSetInterface *) clazz->interface)->initWithIndex = initWithIndex;
 	((IndexSetInterface *) clazz->interface)->initWithIndexes = initWithIndexes;
+	((IndexSetInterface *) clazz->interface)->initWithIndexesInRange = initWithIndexesInRange;
+	((IndexSetInterface *) clazz->interface)->initWithIndexSet = initWithIndexSet;
+	((IndexSetInterface *) clazz->interface)->lastIndex = lastIndex;
+	((IndexSetInterface *) clazz->interface)->mutableCopy = mutableCopy;
 }
 
 Class _IndexSet = {
@@ -227,4 +1288,3 @@ Class _IndexSet = {
 };
 
 #undef _Class
-
@@ -34,9 +34,122 @@
 typedef struct IndexSet IndexSet;
 typedef struct IndexSetInterface IndexSetInterface;
 
+typedef struct MutableIndexSet MutableIndexSet;
+
+/**
+ * @brief The container types of an IndexSet.
+ */
+typedef enum {
+
+	/**
+	 * @brief A sorted array of up to `INDEXSET_ARRAY_MAX` values.
+	 */
+	IndexSetContainerArray,
+
+	/**
+	 * @brief A bitmap of all 65536 values.
+	 */
+	IndexSetContainerBitmap,
+
+	/**
+	 * @brief A sorted array of runs of consecutive values.
+	 */
+	IndexSetContainerRun,
+} IndexSetContainerType;
+
+/**
+ * @brief The maximum cardinality of an array container.
+ */
+#define INDEXSET_ARRAY_MAX 4096
+
+/**
+ * @brief A run of consecutive values within a container.
+ */
+typedef struct {
+
+	/**
+	 * @brief The first value.
+	 */
+	uint16_t start;
+
+	/**
+	 * @brief The count of values, less one.
+	 */
+	uint16_t length;
+} IndexSetRun;
+
+/**
+ * @brief The indexes of an IndexSet which share their high 16 bits.
+ *
+ * @private
+ */
+typedef struct {
+
+	/**
+	 * @brief The high 16 bits of the indexes in this container.
+	 */
+	uint16_t key;
+
+	/**
+	 * @brief The IndexSetContainerType.
+	 */
+	uint16_t type;
+
+	/**
+	 * @brief The count of indexes in this container.
+	 */
+	uint32_t cardinality;
+
+	/**
+	 * @brief The count of values or runs, for array and run containers.
+	 */
+	uint32_t length;
+
+	/**
+	 * @brief The capacity of values or runs, for array and run containers.
+	 */
+	uint32_t capacity;
+
+	/**
+	 * @brief The values, words or runs.
+	 */
+	union {
+		uint16_t *values;
+		uint64_t *words;
+		IndexSetRun *runs;
+	};
+} IndexSetContainer;
+
+/**
+ * @brief A function pointer for IndexSet enumeration (iteration) of indexes.
+ *
+ * @param indexSet The IndexSet.
+ * @param index The index for the current iteration.
+ * @param data User data.
+ *
+ * @return True to stop enumeration, false to continue.
+ */
+typedef _Bool (*IndexSetEnumerator)(const IndexSet *indexSet, int index, ident data);
+
+/**
+ * @brief A function pointer for IndexSet enumeration (iteration) of ranges.
+ *
+ * @param indexSet The IndexSet.
+ * @param range The maximal Range of consecutive indexes for the current iteration.
+ * @param data User data.
+ *
+ * @return True to stop enumeration, false to continue.
+ */
+typedef _Bool (*IndexSetRangeEnumerator)(const IndexSet *indexSet, const Range range, ident data);
+
 /**
  * @brief Index Sets represent the Set to an element or node within a tree or graph structure.
  *
+ * @details IndexSets are compressed bitmaps, partitioned into chunks of 65536 indexes. Each
+ * chunk is stored in whichever container is smallest for its contents: a sorted array for
+ * sparse chunks, a bitmap for dense chunks, or runs for clustered chunks. Membership is a
+ * binary search, and set algebra operates on whole containers at a time.
+ *
  * @extends Object
  */
 struct IndexSet {
@@ -56,12 +169,21 @@ struct IndexSet {
 	IndexSetInterface *interface;
 
 	/**
-	 * @brief The indexes.
+	 * @brief The containers, sorted by key.
+	 *
+	 * @private
+	 */
+	IndexSetContainer *containers;
+
+	/**
+	 * @brief The count of `containers`.
+	 *
+	 * @private
 	 */
-	int *indexes;
+	size_t containerCount;
 
 	/**
-	 * @brief The count of `indexes`.
+	 * @brief The count of indexes.
 	 */
 	size_t count;
 };
@@ -87,6 +209,95 @@ struct IndexSetInterface {
 	 */
 	_Bool (*containsIndex)(const IndexSet *self, int index);
 
+	/**
+	 * @fn size_t IndexSet::countOfIndexesInRange(const IndexSet *self, const Range range)
+	 *
+	 * @param range The Range.
+	 *
+	 * @return The count of indexes of this IndexSet within `range`.
+	 *
+	 * @memberof IndexSet
+	 */
+	size_t (*countOfIndexesInRange)(const IndexSet *self, const Range range);
+
+	/**
+	 * @fn void IndexSet::enumerateIndexes(const IndexSet *self, IndexSetEnumerator enumerator, ident data)
+	 *
+	 * @brief Enumerates the indexes of this IndexSet, in ascending order.
+	 *
+	 * @param enumerator The enumerator function.
+	 * @param data User data.
+	 *
+	 * @memberof IndexSet
+	 */
+	void (*enumerateIndexes)(const IndexSet *self, IndexSetEnumerator enumerator, ident data);
+
+	/**
+	 * @fn void IndexSet::enumerateRanges(const IndexSet *self, IndexSetRangeEnumerator enumerator, ident data)
+	 *
+	 * @brief Enumerates the maximal Ranges of consecutive indexes of this IndexSet, in ascending
+	 * order.
+	 *
+	 * @param enumerator The enumerator function.
+	 * @param data User data.
+	 *
+	 * @memberof IndexSet
+	 */
+	void (*enumerateRanges)(const IndexSet *self, IndexSetRangeEnumerator enumerator, ident data);
+
+	/**
+	 * @fn int IndexSet::firstIndex(const IndexSet *self)
+	 *
+	 * @return The first index of this IndexSet, which must not be empty.
+	 *
+	 * @memberof IndexSet
+	 */
+	int (*firstIndex)(const IndexSet *self);
+
+	/**
+	 * @fn IndexSet *IndexSet::indexSetByIntersectingIndexSet(const IndexSet *self, const IndexSet *indexSet)
+	 *
+	 * @param indexSet An IndexSet.
+	 *
+	 * @return A new IndexSet containing the indexes in both this IndexSet and `indexSet`.
+	 *
+	 * @memberof IndexSet
+	 */
+	IndexSet *(*indexSetByIntersectingIndexSet)(const IndexSet *self, const IndexSet *indexSet);
+
+	/**
+	 * @fn IndexSet *IndexSet::indexSetBySubtractingIndexSet(const IndexSet *self, const IndexSet *indexSet)
+	 *
+	 * @param indexSet An IndexSet.
+	 *
+	 * @return A new IndexSet containing the indexes in this IndexSet but not in `indexSet`.
+	 *
+	 * @memberof IndexSet
+	 */
+	IndexSet *(*indexSetBySubtractingIndexSet)(const IndexSet *self, const IndexSet *indexSet);
+
+	/**
+	 * @fn IndexSet *IndexSet::indexSetByUnioningIndexSet(const IndexSet *self, const IndexSet *indexSet)
+	 *
+	 * @param indexSet An IndexSet.
+	 *
+	 * @return A new IndexSet containing the indexes in either this IndexSet or `indexSet`.
+	 *
+	 * @memberof IndexSet
+	 */
+	IndexSet *(*indexSetByUnioningIndexSet)(const IndexSet *self, const IndexSet *indexSet);
+
+	/**
+	 * @fn IndexSet *IndexSet::init(IndexSet *self)
+	 *
+	 * @brief Initializes this IndexSet to be empty.
+	 *
+	 * @return The intialized IndexSet, or `NULL` on error.
+	 *
+	 * @memberof IndexSet
+	 */
+	IndexSet *(*init)(IndexSet *self);
+
 	/**
 	 * @fn IndexSet *IndexSet::initWithIndex(IndexSet *self, int index)
 	 *
@@ -110,13 +321,58 @@ struct IndexSetInterface {
 	 *
 	 * @return The intialized IndexSet, or `NULL` on error.
 	 *
+	 * @remarks `indexes` is sorted in place.
+	 *
 	 * @memberof IndexSet
 	 */
 	IndexSet *(*initWithIndexes)(IndexSet *self, int *indexes, size_t count);
+
+	/**
+	 * @fn IndexSet *IndexSet::initWithIndexesInRange(IndexSet *self, const Range range)
+	 *
+	 * @brief Initializes this IndexSet with the indexes in the specified Range.
+	 *
+	 * @param range The Range.
+	 *
+	 * @return The intialized IndexSet, or `NULL` on error.
+	 *
+	 * @memberof IndexSet
+	 */
+	IndexSet *(*initWithIndexesInRange)(IndexSet *self, const Range range);
+
+	/**
+	 * @fn IndexSet *IndexSet::initWithIndexSet(IndexSet *self, const IndexSet *indexSet)
+	 *
+	 * @brief Initializes this IndexSet with the indexes of `indexSet`.
+	 *
+	 * @param indexSet An IndexSet.
+	 *
+	 * @return The intialized IndexSet, or `NULL` on error.
+	 *
+	 * @memberof IndexSet
+	 */
+	IndexSet *(*initWithIndexSet)(IndexSet *self, const IndexSet *indexSet);
+
+	/**
+	 * @fn int IndexSet::lastIndex(const IndexSet *self)
+	 *
+	 * @return The last index of this IndexSet, which must not be empty.
+	 *
+	 * @memberof IndexSet
+	 */
+	int (*lastIndex)(const IndexSet *self);
+
+	/**
+	 * @fn MutableIndexSet *IndexSet::mutableCopy(const IndexSet *self)
+	 *
+	 * @return A MutableIndexSet with the contents of this IndexSet.
+	 *
+	 * @memberof IndexSet
+	 */
+	MutableIndexSet *(*mutableCopy)(const IndexSet *self);
 };
 
 /**
  * @brief The IndexSet Class.
  */
 extern Class _IndexSet;
-
@@ -0,0 +1,39 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <inttypes.h>
+
+#include <Objectively/Int64Array.h>
+#include <Objectively/MutableInt64Array.h>
+
+#define TypedArray Int64Array
+
+#define TYPED_ARRAY_VALUE int64_t
+#define TYPED_ARRAY_MASK int64_t
+#define TYPED_ARRAY_ACCUMULATOR uint64_t
+#define TYPED_ARRAY_RESULT int64_t
+#define TYPED_ARRAY_FORMAT "%" PRId64
+#define TYPED_ARRAY_HASH HashForInteger
+#define TYPED_ARRAY_NUMBER_VALUE longValue
+
+#include "TypedArray.inc"
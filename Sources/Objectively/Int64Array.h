@@ -0,0 +1,241 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#pragma once
+
+#include <Objectively/Array.h>
+
+/**
+ * @file
+ *
+ * @brief Immutable arrays of unboxed `int64_t` values.
+ */
+
+typedef struct Int64Array Int64Array;
+typedef struct Int64ArrayInterface Int64ArrayInterface;
+
+/**
+ * @brief Immutable arrays of unboxed `int64_t` values.
+ *
+ * @details Unlike Array, the values are stored contiguously and without boxing, so that
+ * reductions such as Int64Array::sum(const Int64Array *) may be vectorized.
+ *
+ * @extends Object
+ *
+ * @ingroup Collections
+ */
+struct Int64Array {
+
+	/**
+	 * @brief The parent.
+	 *
+	 * @private
+	 */
+	Object object;
+
+	/**
+	 * @brief The typed interface.
+	 *
+	 * @private
+	 */
+	Int64ArrayInterface *interface;
+
+	/**
+	 * @brief The count of values.
+	 */
+	size_t count;
+
+	/**
+	 * @brief The values.
+	 */
+	int64_t *values;
+};
+
+typedef struct MutableInt64Array MutableInt64Array;
+
+/**
+ * @brief The Int64Array interface.
+ */
+struct Int64ArrayInterface {
+
+	/**
+	 * @brief The parent interface.
+	 */
+	ObjectInterface objectInterface;
+
+	/**
+	 * @static
+	 *
+	 * @fn Int64Array *Int64Array::arrayWithArray(const Array *array)
+	 *
+	 * @brief Returns a new Int64Array containing the values of the Numbers in `array`.
+	 *
+	 * @param array An Array of Numbers.
+	 *
+	 * @return The new Int64Array, or `NULL` on error.
+	 *
+	 * @memberof Int64Array
+	 */
+	Int64Array *(*arrayWithArray)(const Array *array);
+
+	/**
+	 * @static
+	 *
+	 * @fn Int64Array *Int64Array::arrayWithValues(const int64_t *values, size_t count)
+	 *
+	 * @brief Returns a new Int64Array containing a copy of `values`.
+	 *
+	 * @param values The values.
+	 * @param count The count of `values`.
+	 *
+	 * @return The new Int64Array, or `NULL` on error.
+	 *
+	 * @memberof Int64Array
+	 */
+	Int64Array *(*arrayWithValues)(const int64_t *values, size_t count);
+
+	/**
+	 * @fn int64_t Int64Array::dot(const Int64Array *self, const Int64Array *other)
+	 *
+	 * @param other Another Int64Array of the same count.
+	 *
+	 * @return The dot product of this Int64Array and `other`.
+	 *
+	 * @remarks Overflow is not checked: the product and its sum wrap modulo 2^64.
+	 *
+	 * @memberof Int64Array
+	 */
+	int64_t (*dot)(const Int64Array *self, const Int64Array *other);
+
+	/**
+	 * @fn int Int64Array::indexOfValue(const Int64Array *self, int64_t value)
+	 *
+	 * @param value The value.
+	 *
+	 * @return The index of the first occurrence of `value`, or `-1` if not found.
+	 *
+	 * @memberof Int64Array
+	 */
+	int (*indexOfValue)(const Int64Array *self, int64_t value);
+
+	/**
+	 * @fn Int64Array *Int64Array::initWithArray(Int64Array *self, const Array *array)
+	 *
+	 * @brief Initializes this Int64Array with the values of the Numbers in `array`.
+	 *
+	 * @param array An Array of Numbers.
+	 *
+	 * @return The initialized Int64Array, or `NULL` on error.
+	 *
+	 * @memberof Int64Array
+	 */
+	Int64Array *(*initWithArray)(Int64Array *self, const Array *array);
+
+	/**
+	 * @fn Int64Array *Int64Array::initWithValues(Int64Array *self, const int64_t *values, size_t count)
+	 *
+	 * @brief Initializes this Int64Array with a copy of `values`.
+	 *
+	 * @param values The values.
+	 * @param count The count of `values`.
+	 *
+	 * @return The initialized Int64Array, or `NULL` on error.
+	 *
+	 * @memberof Int64Array
+	 */
+	Int64Array *(*initWithValues)(Int64Array *self, const int64_t *values, size_t count);
+
+	/**
+	 * @fn int64_t Int64Array::maxValue(const Int64Array *self)
+	 *
+	 * @return The greatest value in this Int64Array, which must not be empty.
+	 *
+	 * @memberof Int64Array
+	 */
+	int64_t (*maxValue)(const Int64Array *self);
+
+	/**
+	 * @fn int64_t Int64Array::minValue(const Int64Array *self)
+	 *
+	 * @return The least value in this Int64Array, which must not be empty.
+	 *
+	 * @memberof Int64Array
+	 */
+	int64_t (*minValue)(const Int64Array *self);
+
+	/**
+	 * @fn MutableInt64Array *Int64Array::mutableCopy(const Int64Array *self)
+	 *
+	 * @return A MutableInt64Array with the contents of this Int64Array.
+	 *
+	 * @memberof Int64Array
+	 */
+	MutableInt64Array *(*mutableCopy)(const Int64Array *self);
+
+	/**
+	 * @fn Array *Int64Array::numbers(const Int64Array *self)
+	 *
+	 * @return An Array of Numbers boxing the values of this Int64Array.
+	 *
+	 * @memberof Int64Array
+	 */
+	Array *(*numbers)(const Int64Array *self);
+
+	/**
+	 * @fn Int64Array *Int64Array::scaledArray(const Int64Array *self, int64_t scalar)
+	 *
+	 * @param scalar The scalar.
+	 *
+	 * @return A copy of this Int64Array with each value multiplied by `scalar`.
+	 *
+	 * @memberof Int64Array
+	 */
+	Int64Array *(*scaledArray)(const Int64Array *self, int64_t scalar);
+
+	/**
+	 * @fn int64_t Int64Array::sum(const Int64Array *self)
+	 *
+	 * @return The sum of the values in this Int64Array.
+	 *
+	 * @remarks Overflow is not checked: the sum wraps modulo 2^64.
+	 *
+	 * @memberof Int64Array
+	 */
+	int64_t (*sum)(const Int64Array *self);
+
+	/**
+	 * @fn int64_t Int64Array::valueAtIndex(const Int64Array *self, int index)
+	 *
+	 * @param index The index of the desired value.
+	 *
+	 * @return The value at the specified index.
+	 *
+	 * @memberof Int64Array
+	 */
+	int64_t (*valueAtIndex)(const Int64Array *self, int index);
+};
+
+/**
+ * @brief The Int64Array Class.
+ */
+extern Class _Int64Array;
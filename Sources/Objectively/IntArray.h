@@ -0,0 +1,241 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#pragma once
+
+#include <Objectively/Array.h>
+
+/**
+ * @file
+ *
+ * @brief Immutable arrays of unboxed `int` values.
+ */
+
+typedef struct IntArray IntArray;
+typedef struct IntArrayInterface IntArrayInterface;
+
+/**
+ * @brief Immutable arrays of unboxed `int` values.
+ *
+ * @details Unlike Array, the values are stored contiguously and without boxing, so that
+ * reductions such as IntArray::sum(const IntArray *) may be vectorized.
+ *
+ * @extends Object
+ *
+ * @ingroup Collections
+ */
+struct IntArray {
+
+	/**
+	 * @brief The parent.
+	 *
+	 * @private
+	 */
+	Object object;
+
+	/**
+	 * @brief The typed interface.
+	 *
+	 * @private
+	 */
+	IntArrayInterface *interface;
+
+	/**
+	 * @brief The count of values.
+	 */
+	size_t count;
+
+	/**
+	 * @brief The values.
+	 */
+	int *values;
+};
+
+typedef struct MutableIntArray MutableIntArray;
+
+/**
+ * @brief The IntArray interface.
+ */
+struct IntArrayInterface {
+
+	/**
+	 * @brief The parent interface.
+	 */
+	ObjectInterface objectInterface;
+
+	/**
+	 * @static
+	 *
+	 * @fn IntArray *IntArray::arrayWithArray(const Array *array)
+	 *
+	 * @brief Returns a new IntArray containing the values of the Numbers in `array`.
+	 *
+	 * @param array An Array of Numbers.
+	 *
+	 * @return The new IntArray, or `NULL` on error.
+	 *
+	 * @memberof IntArray
+	 */
+	IntArray *(*arrayWithArray)(const Array *array);
+
+	/**
+	 * @static
+	 *
+	 * @fn IntArray *IntArray::arrayWithValues(const int *values, size_t count)
+	 *
+	 * @brief Returns a new IntArray containing a copy of `values`.
+	 *
+	 * @param values The values.
+	 * @param count The count of `values`.
+	 *
+	 * @return The new IntArray, or `NULL` on error.
+	 *
+	 * @memberof IntArray
+	 */
+	IntArray *(*arrayWithValues)(const int *values, size_t count);
+
+	/**
+	 * @fn int64_t IntArray::dot(const IntArray *self, const IntArray *other)
+	 *
+	 * @param other Another IntArray of the same count.
+	 *
+	 * @return The dot product of this IntArray and `other`.
+	 *
+	 * @remarks Overflow is not checked: the product and its sum wrap modulo 2^64.
+	 *
+	 * @memberof IntArray
+	 */
+	int64_t (*dot)(const IntArray *self, const IntArray *other);
+
+	/**
+	 * @fn int IntArray::indexOfValue(const IntArray *self, int value)
+	 *
+	 * @param value The value.
+	 *
+	 * @return The index of the first occurrence of `value`, or `-1` if not found.
+	 *
+	 * @memberof IntArray
+	 */
+	int (*indexOfValue)(const IntArray *self, int value);
+
+	/**
+	 * @fn IntArray *IntArray::initWithArray(IntArray *self, const Array *array)
+	 *
+	 * @brief Initializes this IntArray with the values of the Numbers in `array`.
+	 *
+	 * @param array An Array of Numbers.
+	 *
+	 * @return The initialized IntArray, or `NULL` on error.
+	 *
+	 * @memberof IntArray
+	 */
+	IntArray *(*initWithArray)(IntArray *self, const Array *array);
+
+	/**
+	 * @fn IntArray *IntArray::initWithValues(IntArray *self, const int *values, size_t count)
+	 *
+	 * @brief Initializes this IntArray with a copy of `values`.
+	 *
+	 * @param values The values.
+	 * @param count The count of `values`.
+	 *
+	 * @return The initialized IntArray, or `NULL` on error.
+	 *
+	 * @memberof IntArray
+	 */
+	IntArray *(*initWithValues)(IntArray *self, const int *values, size_t count);
+
+	/**
+	 * @fn int IntArray::maxValue(const IntArray *self)
+	 *
+	 * @return The greatest value in this IntArray, which must not be empty.
+	 *
+	 * @memberof IntArray
+	 */
+	int (*maxValue)(const IntArray *self);
+
+	/**
+	 * @fn int IntArray::minValue(const IntArray *self)
+	 *
+	 * @return The least value in this IntArray, which must not be empty.
+	 *
+	 * @memberof IntArray
+	 */
+	int (*minValue)(const IntArray *self);
+
+	/**
+	 * @fn MutableIntArray *IntArray::mutableCopy(const IntArray *self)
+	 *
+	 * @return A MutableIntArray with the contents of this IntArray.
+	 *
+	 * @memberof IntArray
+	 */
+	MutableIntArray *(*mutableCopy)(const IntArray *self);
+
+	/**
+	 * @fn Array *IntArray::numbers(const IntArray *self)
+	 *
+	 * @return An Array of Numbers boxing the values of this IntArray.
+	 *
+	 * @memberof IntArray
+	 */
+	Array *(*numbers)(const IntArray *self);
+
+	/**
+	 * @fn IntArray *IntArray::scaledArray(const IntArray *self, int scalar)
+	 *
+	 * @param scalar The scalar.
+	 *
+	 * @return A copy of this IntArray with each value multiplied by `scalar`.
+	 *
+	 * @memberof IntArray
+	 */
+	IntArray *(*scaledArray)(const IntArray *self, int scalar);
+
+	/**
+	 * @fn int64_t IntArray::sum(const IntArray *self)
+	 *
+	 * @return The sum of the values in this IntArray.
+	 *
+	 * @remarks Overflow is not checked: the sum wraps modulo 2^64.
+	 *
+	 * @memberof IntArray
+	 */
+	int64_t (*sum)(const IntArray *self);
+
+	/**
+	 * @fn int IntArray::valueAtIndex(const IntArray *self, int index)
+	 *
+	 * @param index The index of the desired value.
+	 *
+	 * @return The value at the specified index.
+	 *
+	 * @memberof IntArray
+	 */
+	int (*valueAtIndex)(const IntArray *self, int index);
+};
+
+/**
+ * @brief The IntArray Class.
+ */
+extern Class _IntArray;
@@ -22,14 +22,21 @@
  */
 
 #include <assert.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdarg.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
 #include <Objectively/Boole.h>
+#include <Objectively/IntArray.h>
 #include <Objectively/JSONSerialization.h>
 #include <Objectively/MutableData.h>
 #include <Objectively/MutableDictionary.h>
 #include <Objectively/MutableArray.h>
+#include <Objectively/MutableDoubleArray.h>
+#include <Objectively/MutableInt64Array.h>
 #include <Objectively/Null.h>
 #include <Objectively/Number.h>
 #include <Objectively/String.h>
@@ -49,6 +56,39 @@ typedef struct {
 
 static void writeElement(JSONWriter *writer, const ident obj);
 
+/**
+ * Writes the formatted string `fmt` to `writer`, directly into the spare capacity of its Data.
+ *
+ * @param writer The JSONWriter.
+ * @param fmt The format string.
+ */
+static void writeFormat(JSONWriter *writer, const char *fmt, ...) {
+
+	MutableData *data = writer->data;
+	const size_t length = data->data.length;
+
+	va_list args, copy;
+	va_start(args, fmt);
+	va_copy(copy, args);
+
+	const size_t available = data->capacity - length;
+
+	const int len = vsnprintf((char *) data->data.bytes + length, available, fmt, copy);
+	assert(len >= 0);
+
+	va_end(copy);
+
+	if ((size_t) len >= available) {
+		$(data, setLength, length + len + 1);
+
+		vsnprintf((char *) data->data.bytes + length, len + 1, fmt, args);
+	}
+
+	va_end(args);
+
+	$(data, setLength, length + len);
+}
+
 /**
  * Writes `null` to `writer`.
  *
@@ -96,11 +136,7 @@ static void writeString(JSONWriter *writer, const String *string) {
  */
 static void writeNumber(JSONWriter *writer, const Number *number) {
 
-	String *string = alloc(String, initWithFormat, "%.5f", number->value);
-
-	$(writer->data, appendBytes, (uint8_t *) string->chars, string->length);
-
-	release(string);
+	writeFormat(writer, "%.5f", number->value);
 }
 
 /**
@@ -125,22 +161,20 @@ static void writeObject(JSONWriter *writer, const Dictionary *object) {
 
 	$(writer->data, appendBytes, (uint8_t * ) "{", 1);
 
-	Array *keys = $(object, allKeys);
-	for (size_t i = 0; i < keys->count; i++) {
+	const String *key;
+	ident obj;
 
-		const ident key = $(keys, objectAtIndex, i);
-		writeLabel(writer, (String *) key);
+	size_t i = 0;
+	DictionaryForEach(key, obj, object) {
 
-		const ident obj = $(object, objectForKey, key);
+		writeLabel(writer, key);
 		writeElement(writer, obj);
 
-		if (i < keys->count - 1) {
+		if (++i < object->count) {
 			$(writer->data, appendBytes, (uint8_t *) ", ", 2);
 		}
 	}
 
-	release(keys);
-
 	$(writer->data, appendBytes, (uint8_t * ) "}", 1);
 }
 
@@ -166,6 +200,72 @@ static void writeArray(JSONWriter *writer, const Array *array) {
 	$(writer->data, appendBytes, (uint8_t * ) "]", 1);
 }
 
+/**
+ * Writes `array` to `writer`.
+ *
+ * @param writer The JSONWriter.
+ * @param array The DoubleArray to write.
+ */
+static void writeDoubleArray(JSONWriter *writer, const DoubleArray *array) {
+
+	$(writer->data, appendBytes, (uint8_t * ) "[", 1);
+
+	for (size_t i = 0; i < array->count; i++) {
+
+		writeFormat(writer, "%.5f", array->values[i]);
+
+		if (i < array->count - 1) {
+			$(writer->data, appendBytes, (uint8_t *) ", ", 2);
+		}
+	}
+
+	$(writer->data, appendBytes, (uint8_t * ) "]", 1);
+}
+
+/**
+ * Writes `array` to `writer`.
+ *
+ * @param writer The JSONWriter.
+ * @param array The IntArray to write.
+ */
+static void writeIntArray(JSONWriter *writer, const IntArray *array) {
+
+	$(writer->data, appendBytes, (uint8_t * ) "[", 1);
+
+	for (size_t i = 0; i < array->count; i++) {
+
+		writeFormat(writer, "%d", array->values[i]);
+
+		if (i < array->count - 1) {
+			$(writer->data, appendBytes, (uint8_t *) ", ", 2);
+		}
+	}
+
+	$(writer->data, appendBytes, (uint8_t * ) "]", 1);
+}
+
+/**
+ * Writes `array` to `writer`.
+ *
+ * @param writer The JSONWriter.
+ * @param array The Int64Array to write.
+ */
+static void writeInt64Array(JSONWriter *writer, const Int64Array *array) {
+
+	$(writer->data, appendBytes, (uint8_t * ) "[", 1);
+
+	for (size_t i = 0; i < array->count; i++) {
+
+		writeFormat(writer, "%" PRId64, array->values[i]);
+
+		if (i < array->count - 1) {
+			$(writer->data, appendBytes, (uint8_t *) ", ", 2);
+		}
+	}
+
+	$(writer->data, appendBytes, (uint8_t * ) "]", 1);
+}
+
 /**
  * Writes the specified JSON element to `writer`.
  *
@@ -180,6 +280,12 @@ static void writeElement(JSONWriter *writer, const ident obj) {
 			writeObject(writer, (Dictionary *) object);
 		} else if ($(object, isKindOfClass, &_Array)) {
 			writeArray(writer, (Array *) object);
+		} else if ($(object, isKindOfClass, &_DoubleArray)) {
+			writeDoubleArray(writer, (DoubleArray *) object);
+		} else if ($(object, isKindOfClass, &_IntArray)) {
+			writeIntArray(writer, (IntArray *) object);
+		} else if ($(object, isKindOfClass, &_Int64Array)) {
+			writeInt64Array(writer, (Int64Array *) object);
 		} else if ($(object, isKindOfClass, &_String)) {
 			writeString(writer, (String *) object);
 		} else if ($(object, isKindOfClass, &_Number)) {
@@ -295,7 +401,40 @@ static String *readString(JSONReader *reader) {
 	assert(b == '"');
 
 	const size_t length = reader->b - bytes - 1;
-	return $$(String, stringWithBytes, bytes + 1, length, STRING_ENCODING_UTF8);
+
+	if (reader->options & JSON_READ_VALIDATE_UTF8) {
+
+		char *mem = malloc(length + 1);
+		assert(mem);
+
+		memcpy(mem, bytes + 1, length);
+		mem[length] = '\0';
+
+		return $$(String, stringWithMemory, mem, length);
+	}
+
+	String *string = $$(String, stringWithBytes, bytes + 1, length, STRING_ENCODING_UTF8);
+	assert(string);
+
+	return string;
+}
+
+/**
+ * @brief Reads an interned String from `reader`.
+ *
+ * @param reader The JSONReader.
+ *
+ * @return The interned String, retained.
+ */
+static String *readInternedString(JSONReader *reader) {
+
+	uint8_t *bytes = reader->b;
+
+	const int b = readByteUntil(reader, "\"");
+	assert(b == '"');
+
+	const size_t length = reader->b - bytes - 1;
+	return retain($$(String, internedStringWithCharacters, (char *) bytes + 1, length));
 }
 
 /**
@@ -372,6 +511,9 @@ static String *readLabel(JSONReader *reader) {
 
 	const int b = readByteUntil(reader, "\"}");
 	if (b == '"') {
+		if (reader->options & JSON_READ_INTERN_KEYS) {
+			return readInternedString(reader);
+		}
 		return readString(reader);
 	} if (b == '}') {
 		reader->b--;
@@ -415,6 +557,80 @@ static Dictionary *readObject(JSONReader *reader) {
 	return (Dictionary *) object;
 }
 
+/**
+ * @brief Reads an array of only numbers from `reader`, without boxing them.
+ *
+ * @param reader The JSONReader.
+ *
+ * @return An Int64Array if every number is an integer, otherwise a DoubleArray. If the array
+ * is empty or contains any other element, `reader` is rewound and `NULL` is returned.
+ */
+static ident readPrimitiveArray(JSONReader *reader) {
+
+	uint8_t *mark = reader->b;
+
+	MutableInt64Array *integers = alloc(MutableInt64Array, init);
+	MutableDoubleArray *decimals = NULL;
+
+	while (true) {
+
+		const int b = readByteUntil(reader, "{[\"tfn0123456789.-]");
+		if (b == ']') {
+			break;
+		}
+
+		if (b != '.' && b != '-' && !isdigit(b)) {
+			release(integers);
+			release(decimals);
+			reader->b = mark;
+			return NULL;
+		}
+
+		uint8_t *bytes = reader->b;
+		uint8_t *end;
+
+		if (integers) {
+
+			errno = 0;
+			const long long i = strtoll((char *) bytes, (char **) &end, 10);
+
+			if (end > bytes && errno == 0 && *end != '.' && *end != 'e' && *end != 'E') {
+				$(integers, addValue, i);
+				reader->b = end - 1;
+				continue;
+			}
+
+			const Int64Array *values = (Int64Array *) integers;
+
+			decimals = alloc(MutableDoubleArray, initWithCapacity, values->count + 1);
+			for (size_t j = 0; j < values->count; j++) {
+				$(decimals, addValue, values->values[j]);
+			}
+
+			release(integers);
+			integers = NULL;
+		}
+
+		const double d = strtod((char *) bytes, (char **) &end);
+
+		assert(end > bytes);
+		reader->b = end - 1;
+
+		$(decimals, addValue, d);
+	}
+
+	if (integers) {
+		if (((Int64Array *) integers)->count == 0) {
+			release(integers);
+			reader->b = mark;
+			return NULL;
+		}
+		return integers;
+	}
+
+	return decimals;
+}
+
 /**
  * @brief Reads an array from `reader.
  *
@@ -456,6 +672,12 @@ static ident readElement(JSONReader *reader) {
 	if (b == '{') {
 		return readObject(reader);
 	} else if (b == '[') {
+		if (reader->options & JSON_READ_PRIMITIVE_ARRAYS) {
+			ident array = readPrimitiveArray(reader);
+			if (array) {
+				return array;
+			}
+		}
 		return readArray(reader);
 	} else if (b == '\"') {
 		return readString(reader);
@@ -480,6 +702,11 @@ static ident readElement(JSONReader *reader) {
 static ident objectFromData(const Data *data, int options) {
 
 	if (data && data->length) {
+
+		if ((options & JSON_READ_VALIDATE_UTF8) && IsValidUTF8(data->bytes, data->length) == false) {
+			return NULL;
+		}
+
 		JSONReader reader = {
 			.data = data,
 			.options = options
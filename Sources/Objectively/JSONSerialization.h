@@ -43,6 +43,32 @@
  */
 #define JSON_WRITE_PRETTY 1
 
+/**
+ * @brief Enables decoding of arrays containing only numbers into unboxed primitive arrays.
+ *
+ * @details Arrays of integers that fit in 64 bits are decoded as Int64Array, and other
+ * numeric arrays are decoded as DoubleArray. Empty and mixed arrays are decoded as Array.
+ */
+#define JSON_READ_PRIMITIVE_ARRAYS 1
+
+/**
+ * @brief Enables interning of object keys.
+ *
+ * @details Each key is decoded as the interned String for its characters, so that documents
+ * repeating the same keys share a single instance of each, without allocating one per object.
+ *
+ * @see String::intern(const String *)
+ */
+#define JSON_READ_INTERN_KEYS 2
+
+/**
+ * @brief Enables validation of the input as UTF-8 before it is decoded.
+ *
+ * @details Invalid input is rejected as a whole, and the Strings of valid input are then copied
+ * without being validated individually. Use this for untrusted input.
+ */
+#define JSON_READ_VALIDATE_UTF8 4
+
 typedef struct JSONSerialization JSONSerialization;
 typedef struct JSONSerializationInterface JSONSerializationInterface;
 
@@ -0,0 +1,57 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @file
+ *
+ * @brief Portable little endian encoding, shared by the serialized forms of the filters.
+ *
+ * @remarks This header is private to the library and is not installed.
+ */
+
+/**
+ * @brief Writes the low `size` bytes of `value` to `bytes` in little endian order.
+ */
+static inline void writeLittleEndian(uint8_t *bytes, uint64_t value, size_t size) {
+	for (size_t i = 0; i < size; i++) {
+		bytes[i] = (uint8_t) (value >> (i * 8));
+	}
+}
+
+/**
+ * @return The value of `size` bytes read from `bytes` in little endian order.
+ */
+static inline uint64_t readLittleEndian(const uint8_t *bytes, size_t size) {
+
+	uint64_t value = 0;
+	for (size_t i = 0; i < size; i++) {
+		value |= ((uint64_t) bytes[i]) << (i * 8);
+	}
+
+	return value;
+}
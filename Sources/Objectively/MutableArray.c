@@ -24,6 +24,7 @@
 #include <assert.h>
 #include <stdarg.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include <Objectively/MutableArray.h>
 
@@ -47,8 +48,61 @@ static Object *copy(const Object *self) {
 	return (Object *) copy;
 }
 
+/**
+ * @see Object::sizeInBytes(const Object *)
+ */
+static size_t sizeInBytes(const Object *self) {
+
+	const MutableArray *this = (MutableArray *) self;
+
+	return super(Object, self, sizeInBytes) + (this->capacity - this->array.count) * sizeof(ident);
+}
+
 #pragma mark - MutableArray
 
+/**
+ * @brief Releases the elements from `count` to the end of this MutableArray, and truncates it.
+ *
+ * @remarks The elements are released only after the MutableArray is consistent, so that
+ * deallocation of an element may safely inspect this MutableArray.
+ */
+static void truncateToCount(MutableArray *self, size_t count) {
+
+	assert(count <= self->array.count);
+
+	const size_t end = self->array.count;
+	self->array.count = count;
+
+	for (size_t i = count; i < end; i++) {
+		release(self->array.elements[i]);
+	}
+}
+
+/**
+ * @brief Stably compacts the elements for which `predicate` returns `expected` to the front
+ * of this MutableArray, moving all others to the tail.
+ *
+ * @return The count of elements for which `predicate` returned `expected`.
+ */
+static size_t compactObjects(MutableArray *self, Predicate predicate, ident data, _Bool expected) {
+
+	ident *elements = self->array.elements;
+	size_t count = 0;
+
+	for (size_t i = 0; i < self->array.count; i++) {
+		if (predicate(elements[i], data) == expected) {
+			if (i != count) {
+				const ident obj = elements[count];
+				elements[count] = elements[i];
+				elements[i] = obj;
+			}
+			count++;
+		}
+	}
+
+	return count;
+}
+
 /**
  * @fn void MutableArray::addObject(MutableArray *self, const ident obj)
  *
@@ -135,11 +189,7 @@ static void filter(MutableArray *self, Predicate predicate, ident data) {
 
 	assert(predicate);
 
-	for (size_t i = 0; i < self->array.count; i++) {
-		if (predicate(self->array.elements[i], data) == false) {
-			$(self, removeObjectAtIndex, i--);
-		}
-	}
+	truncateToCount(self, compactObjects(self, predicate, data, true));
 }
 
 /**
@@ -192,6 +242,40 @@ static void insertObjectAtIndex(MutableArray *self, ident obj, int index) {
 	self->array.elements[index] = obj;
 }
 
+/**
+ * @fn size_t MutableArray::partition(MutableArray *self, Predicate predicate, ident data)
+ *
+ * @memberof MutableArray
+ */
+static size_t partition(MutableArray *self, Predicate predicate, ident data) {
+
+	assert(predicate);
+
+	ident *elements = self->array.elements;
+	ident *rejects = NULL;
+
+	size_t count = 0, rejected = 0;
+
+	for (size_t i = 0; i < self->array.count; i++) {
+		if (predicate(elements[i], data)) {
+			elements[count++] = elements[i];
+		} else {
+			if (rejects == NULL) {
+				rejects = malloc((self->array.count - i) * sizeof(ident));
+				assert(rejects);
+			}
+			rejects[rejected++] = elements[i];
+		}
+	}
+
+	if (rejects) {
+		memcpy(elements + count, rejects, rejected * sizeof(ident));
+		free(rejects);
+	}
+
+	return count;
+}
+
 /**
  * @fn void MutableArray::removeAllObjects(MutableArray *self)
  *
@@ -199,9 +283,7 @@ static void insertObjectAtIndex(MutableArray *self, ident obj, int index) {
  */
 static void removeAllObjects(MutableArray *self) {
 
-	for (size_t i = self->array.count; i > 0; i--) {
-		$(self, removeObjectAtIndex, i - 1);
-	}
+	truncateToCount(self, 0);
 }
 
 /**
@@ -227,13 +309,89 @@ static void removeObjectAtIndex(MutableArray *self, const int index) {
 	assert(index > -1);
 	assert(index < self->array.count);
 
-	release(self->array.elements[index]);
+	ident obj = self->array.elements[index];
 
-	for (size_t i = index; i < self->array.count; i++) {
-		self->array.elements[i] = self->array.elements[i + 1];
-	}
+	ident *ptr = self->array.elements + index;
+	memmove(ptr, ptr + 1, (self->array.count - index - 1) * sizeof(ident));
 
 	self->array.count--;
+
+	release(obj);
+}
+
+/**
+ * @brief The context of MutableArray::removeObjectsAtIndexes.
+ */
+typedef struct {
+	MutableArray *array;
+	size_t begin;
+	size_t count;
+} RemoveObjectsAtIndexes;
+
+/**
+ * @brief IndexSetRangeEnumerator for removeObjectsAtIndexes.
+ */
+static _Bool removeObjectsAtIndexes_enumerator(const IndexSet *indexSet, const Range range, ident data) {
+
+	RemoveObjectsAtIndexes *context = data;
+
+	ident *elements = context->array->array.elements;
+
+	for (size_t i = context->begin; i < (size_t) range.location; i++) {
+		if (i != context->count) {
+			const ident obj = elements[context->count];
+			elements[context->count] = elements[i];
+			elements[i] = obj;
+		}
+		context->count++;
+	}
+
+	context->begin = range.location + range.length;
+	return false;
+}
+
+/**
+ * @fn void MutableArray::removeObjectsAtIndexes(MutableArray *self, const IndexSet *indexes)
+ *
+ * @memberof MutableArray
+ */
+static void removeObjectsAtIndexes(MutableArray *self, const IndexSet *indexes) {
+
+	assert(indexes);
+
+	if (indexes->count == 0) {
+		return;
+	}
+
+	assert($(indexes, firstIndex) > -1);
+	assert($(indexes, lastIndex) < (int) self->array.count);
+
+	RemoveObjectsAtIndexes context = {
+		.array = self
+	};
+
+	$(indexes, enumerateRanges, removeObjectsAtIndexes_enumerator, &context);
+
+	const Range remainder = {
+		.location = (int) self->array.count,
+		.length = 0
+	};
+
+	removeObjectsAtIndexes_enumerator(indexes, remainder, &context);
+
+	truncateToCount(self, context.count);
+}
+
+/**
+ * @fn void MutableArray::removeObjectsPassingTest(MutableArray *self, Predicate predicate, ident data)
+ *
+ * @memberof MutableArray
+ */
+static void removeObjectsPassingTest(MutableArray *self, Predicate predicate, ident data) {
+
+	assert(predicate);
+
+	truncateToCount(self, compactObjects(self, predicate, data, false));
 }
 
 /**
@@ -253,61 +411,56 @@ static void setObjectAtIndex(MutableArray *self, const ident obj, int index) {
 	self->array.elements[index] = obj;
 }
 
-#if defined(__APPLE__)
-
-/**
- * @brief qsort_r comparator.
- */
-static int _sort(void *data, const void *a, const void *b) {
-	return ((Comparator) data)(*((const ident *) a), *((const ident *) b));
-}
-
 /**
  * @fn void MutableArray::sort(MutableArray *self, Comparator comparator)
- * 
+ *
  * @memberof MutableArray
  */
 static void sort(MutableArray *self, Comparator comparator) {
-	qsort_r(self->array.elements, self->array.count, sizeof(ident), comparator, _sort);
-}
 
-#elif defined(__MINGW32__)
-
-/**
- * @brief qsort_s comparator.
- */
-static int _sort(void *data, const void *a, const void *b) {
-	return ((Comparator) data)(*((const ident *) a), *((const ident *) b));
+	$(self, sortWithOptions, comparator, SortOptionNone);
 }
 
 /**
- * @fn void MutableArray::sort(MutableArray *self, Comparator comparator)
+ * @fn void MutableArray::sortByKey(MutableArray *self)
  *
  * @memberof MutableArray
  */
-static void sort(MutableArray *self, Comparator comparator) {
-	qsort_s(self->array.elements, self->array.count, sizeof(ident), _sort, comparator);
-}
+static void sortByKey(MutableArray *self) {
 
-#else
+	SortByKey(self->array.elements, self->array.count);
+}
 
 /**
- * @brief qsort_r comparator.
+ * @fn void MutableArray::sortWithOptions(MutableArray *self, Comparator comparator, SortOptions options)
+ *
+ * @memberof MutableArray
  */
-static int _sort(const void *a, const void *b, void *data) {
-	return ((Comparator) data)(*((const ident *) a), *((const ident *) b));
+static void sortWithOptions(MutableArray *self, Comparator comparator, SortOptions options) {
+
+	Sort(self->array.elements, self->array.count, comparator, options);
 }
 
 /**
- * @fn void MutableArray::sort(MutableArray *self, Comparator comparator)
+ * @fn void MutableArray::trimToSize(MutableArray *self)
  *
  * @memberof MutableArray
  */
-static void sort(MutableArray *self, Comparator comparator) {
-	qsort_r(self->array.elements, self->array.count, sizeof(ident), _sort, comparator);
-}
+static void trimToSize(MutableArray *self) {
+
+	if (self->capacity > self->array.count) {
 
-#endif
+		self->capacity = self->array.count;
+
+		if (self->capacity) {
+			self->array.elements = realloc(self->array.elements, self->capacity * sizeof(ident));
+			assert(self->array.elements);
+		} else {
+			free(self->array.elements);
+			self->array.elements = NULL;
+		}
+	}
+}
 
 #pragma mark - Class lifecycle
 
@@ -319,6 +472,7 @@ static void initialize(Class *clazz) {
 	ObjectInterface *object = (ObjectInterface *) clazz->interface;
 
 	object->copy = copy;
+	object->sizeInBytes = sizeInBytes;
 
 	MutableArrayInterface *mutableArray = (MutableArrayInterface *) clazz->interface;
 
@@ -331,11 +485,17 @@ static void initialize(Class *clazz) {
 	mutableArray->init = init;
 	mutableArray->initWithCapacity = initWithCapacity;
 	mutableArray->insertObjectAtIndex = insertObjectAtIndex;
+	mutableArray->partition = partition;
 	mutableArray->removeAllObjects = removeAllObjects;
 	mutableArray->removeObject = removeObject;
 	mutableArray->removeObjectAtIndex = removeObjectAtIndex;
+	mutableArray->removeObjectsAtIndexes = removeObjectsAtIndexes;
+	mutableArray->removeObjectsPassingTest = removeObjectsPassingTest;
 	mutableArray->setObjectAtIndex = setObjectAtIndex;
 	mutableArray->sort = sort;
+	mutableArray->sortByKey = sortByKey;
+	mutableArray->sortWithOptions = sortWithOptions;
+	mutableArray->trimToSize = trimToSize;
 }
 
 Class _MutableArray = {
@@ -24,6 +24,7 @@
 #pragma once
 
 #include <Objectively/Array.h>
+#include <Objectively/IndexSet.h>
 
 /**
  * @file
@@ -141,6 +142,9 @@ struct MutableArrayInterface {
 	 * @param predicate A Predicate.
 	 * @param data User data.
 	 *
+	 * @remarks Objects that pass `predicate` are retained in their original order. This
+	 * method runs in linear time.
+	 *
 	 * @memberof MutableArray
 	 */
 	void (*filter)(MutableArray *self, Predicate predicate, ident data);
@@ -181,6 +185,24 @@ struct MutableArrayInterface {
 	 */
 	void (*insertObjectAtIndex)(MutableArray *self, ident obj, int index);
 
+	/**
+	 * @fn size_t MutableArray::partition(MutableArray *self, Predicate predicate, ident data)
+	 *
+	 * @brief Stably reorders this MutableArray so that all Objects passing `predicate`
+	 * precede all Objects that do not.
+	 *
+	 * @param predicate A Predicate.
+	 * @param data User data.
+	 *
+	 * @return The count of Objects that passed `predicate`, which is also the index of the
+	 * first Object that did not.
+	 *
+	 * @remarks This method runs in linear time, and calls `predicate` once per Object.
+	 *
+	 * @memberof MutableArray
+	 */
+	size_t (*partition)(MutableArray *self, Predicate predicate, ident data);
+
 	/**
 	 * @fn void MutableArray::removeAllObjects(MutableArray *self)
 	 *
@@ -210,6 +232,33 @@ struct MutableArrayInterface {
 	 */
 	void (*removeObjectAtIndex)(MutableArray *self, const int index);
 
+	/**
+	 * @fn void MutableArray::removeObjectsAtIndexes(MutableArray *self, const IndexSet *indexes)
+	 *
+	 * @brief Removes the Objects at the specified indexes.
+	 *
+	 * @param indexes The indexes of the Objects to remove.
+	 *
+	 * @remarks This method runs in linear time, regardless of the count of `indexes`.
+	 *
+	 * @memberof MutableArray
+	 */
+	void (*removeObjectsAtIndexes)(MutableArray *self, const IndexSet *indexes);
+
+	/**
+	 * @fn void MutableArray::removeObjectsPassingTest(MutableArray *self, Predicate predicate, ident data)
+	 *
+	 * @brief Removes all Objects that pass `predicate`.
+	 *
+	 * @param predicate A Predicate.
+	 * @param data User data.
+	 *
+	 * @remarks This is the inverse of `filter`, and also runs in linear time.
+	 *
+	 * @memberof MutableArray
+	 */
+	void (*removeObjectsPassingTest)(MutableArray *self, Predicate predicate, ident data);
+
 	/**
 	 * @fn void MutableArray::setObjectAtIndex(MutableArray *self, const ident obj, int index)
 	 *
@@ -234,6 +283,43 @@ struct MutableArrayInterface {
 	 * @memberof MutableArray
 	 */
 	void (*sort)(MutableArray *self, Comparator comparator);
+
+	/**
+	 * @fn void MutableArray::sortByKey(MutableArray *self)
+	 *
+	 * @brief Stably sorts this MutableArray in place by radix, in ascending order.
+	 *
+	 * @remarks This MutableArray must contain only Numbers, or only Strings. A fixed-width key
+	 * is extracted from each Object once, and no Comparator is invoked. This is typically
+	 * several times faster than `sort` for large Arrays.
+	 *
+	 * @see SortByKey(ident *, size_t)
+	 *
+	 * @memberof MutableArray
+	 */
+	void (*sortByKey)(MutableArray *self);
+
+	/**
+	 * @fn void MutableArray::sortWithOptions(MutableArray *self, Comparator comparator, SortOptions options)
+	 *
+	 * @brief Sorts this MutableArray in place using `comparator` and the algorithm selected
+	 * by `options`.
+	 *
+	 * @param comparator A Comparator.
+	 * @param options The SortOptions.
+	 *
+	 * @memberof MutableArray
+	 */
+	void (*sortWithOptions)(MutableArray *self, Comparator comparator, SortOptions options);
+
+	/**
+	 * @fn void MutableArray::trimToSize(MutableArray *self)
+	 *
+	 * @brief Releases the capacity of this MutableArray in excess of its count.
+	 *
+	 * @memberof MutableArray
+	 */
+	void (*trimToSize)(MutableArray *self);
 };
 
 /**
@@ -44,6 +44,16 @@ static Object *copy(const Object *self) {
 	return (Object *) that;
 }
 
+/**
+ * @see Object::sizeInBytes(const Object *)
+ */
+static size_t sizeInBytes(const Object *self) {
+
+	const MutableData *this = (MutableData *) self;
+
+	return super(Object, self, sizeInBytes) + (this->capacity - this->data.length);
+}
+
 #pragma mark - MutableData
 
 /**
@@ -143,8 +153,9 @@ static MutableData *initWithData(MutableData *self, const Data *data) {
  */
 static void setLength(MutableData *self, size_t length) {
 
-	const size_t newCapacity = (length / _pageSize + 1) * _pageSize;
-	if (newCapacity > self->capacity) {
+	if (length > self->capacity) {
+
+		const size_t newCapacity = max(self->capacity * 2, (length / _pageSize + 1) * _pageSize);
 
 		if (self->data.bytes == NULL) {
 			self->data.bytes = calloc(newCapacity, sizeof(uint8_t));
@@ -162,6 +173,27 @@ static void setLength(MutableData *self, size_t length) {
 	self->data.length = length;
 }
 
+/**
+ * @fn void MutableData::trimToSize(MutableData *self)
+ *
+ * @memberof MutableData
+ */
+static void trimToSize(MutableData *self) {
+
+	if (self->capacity > self->data.length) {
+
+		self->capacity = self->data.length;
+
+		if (self->capacity) {
+			self->data.bytes = realloc(self->data.bytes, self->capacity);
+			assert(self->data.bytes);
+		} else {
+			free(self->data.bytes);
+			self->data.bytes = NULL;
+		}
+	}
+}
+
 #pragma mark - Class lifecycle
 
 /**
@@ -172,6 +204,7 @@ static void initialize(Class *clazz) {
 	ObjectInterface *object = (ObjectInterface *) clazz->interface;
 
 	object->copy = copy;
+	object->sizeInBytes = sizeInBytes;
 
 	MutableDataInterface *mutableData = (MutableDataInterface *) clazz->interface;
 
@@ -183,6 +216,7 @@ static void initialize(Class *clazz) {
 	mutableData->initWithCapacity = initWithCapacity;
 	mutableData->initWithData = initWithData;
 	mutableData->setLength = setLength;
+	mutableData->trimToSize = trimToSize;
 }
 
 Class _MutableData = {
@@ -177,6 +177,15 @@ struct MutableDataInterface {
 	 * @memberof MutableData
 	 */
 	void (*setLength)(MutableData *self, size_t length);
+
+	/**
+	 * @fn void MutableData::trimToSize(MutableData *self)
+	 *
+	 * @brief Releases the capacity of this MutableData in excess of its length.
+	 *
+	 * @memberof MutableData
+	 */
+	void (*trimToSize)(MutableData *self);
 };
 
 /**
@@ -0,0 +1,370 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <Objectively/MutableArray.h>
+#include <Objectively/MutableDeque.h>
+
+#define _Class _MutableDeque
+
+/**
+ * @return The ring buffer slot of the element at `index`, counted from the first.
+ */
+static inline ident *slotAtIndex(const Deque *deque, size_t index) {
+	return &deque->elements[(deque->head + index) & (deque->capacity - 1)];
+}
+
+#pragma mark - Object
+
+/**
+ * @see Object::copy(const Object *)
+ */
+static Object *copy(const Object *self) {
+
+	return (Object *) $((Deque *) self, mutableCopy);
+}
+
+#pragma mark - MutableDeque
+
+/**
+ * @brief Doubles the capacity of this MutableDeque if it is full, unwrapping the ring buffer.
+ */
+static void pushObject_resize(MutableDeque *self) {
+
+	Deque *deque = (Deque *) self;
+
+	if (deque->count == deque->capacity) {
+
+		const size_t capacity = deque->capacity ? deque->capacity << 1 : 16;
+
+		ident *elements = calloc(capacity, sizeof(ident));
+		assert(elements);
+
+		if (deque->count) {
+
+			const size_t head = deque->capacity - deque->head;
+			if (head >= deque->count) {
+				memcpy(elements, deque->elements + deque->head, deque->count * sizeof(ident));
+			} else {
+				memcpy(elements, deque->elements + deque->head, head * sizeof(ident));
+				memcpy(elements + head, deque->elements, (deque->count - head) * sizeof(ident));
+			}
+		}
+
+		free(deque->elements);
+
+		deque->elements = elements;
+		deque->capacity = capacity;
+		deque->head = 0;
+	}
+}
+
+/**
+ * @fn MutableDeque *MutableDeque::deque(void)
+ *
+ * @memberof MutableDeque
+ */
+static MutableDeque *deque(void) {
+
+	return alloc(MutableDeque, init);
+}
+
+/**
+ * @fn MutableDeque *MutableDeque::dequeWithCapacity(size_t capacity)
+ *
+ * @memberof MutableDeque
+ */
+static MutableDeque *dequeWithCapacity(size_t capacity) {
+
+	return alloc(MutableDeque, initWithCapacity, capacity);
+}
+
+/**
+ * @fn Array *MutableDeque::drainObjects(MutableDeque *self, size_t count)
+ *
+ * @memberof MutableDeque
+ */
+static Array *drainObjects(MutableDeque *self, size_t count) {
+
+	Deque *deque = (Deque *) self;
+
+	count = min(count, deque->count);
+
+	MutableArray *array = alloc(MutableArray, initWithCapacity, count);
+	assert(array);
+
+	for (size_t i = 0; i < count; i++) {
+		array->array.elements[i] = *slotAtIndex(deque, i);
+	}
+
+	array->array.count = count;
+
+	deque->head = (deque->head + count) & (deque->capacity - 1);
+	deque->count -= count;
+
+	return (Array *) array;
+}
+
+/**
+ * @fn MutableDeque *MutableDeque::init(MutableDeque *self)
+ *
+ * @memberof MutableDeque
+ */
+static MutableDeque *init(MutableDeque *self) {
+
+	return $(self, initWithCapacity, 0);
+}
+
+/**
+ * @fn MutableDeque *MutableDeque::initWithCapacity(MutableDeque *self, size_t capacity)
+ *
+ * @memberof MutableDeque
+ */
+static MutableDeque *initWithCapacity(MutableDeque *self, size_t capacity) {
+
+	self = (MutableDeque *) super(Object, self, init);
+	if (self) {
+
+		if (capacity) {
+
+			self->deque.capacity = 1;
+			while (self->deque.capacity < capacity) {
+				self->deque.capacity <<= 1;
+			}
+
+			self->deque.elements = calloc(self->deque.capacity, sizeof(ident));
+			assert(self->deque.elements);
+		}
+	}
+
+	return self;
+}
+
+/**
+ * @fn ident MutableDeque::popFirstObject(MutableDeque *self)
+ *
+ * @memberof MutableDeque
+ */
+static ident popFirstObject(MutableDeque *self) {
+
+	Deque *deque = (Deque *) self;
+
+	if (deque->count == 0) {
+		return NULL;
+	}
+
+	const ident obj = *slotAtIndex(deque, 0);
+
+	deque->head = (deque->head + 1) & (deque->capacity - 1);
+	deque->count--;
+
+	return obj;
+}
+
+/**
+ * @fn ident MutableDeque::popLastObject(MutableDeque *self)
+ *
+ * @memberof MutableDeque
+ */
+static ident popLastObject(MutableDeque *self) {
+
+	Deque *deque = (Deque *) self;
+
+	if (deque->count == 0) {
+		return NULL;
+	}
+
+	return *slotAtIndex(deque, --deque->count);
+}
+
+/**
+ * @fn void MutableDeque::pushFirstObject(MutableDeque *self, const ident obj)
+ *
+ * @memberof MutableDeque
+ */
+static void pushFirstObject(MutableDeque *self, const ident obj) {
+
+	pushObject_resize(self);
+
+	Deque *deque = (Deque *) self;
+
+	deque->head = (deque->head - 1) & (deque->capacity - 1);
+	deque->elements[deque->head] = retain(obj);
+	deque->count++;
+}
+
+/**
+ * @fn void MutableDeque::pushLastObject(MutableDeque *self, const ident obj)
+ *
+ * @memberof MutableDeque
+ */
+static void pushLastObject(MutableDeque *self, const ident obj) {
+
+	pushObject_resize(self);
+
+	Deque *deque = (Deque *) self;
+
+	*slotAtIndex(deque, deque->count) = retain(obj);
+	deque->count++;
+}
+
+/**
+ * @fn void MutableDeque::removeAllObjects(MutableDeque *self)
+ *
+ * @memberof MutableDeque
+ */
+static void removeAllObjects(MutableDeque *self) {
+
+	Deque *deque = (Deque *) self;
+
+	const size_t head = deque->head, count = deque->count;
+
+	deque->head = deque->count = 0;
+
+	for (size_t i = 0; i < count; i++) {
+		release(deque->elements[(head + i) & (deque->capacity - 1)]);
+	}
+}
+
+/**
+ * @fn void MutableDeque::removeObject(MutableDeque *self, const ident obj)
+ *
+ * @memberof MutableDeque
+ */
+static void removeObject(MutableDeque *self, const ident obj) {
+
+	const int index = $((Deque *) self, indexOfObject, obj);
+	if (index != -1) {
+		$(self, removeObjectAtIndex, index);
+	}
+}
+
+/**
+ * @fn void MutableDeque::removeObjectAtIndex(MutableDeque *self, int index)
+ *
+ * @memberof MutableDeque
+ */
+static void removeObjectAtIndex(MutableDeque *self, int index) {
+
+	Deque *deque = (Deque *) self;
+
+	assert(index > -1);
+	assert(index < deque->count);
+
+	const ident obj = *slotAtIndex(deque, index);
+
+	if (index < deque->count / 2) {
+		for (size_t i = index; i > 0; i--) {
+			*slotAtIndex(deque, i) = *slotAtIndex(deque, i - 1);
+		}
+		deque->head = (deque->head + 1) & (deque->capacity - 1);
+	} else {
+		for (size_t i = index; i < deque->count - 1; i++) {
+			*slotAtIndex(deque, i) = *slotAtIndex(deque, i + 1);
+		}
+	}
+
+	deque->count--;
+
+	release(obj);
+}
+
+/**
+ * @fn void MutableDeque::trimToSize(MutableDeque *self)
+ *
+ * @memberof MutableDeque
+ */
+static void trimToSize(MutableDeque *self) {
+
+	Deque *deque = (Deque *) self;
+
+	size_t capacity = 0;
+	if (deque->count) {
+		capacity = 1;
+		while (capacity < deque->count) {
+			capacity <<= 1;
+		}
+	}
+
+	if (capacity < deque->capacity) {
+
+		ident *elements = NULL;
+		if (capacity) {
+
+			elements = calloc(capacity, sizeof(ident));
+			assert(elements);
+
+			for (size_t i = 0; i < deque->count; i++) {
+				elements[i] = *slotAtIndex(deque, i);
+			}
+		}
+
+		free(deque->elements);
+
+		deque->elements = elements;
+		deque->capacity = capacity;
+		deque->head = 0;
+	}
+}
+
+#pragma mark - Class lifecycle
+
+/**
+ * @see Class::initialize(Class *)
+ */
+static void initialize(Class *clazz) {
+
+	ObjectInterface *object = (ObjectInterface *) clazz->interface;
+
+	object->copy = copy;
+
+	MutableDequeInterface *mutableDeque = (MutableDequeInterface *) clazz->interface;
+
+	mutableDeque->deque = deque;
+	mutableDeque->dequeWithCapacity = dequeWithCapacity;
+	mutableDeque->drainObjects = drainObjects;
+	mutableDeque->init = init;
+	mutableDeque->initWithCapacity = initWithCapacity;
+	mutableDeque->popFirstObject = popFirstObject;
+	mutableDeque->popLastObject = popLastObject;
+	mutableDeque->pushFirstObject = pushFirstObject;
+	mutableDeque->pushLastObject = pushLastObject;
+	mutableDeque->removeAllObjects = removeAllObjects;
+	mutableDeque->removeObject = removeObject;
+	mutableDeque->removeObjectAtIndex = removeObjectAtIndex;
+	mutableDeque->trimToSize = trimToSize;
+}
+
+Class _MutableDeque = {
+	.name = "MutableDeque",
+	.superclass = &_Deque,
+	.instanceSize = sizeof(MutableDeque),
+	.interfaceOffset = offsetof(MutableDeque, interface),
+	.interfaceSize = sizeof(MutableDequeInterface),
+	.initialize = initialize,
+};
+
+#undef _Class
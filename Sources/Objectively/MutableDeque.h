@@ -0,0 +1,231 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#pragma once
+
+#include <Objectively/Deque.h>
+
+/**
+ * @file
+ *
+ * @brief Mutable double-ended queues.
+ */
+
+typedef struct MutableDequeInterface MutableDequeInterface;
+
+/**
+ * @brief Mutable double-ended queues.
+ *
+ * @details Objects may be pushed and popped at either end in amortized constant time, which
+ * makes MutableDeque well suited to FIFO and LIFO workloads.
+ *
+ * @extends Deque
+ *
+ * @ingroup Collections
+ */
+struct MutableDeque {
+
+	/**
+	 * @brief The parent.
+	 *
+	 * @private
+	 */
+	Deque deque;
+
+	/**
+	 * @brief The typed interface.
+	 *
+	 * @private
+	 */
+	MutableDequeInterface *interface;
+};
+
+/**
+ * @brief The MutableDeque interface.
+ */
+struct MutableDequeInterface {
+
+	/**
+	 * @brief The parent interface.
+	 */
+	DequeInterface dequeInterface;
+
+	/**
+	 * @static
+	 *
+	 * @fn MutableDeque *MutableDeque::deque(void)
+	 *
+	 * @brief Returns a new MutableDeque.
+	 *
+	 * @return The new MutableDeque, or `NULL` on error.
+	 *
+	 * @memberof MutableDeque
+	 */
+	MutableDeque *(*deque)(void);
+
+	/**
+	 * @static
+	 *
+	 * @fn MutableDeque *MutableDeque::dequeWithCapacity(size_t capacity)
+	 *
+	 * @brief Returns a new MutableDeque with the given `capacity`.
+	 *
+	 * @param capacity The desired initial capacity, rounded up to a power of two.
+	 *
+	 * @return The new MutableDeque, or `NULL` on error.
+	 *
+	 * @memberof MutableDeque
+	 */
+	MutableDeque *(*dequeWithCapacity)(size_t capacity);
+
+	/**
+	 * @fn Array *MutableDeque::drainObjects(MutableDeque *self, size_t count)
+	 *
+	 * @brief Removes up to `count` Objects from the front of this MutableDeque.
+	 *
+	 * @param count The maximum count of Objects to remove.
+	 *
+	 * @return An Array of the removed Objects, from first to last.
+	 *
+	 * @remarks The Objects are transferred to the Array without being retained again.
+	 *
+	 * @memberof MutableDeque
+	 */
+	Array *(*drainObjects)(MutableDeque *self, size_t count);
+
+	/**
+	 * @fn MutableDeque *MutableDeque::init(MutableDeque *self)
+	 *
+	 * @brief Initializes this MutableDeque.
+	 *
+	 * @return The initialized MutableDeque, or `NULL` on error.
+	 *
+	 * @memberof MutableDeque
+	 */
+	MutableDeque *(*init)(MutableDeque *self);
+
+	/**
+	 * @fn MutableDeque *MutableDeque::initWithCapacity(MutableDeque *self, size_t capacity)
+	 *
+	 * @brief Initializes this MutableDeque with the specified capacity.
+	 *
+	 * @param capacity The desired initial capacity, rounded up to a power of two.
+	 *
+	 * @return The initialized MutableDeque, or `NULL` on error.
+	 *
+	 * @memberof MutableDeque
+	 */
+	MutableDeque *(*initWithCapacity)(MutableDeque *self, size_t capacity);
+
+	/**
+	 * @fn ident MutableDeque::popFirstObject(MutableDeque *self)
+	 *
+	 * @brief Removes the first Object of this MutableDeque.
+	 *
+	 * @return The removed Object, which the caller must release, or `NULL` if empty.
+	 *
+	 * @memberof MutableDeque
+	 */
+	ident (*popFirstObject)(MutableDeque *self);
+
+	/**
+	 * @fn ident MutableDeque::popLastObject(MutableDeque *self)
+	 *
+	 * @brief Removes the last Object of this MutableDeque.
+	 *
+	 * @return The removed Object, which the caller must release, or `NULL` if empty.
+	 *
+	 * @memberof MutableDeque
+	 */
+	ident (*popLastObject)(MutableDeque *self);
+
+	/**
+	 * @fn void MutableDeque::pushFirstObject(MutableDeque *self, const ident obj)
+	 *
+	 * @brief Inserts the specified Object at the front of this MutableDeque.
+	 *
+	 * @param obj An Object.
+	 *
+	 * @memberof MutableDeque
+	 */
+	void (*pushFirstObject)(MutableDeque *self, const ident obj);
+
+	/**
+	 * @fn void MutableDeque::pushLastObject(MutableDeque *self, const ident obj)
+	 *
+	 * @brief Appends the specified Object to the back of this MutableDeque.
+	 *
+	 * @param obj An Object.
+	 *
+	 * @memberof MutableDeque
+	 */
+	void (*pushLastObject)(MutableDeque *self, const ident obj);
+
+	/**
+	 * @fn void MutableDeque::removeAllObjects(MutableDeque *self)
+	 *
+	 * @brief Removes all Objects from this MutableDeque.
+	 *
+	 * @memberof MutableDeque
+	 */
+	void (*removeAllObjects)(MutableDeque *self);
+
+	/**
+	 * @fn void MutableDeque::removeObject(MutableDeque *self, const ident obj)
+	 *
+	 * @brief Removes the first occurrence of the specified Object from this MutableDeque.
+	 *
+	 * @param obj The Object to remove.
+	 *
+	 * @memberof MutableDeque
+	 */
+	void (*removeObject)(MutableDeque *self, const ident obj);
+
+	/**
+	 * @fn void MutableDeque::removeObjectAtIndex(MutableDeque *self, int index)
+	 *
+	 * @brief Removes the Object at the specified index.
+	 *
+	 * @param index The index of the Object to remove.
+	 *
+	 * @remarks The elements on the shorter side of `index` are shifted, so that removal near
+	 * either end is cheap.
+	 *
+	 * @memberof MutableDeque
+	 */
+	void (*removeObjectAtIndex)(MutableDeque *self, int index);
+
+	/**
+	 * @fn void MutableDeque::trimToSize(MutableDeque *self)
+	 *
+	 * @brief Releases the capacity of this MutableDeque in excess of the smallest power of two that holds its count.
+	 *
+	 * @memberof MutableDeque
+	 */
+	void (*trimToSize)(MutableDeque *self);
+};
+
+/**
+ * @brief The MutableDeque Class.
+ */
+extern Class _MutableDeque;
@@ -53,6 +53,62 @@ static Object *copy(const Object *self) {
 
 #pragma mark - MutableDictionary
 
+/**
+ * @return The inline slot of `key` in `dict`, the first vacant slot in its probe sequence if
+ * `dict` does not contain `key`, or `DICTIONARY_INLINE_CAPACITY` if neither exists.
+ */
+static size_t inlineSlotForKey(const Dictionary *dict, const ident key) {
+
+	size_t slot = (size_t) HashForObject(HASH_SEED, key) % DICTIONARY_INLINE_CAPACITY;
+
+	for (size_t i = 0; i < DICTIONARY_INLINE_CAPACITY; i++) {
+
+		const ident k = dict->pairs[slot << 1];
+		if (k == NULL || k == key || $((Object *) k, isEqual, key)) {
+			return slot;
+		}
+
+		slot = (slot + 1) % DICTIONARY_INLINE_CAPACITY;
+	}
+
+	return DICTIONARY_INLINE_CAPACITY;
+}
+
+/**
+ * @brief Moves the inline pairs of `dict` into a hash table of `capacity` bins.
+ */
+static void inflate(Dictionary *dict, size_t capacity) {
+
+	dict->capacity = capacity;
+
+	dict->elements = calloc(dict->capacity, sizeof(ident));
+	assert(dict->elements);
+
+	for (size_t i = 0; i < lengthof(dict->pairs); i += 2) {
+
+		const ident key = dict->pairs[i];
+		const ident obj = dict->pairs[i + 1];
+
+		if (key) {
+
+			const size_t bin = HashForObject(HASH_SEED, key) % dict->capacity;
+
+			MutableArray *array = dict->elements[bin];
+			if (array == NULL) {
+				array = dict->elements[bin] = alloc(MutableArray, init);
+			}
+
+			$(array, addObject, key);
+			$(array, addObject, obj);
+
+			release(key);
+			release(obj);
+
+			dict->pairs[i] = dict->pairs[i + 1] = NULL;
+		}
+	}
+}
+
 /**
  * @brief DictionaryEnumerator for addEntriesFromDictionary.
  */
@@ -98,7 +154,7 @@ static MutableDictionary *dictionaryWithCapacity(size_t capacity) {
  */
 static MutableDictionary *init(MutableDictionary *self) {
 
-	return $(self, initWithCapacity, MUTABLEDICTIONARY_DEFAULT_CAPACITY);
+	return $(self, initWithCapacity, 0);
 }
 
 /**
@@ -111,8 +167,8 @@ static MutableDictionary *initWithCapacity(MutableDictionary *self, size_t capac
 	self = (MutableDictionary *) super(Object, self, init);
 	if (self) {
 
-		self->dictionary.capacity = capacity;
-		if (self->dictionary.capacity) {
+		if (capacity > DICTIONARY_INLINE_CAPACITY) {
+			self->dictionary.capacity = capacity;
 
 			self->dictionary.elements = calloc(self->dictionary.capacity, sizeof(ident));
 			assert(self->dictionary.elements);
@@ -138,9 +194,34 @@ static void removeAllObjects(MutableDictionary *self) {
 		}
 	}
 
+	for (size_t i = 0; i < lengthof(self->dictionary.pairs); i++) {
+		release(self->dictionary.pairs[i]);
+		self->dictionary.pairs[i] = NULL;
+	}
+
 	self->dictionary.count = 0;
 }
 
+/**
+ * @brief Reinserts the inline pairs of `dict` that follow the vacated `slot` in its probe sequence,
+ * so that they remain reachable.
+ */
+static void removeObjectForKey_reprobe(Dictionary *dict, size_t slot) {
+
+	for (size_t i = (slot + 1) % DICTIONARY_INLINE_CAPACITY; dict->pairs[i << 1]; i = (i + 1) % DICTIONARY_INLINE_CAPACITY) {
+
+		const ident key = dict->pairs[i << 1];
+		const ident obj = dict->pairs[(i << 1) + 1];
+
+		dict->pairs[i << 1] = dict->pairs[(i << 1) + 1] = NULL;
+
+		const size_t j = inlineSlotForKey(dict, key);
+
+		dict->pairs[j << 1] = key;
+		dict->pairs[(j << 1) + 1] = obj;
+	}
+}
+
 /**
  * @fn void MutableDictionary::removeObjectForKey(MutableDictionary *self, const ident key)
  *
@@ -148,6 +229,25 @@ static void removeAllObjects(MutableDictionary *self) {
  */
 static void removeObjectForKey(MutableDictionary *self, const ident key) {
 
+	Dictionary *dict = (Dictionary *) self;
+
+	if (dict->elements == NULL) {
+
+		const size_t slot = inlineSlotForKey(dict, key);
+		if (slot < DICTIONARY_INLINE_CAPACITY && dict->pairs[slot << 1]) {
+
+			release(dict->pairs[slot << 1]);
+			release(dict->pairs[(slot << 1) + 1]);
+
+			dict->pairs[slot << 1] = dict->pairs[(slot << 1) + 1] = NULL;
+			dict->count--;
+
+			removeObjectForKey_reprobe(dict, slot);
+		}
+
+		return;
+	}
+
 	const size_t bin = HashForObject(HASH_SEED, key) % self->dictionary.capacity;
 
 	MutableArray *array = self->dictionary.elements[bin];
@@ -170,47 +270,55 @@ static void removeObjectForKey(MutableDictionary *self, const ident key) {
 }
 
 /**
- * @brief A helper for resizing Dictionaries as pairs are added to them.
+ * @brief Rehashes the pairs of `dict` into `capacity` bins, or inline if `capacity` is 0.
  *
  * @remarks Static method invocations are used for all operations.
  */
-static void setObjectForKey_resize(Dictionary *dict) {
+static void resize(Dictionary *dict, size_t capacity) {
 
-	if (dict->capacity) {
+	const size_t oldCapacity = dict->capacity;
+	ident *elements = dict->elements;
 
-		const float load = dict->count / dict->capacity;
-		if (load >= MUTABLEDICTIONARY_MAX_LOAD) {
+	dict->capacity = capacity;
+	dict->count = 0;
 
-			size_t capacity = dict->capacity;
-			ident *elements = dict->elements;
+	if (dict->capacity) {
+		dict->elements = calloc(dict->capacity, sizeof(ident));
+		assert(dict->elements);
+	} else {
+		dict->elements = NULL;
+	}
 
-			dict->capacity = dict->capacity * MUTABLEDICTIONARY_GROW_FACTOR;
-			dict->count = 0;
+	for (size_t i = 0; i < oldCapacity; i++) {
 
-			dict->elements = calloc(dict->capacity, sizeof(ident));
-			assert(dict->elements);
+		Array *array = elements[i];
+		if (array) {
 
-			for (size_t i = 0; i < capacity; i++) {
+			for (size_t j = 0; j < array->count; j += 2) {
 
-				Array *array = elements[i];
-				if (array) {
+				ident key = $(array, objectAtIndex, j);
+				ident obj = $(array, objectAtIndex, j + 1);
 
-					for (size_t j = 0; j < array->count; j += 2) {
+				$$(MutableDictionary, setObjectForKey, (MutableDictionary *) dict, obj, key);
+			}
 
-						ident key = $(array, objectAtIndex, j);
-						ident obj = $(array, objectAtIndex, j + 1);
+			release(array);
+		}
+	}
 
-						$$(MutableDictionary, setObjectForKey, (MutableDictionary *) dict, obj, key);
-					}
+	free(elements);
+}
 
-					release(array);
-				}
-			}
+/**
+ * @brief A helper for resizing Dictionaries as pairs are added to them.
+ *
+ * @remarks Static method invocations are used for all operations.
+ */
+static void setObjectForKey_resize(Dictionary *dict) {
 
-			free(elements);
-		}
-	} else {
-		$$(MutableDictionary, initWithCapacity, (MutableDictionary *) dict, MUTABLEDICTIONARY_DEFAULT_CAPACITY);
+	const float load = dict->count / dict->capacity;
+	if (load >= MUTABLEDICTIONARY_MAX_LOAD) {
+		resize(dict, dict->capacity * MUTABLEDICTIONARY_GROW_FACTOR);
 	}
 }
 
@@ -223,6 +331,29 @@ static void setObjectForKey(MutableDictionary *self, const ident obj, const iden
 
 	Dictionary *dict = (Dictionary *) self;
 
+	if (dict->elements == NULL) {
+
+		const size_t slot = inlineSlotForKey(dict, key);
+		if (slot < DICTIONARY_INLINE_CAPACITY) {
+
+			ident *pair = dict->pairs + (slot << 1);
+			if (pair[0]) {
+				const ident replaced = pair[1];
+				pair[1] = retain(obj);
+				release(replaced);
+			} else {
+				pair[0] = retain(key);
+				pair[1] = retain(obj);
+
+				dict->count++;
+			}
+
+			return;
+		}
+
+		inflate(dict, MUTABLEDICTIONARY_DEFAULT_CAPACITY);
+	}
+
 	setObjectForKey_resize(dict);
 
 	const size_t bin = HashForObject(HASH_SEED, key) % dict->capacity;
@@ -268,6 +399,34 @@ static void setObjectsForKeys(MutableDictionary *self, ...) {
 	va_end(args);
 }
 
+/**
+ * @fn void MutableDictionary::trimToSize(MutableDictionary *self)
+ *
+ * @memberof MutableDictionary
+ */
+static void trimToSize(MutableDictionary *self) {
+
+	Dictionary *dict = (Dictionary *) self;
+
+	if (dict->capacity) {
+
+		if (dict->count <= DICTIONARY_INLINE_CAPACITY) {
+			resize(dict, 0);
+		} else {
+			const size_t capacity = dict->count / MUTABLEDICTIONARY_MAX_LOAD + 1;
+			if (capacity < dict->capacity) {
+				resize(dict, capacity);
+			}
+
+			for (size_t i = 0; i < dict->capacity; i++) {
+				if (dict->elements[i]) {
+					$((MutableArray *) dict->elements[i], trimToSize);
+				}
+			}
+		}
+	}
+}
+
 #pragma mark - Class lifecycle
 
 /**
@@ -290,6 +449,7 @@ static void initialize(Class *clazz) {
 	mutableDictionary->removeObjectForKey = removeObjectForKey;
 	mutableDictionary->setObjectForKey = setObjectForKey;
 	mutableDictionary->setObjectsForKeys = setObjectsForKeys;
+	mutableDictionary->trimToSize = trimToSize;
 }
 
 Class _MutableDictionary = {
@@ -124,6 +124,9 @@ struct MutableDictionaryInterface {
 	 *
 	 * @param capacity The initial capacity.
 	 *
+	 * @remarks Up to `DICTIONARY_INLINE_CAPACITY` pairs are stored inline, and the hash table is
+	 * allocated only once they are outgrown.
+	 *
 	 * @return The initialized MutableDictionary, or `NULL` on error.
 	 *
 	 * @memberof MutableDictionary
@@ -165,6 +168,15 @@ struct MutableDictionaryInterface {
 	 * @memberof MutableDictionary
 	 */
 	void (*setObjectsForKeys)(MutableDictionary *self, ...);
+
+	/**
+	 * @fn void MutableDictionary::trimToSize(MutableDictionary *self)
+	 *
+	 * @brief Releases the capacity of this MutableDictionary in excess of its count.
+	 *
+	 * @memberof MutableDictionary
+	 */
+	void (*trimToSize)(MutableDictionary *self);
 };
 
 /**
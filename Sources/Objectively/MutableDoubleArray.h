@@ -0,0 +1,195 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#pragma once
+
+#include <Objectively/DoubleArray.h>
+
+/**
+ * @file
+ *
+ * @brief Mutable arrays of unboxed `double` values.
+ */
+
+typedef struct MutableDoubleArrayInterface MutableDoubleArrayInterface;
+
+/**
+ * @brief Mutable arrays of unboxed `double` values.
+ *
+ * @extends DoubleArray
+ *
+ * @ingroup Collections
+ */
+struct MutableDoubleArray {
+
+	/**
+	 * @brief The parent.
+	 *
+	 * @private
+	 */
+	DoubleArray doubleArray;
+
+	/**
+	 * @brief The typed interface.
+	 *
+	 * @private
+	 */
+	MutableDoubleArrayInterface *interface;
+
+	/**
+	 * @brief The capacity, in values.
+	 *
+	 * @private
+	 */
+	size_t capacity;
+};
+
+/**
+ * @brief The MutableDoubleArray interface.
+ */
+struct MutableDoubleArrayInterface {
+
+	/**
+	 * @brief The parent interface.
+	 */
+	DoubleArrayInterface doubleArrayInterface;
+
+	/**
+	 * @fn void MutableDoubleArray::addValue(MutableDoubleArray *self, double value)
+	 *
+	 * @brief Adds the specified value to this MutableDoubleArray.
+	 *
+	 * @param value The value to add.
+	 *
+	 * @memberof MutableDoubleArray
+	 */
+	void (*addValue)(MutableDoubleArray *self, double value);
+
+	/**
+	 * @fn void MutableDoubleArray::addValues(MutableDoubleArray *self, const double *values, size_t count)
+	 *
+	 * @brief Adds the specified values to this MutableDoubleArray.
+	 *
+	 * @param values The values to add.
+	 * @param count The count of `values`.
+	 *
+	 * @memberof MutableDoubleArray
+	 */
+	void (*addValues)(MutableDoubleArray *self, const double *values, size_t count);
+
+	/**
+	 * @static
+	 *
+	 * @fn MutableDoubleArray *MutableDoubleArray::arrayWithCapacity(size_t capacity)
+	 *
+	 * @brief Returns a new MutableDoubleArray with the given `capacity`.
+	 *
+	 * @param capacity The desired initial capacity, in values.
+	 *
+	 * @return The new MutableDoubleArray, or `NULL` on error.
+	 *
+	 * @memberof MutableDoubleArray
+	 */
+	MutableDoubleArray *(*arrayWithCapacity)(size_t capacity);
+
+	/**
+	 * @fn MutableDoubleArray *MutableDoubleArray::init(MutableDoubleArray *self)
+	 *
+	 * @brief Initializes this MutableDoubleArray.
+	 *
+	 * @return The initialized MutableDoubleArray, or `NULL` on error.
+	 *
+	 * @memberof MutableDoubleArray
+	 */
+	MutableDoubleArray *(*init)(MutableDoubleArray *self);
+
+	/**
+	 * @fn MutableDoubleArray *MutableDoubleArray::initWithCapacity(MutableDoubleArray *self, size_t capacity)
+	 *
+	 * @brief Initializes this MutableDoubleArray with the specified capacity.
+	 *
+	 * @param capacity The desired initial capacity, in values.
+	 *
+	 * @return The initialized MutableDoubleArray, or `NULL` on error.
+	 *
+	 * @memberof MutableDoubleArray
+	 */
+	MutableDoubleArray *(*initWithCapacity)(MutableDoubleArray *self, size_t capacity);
+
+	/**
+	 * @fn void MutableDoubleArray::removeAllValues(MutableDoubleArray *self)
+	 *
+	 * @brief Removes all values from this MutableDoubleArray, retaining its capacity.
+	 *
+	 * @memberof MutableDoubleArray
+	 */
+	void (*removeAllValues)(MutableDoubleArray *self);
+
+	/**
+	 * @fn void MutableDoubleArray::removeValueAtIndex(MutableDoubleArray *self, int index)
+	 *
+	 * @brief Removes the value at the specified index.
+	 *
+	 * @param index The index of the value to remove.
+	 *
+	 * @memberof MutableDoubleArray
+	 */
+	void (*removeValueAtIndex)(MutableDoubleArray *self, int index);
+
+	/**
+	 * @fn void MutableDoubleArray::scale(MutableDoubleArray *self, double scalar)
+	 *
+	 * @brief Multiplies each value in this MutableDoubleArray by `scalar`.
+	 *
+	 * @param scalar The scalar.
+	 *
+	 * @memberof MutableDoubleArray
+	 */
+	void (*scale)(MutableDoubleArray *self, double scalar);
+
+	/**
+	 * @fn void MutableDoubleArray::setValueAtIndex(MutableDoubleArray *self, double value, int index)
+	 *
+	 * @brief Replaces the value at the specified index.
+	 *
+	 * @param value The value.
+	 * @param index The index of the value to replace.
+	 *
+	 * @memberof MutableDoubleArray
+	 */
+	void (*setValueAtIndex)(MutableDoubleArray *self, double value, int index);
+
+	/**
+	 * @fn void MutableDoubleArray::trimToSize(MutableDoubleArray *self)
+	 *
+	 * @brief Releases the capacity of this MutableDoubleArray in excess of its count.
+	 *
+	 * @memberof MutableDoubleArray
+	 */
+	void (*trimToSize)(MutableDoubleArray *self);
+};
+
+/**
+ * @brief The MutableDoubleArray Class.
+ */
+extern Class _MutableDoubleArray;
@@ -0,0 +1,542 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <Objectively/MutableIndexSet.h>
+
+#define _Class _MutableIndexSet
+
+/**
+ * @brief The count of 64 bit words in a bitmap container.
+ */
+#define INDEXSET_WORDS 1024
+
+/**
+ * @return The unsigned value of `index`, which sorts in the same order as `index`.
+ */
+static inline uint32_t valueForIndex(int index) {
+	return ((uint32_t) index) ^ 0x80000000u;
+}
+
+/**
+ * @return The index of the first element of `values` not less than `value`.
+ */
+static size_t lowerBound(const uint16_t *values, size_t length, uint16_t value) {
+
+	size_t low = 0, high = length;
+
+	while (low < high) {
+		const size_t mid = (low + high) >> 1;
+		if (values[mid] < value) {
+			low = mid + 1;
+		} else {
+			high = mid;
+		}
+	}
+
+	return low;
+}
+
+/**
+ * @return The index of the container with `key` in `self`, or where it would be inserted.
+ */
+static size_t indexOfContainer(const IndexSet *self, uint16_t key) {
+
+	size_t low = 0, high = self->containerCount;
+
+	while (low < high) {
+		const size_t mid = (low + high) >> 1;
+		if (self->containers[mid].key < key) {
+			low = mid + 1;
+		} else {
+			high = mid;
+		}
+	}
+
+	return low;
+}
+
+/**
+ * @brief Converts `container` to a bitmap container.
+ */
+static void convertToBitmap(IndexSetContainer *container) {
+
+	uint64_t *words = calloc(INDEXSET_WORDS, sizeof(uint64_t));
+	assert(words);
+
+	if (container->type == IndexSetContainerArray) {
+		for (uint32_t i = 0; i < container->length; i++) {
+			words[container->values[i] >> 6] |= 1ull << (container->values[i] & 63);
+		}
+	} else if (container->type == IndexSetContainerRun) {
+		for (uint32_t i = 0; i < container->length; i++) {
+			const IndexSetRun run = container->runs[i];
+			for (uint32_t value = run.start; value <= (uint32_t) run.start + run.length; value++) {
+				words[value >> 6] |= 1ull << (value & 63);
+			}
+		}
+	}
+
+	free(container->values);
+
+	container->type = IndexSetContainerBitmap;
+	container->words = words;
+	container->length = 0;
+	container->capacity = INDEXSET_WORDS;
+}
+
+/**
+ * @brief Releases the containers of `self`.
+ */
+static void freeContainers(MutableIndexSet *self) {
+
+	for (size_t i = 0; i < self->indexSet.containerCount; i++) {
+		free(self->indexSet.containers[i].values);
+	}
+
+	free(self->indexSet.containers);
+
+	self->indexSet.containers = NULL;
+	self->indexSet.containerCount = 0;
+	self->indexSet.count = 0;
+
+	self->capacity = 0;
+}
+
+/**
+ * @brief Replaces the contents of `self` with those of `indexSet`, and releases `indexSet`.
+ */
+static void adoptIndexSet(MutableIndexSet *self, IndexSet *indexSet) {
+
+	freeContainers(self);
+
+	self->indexSet.containers = indexSet->containers;
+	self->indexSet.containerCount = indexSet->containerCount;
+	self->indexSet.count = indexSet->count;
+
+	self->capacity = indexSet->containerCount;
+
+	indexSet->containers = NULL;
+	indexSet->containerCount = 0;
+	indexSet->count = 0;
+
+	release(indexSet);
+}
+
+/**
+ * @brief Releases the storage of `container` in excess of its contents, converting it to an array
+ * container if it is a sparse bitmap.
+ */
+static void trimContainer(IndexSetContainer *container) {
+
+	switch (container->type) {
+		case IndexSetContainerArray:
+			if (container->length && container->capacity > container->length) {
+				container->values = realloc(container->values, container->length * sizeof(uint16_t));
+				assert(container->values);
+				container->capacity = container->length;
+			}
+			break;
+
+		case IndexSetContainerBitmap:
+			if (container->cardinality <= INDEXSET_ARRAY_MAX) {
+
+				uint16_t *values = malloc(container->cardinality * sizeof(uint16_t));
+				assert(values);
+
+				uint32_t length = 0;
+				for (uint32_t i = 0; i < INDEXSET_WORDS; i++) {
+					for (uint64_t word = container->words[i]; word; word &= word - 1) {
+						values[length++] = (i << 6) | __builtin_ctzll(word);
+					}
+				}
+
+				free(container->words);
+
+				container->type = IndexSetContainerArray;
+				container->values = values;
+				container->length = container->capacity = length;
+			}
+			break;
+
+		case IndexSetContainerRun:
+			if (container->length && container->capacity > container->length) {
+				container->runs = realloc(container->runs, container->length * sizeof(IndexSetRun));
+				assert(container->runs);
+				container->capacity = container->length;
+			}
+			break;
+	}
+}
+
+#pragma mark - Object
+
+/**
+ * @see Object::sizeInBytes(const Object *)
+ */
+static size_t sizeInBytes(const Object *self) {
+
+	const MutableIndexSet *this = (MutableIndexSet *) self;
+
+	size_t size = super(Object, self, sizeInBytes);
+
+	if (this->capacity > this->indexSet.containerCount) {
+		size += (this->capacity - this->indexSet.containerCount) * sizeof(IndexSetContainer);
+	}
+
+	return size;
+}
+
+#pragma mark - MutableIndexSet
+
+/**
+ * @fn void MutableIndexSet::addIndex(MutableIndexSet *self, int index)
+ *
+ * @memberof MutableIndexSet
+ */
+static void addIndex(MutableIndexSet *self, int index) {
+
+	const uint32_t value = valueForIndex(index);
+	const uint16_t key = value >> 16, low = value & 0xffff;
+
+	IndexSet *indexSet = (IndexSet *) self;
+
+	const size_t i = indexOfContainer(indexSet, key);
+	if (i == indexSet->containerCount || indexSet->containers[i].key != key) {
+
+		if (indexSet->containerCount >= self->capacity) {
+			self->capacity = max(indexSet->containerCount << 1, (size_t) 4);
+
+			indexSet->containers = realloc(indexSet->containers, self->capacity * sizeof(IndexSetContainer));
+			assert(indexSet->containers);
+		}
+
+		IndexSetContainer *container = &indexSet->containers[i];
+		memmove(container + 1, container, (indexSet->containerCount - i) * sizeof(IndexSetContainer));
+
+		*container = (IndexSetContainer) {
+			.key = key,
+			.type = IndexSetContainerArray,
+			.cardinality = 1,
+			.length = 1,
+			.capacity = 4,
+		};
+
+		container->values = malloc(container->capacity * sizeof(uint16_t));
+		assert(container->values);
+
+		container->values[0] = low;
+
+		indexSet->containerCount++;
+		indexSet->count++;
+		return;
+	}
+
+	IndexSetContainer *container = &indexSet->containers[i];
+
+	if (container->type == IndexSetContainerArray) {
+
+		const size_t j = lowerBound(container->values, container->length, low);
+		if (j < container->length && container->values[j] == low) {
+			return;
+		}
+
+		if (container->length < INDEXSET_ARRAY_MAX) {
+
+			if (container->length == container->capacity) {
+				container->capacity = min(container->capacity << 1, (uint32_t) INDEXSET_ARRAY_MAX);
+
+				container->values = realloc(container->values, container->capacity * sizeof(uint16_t));
+				assert(container->values);
+			}
+
+			uint16_t *ptr = container->values + j;
+			memmove(ptr + 1, ptr, (container->length - j) * sizeof(uint16_t));
+
+			*ptr = low;
+
+			container->length++;
+			container->cardinality++;
+			indexSet->count++;
+			return;
+		}
+	}
+
+	if (container->type != IndexSetContainerBitmap) {
+		convertToBitmap(container);
+	}
+
+	const uint64_t bit = 1ull << (low & 63);
+	if ((container->words[low >> 6] & bit) == 0) {
+		container->words[low >> 6] |= bit;
+		container->cardinality++;
+		indexSet->count++;
+	}
+}
+
+/**
+ * @fn void MutableIndexSet::addIndexes(MutableIndexSet *self, const int *indexes, size_t count)
+ *
+ * @memberof MutableIndexSet
+ */
+static void addIndexes(MutableIndexSet *self, const int *indexes, size_t count) {
+
+	if (count) {
+		assert(indexes);
+
+		int *copy = malloc(count * sizeof(int));
+		assert(copy);
+
+		memcpy(copy, indexes, count * sizeof(int));
+
+		IndexSet *indexSet = alloc(IndexSet, initWithIndexes, copy, count);
+
+		$(self, unionWithIndexSet, indexSet);
+
+		release(indexSet);
+		free(copy);
+	}
+}
+
+/**
+ * @fn void MutableIndexSet::addIndexesInRange(MutableIndexSet *self, const Range range)
+ *
+ * @memberof MutableIndexSet
+ */
+static void addIndexesInRange(MutableIndexSet *self, const Range range) {
+
+	IndexSet *indexSet = alloc(IndexSet, initWithIndexesInRange, range);
+
+	$(self, unionWithIndexSet, indexSet);
+
+	release(indexSet);
+}
+
+/**
+ * @fn MutableIndexSet *MutableIndexSet::init(MutableIndexSet *self)
+ *
+ * @memberof MutableIndexSet
+ */
+static MutableIndexSet *init(MutableIndexSet *self) {
+	return $(self, initWithCapacity, 0);
+}
+
+/**
+ * @fn MutableIndexSet *MutableIndexSet::initWithCapacity(MutableIndexSet *self, size_t capacity)
+ *
+ * @memberof MutableIndexSet
+ */
+static MutableIndexSet *initWithCapacity(MutableIndexSet *self, size_t capacity) {
+
+	self = (MutableIndexSet *) super(IndexSet, self, init);
+	if (self) {
+
+		self->capacity = capacity;
+		if (self->capacity) {
+
+			self->indexSet.containers = calloc(self->capacity, sizeof(IndexSetContainer));
+			assert(self->indexSet.containers);
+		}
+	}
+
+	return self;
+}
+
+/**
+ * @fn void MutableIndexSet::intersectIndexSet(MutableIndexSet *self, const IndexSet *indexSet)
+ *
+ * @memberof MutableIndexSet
+ */
+static void intersectIndexSet(MutableIndexSet *self, const IndexSet *indexSet) {
+
+	assert(indexSet);
+
+	adoptIndexSet(self, $((IndexSet *) self, indexSetByIntersectingIndexSet, indexSet));
+}
+
+/**
+ * @fn void MutableIndexSet::minusIndexSet(MutableIndexSet *self, const IndexSet *indexSet)
+ *
+ * @memberof MutableIndexSet
+ */
+static void minusIndexSet(MutableIndexSet *self, const IndexSet *indexSet) {
+
+	assert(indexSet);
+
+	adoptIndexSet(self, $((IndexSet *) self, indexSetBySubtractingIndexSet, indexSet));
+}
+
+/**
+ * @fn void MutableIndexSet::removeAllIndexes(MutableIndexSet *self)
+ *
+ * @memberof MutableIndexSet
+ */
+static void removeAllIndexes(MutableIndexSet *self) {
+	freeContainers(self);
+}
+
+/**
+ * @fn void MutableIndexSet::removeIndex(MutableIndexSet *self, int index)
+ *
+ * @memberof MutableIndexSet
+ */
+static void removeIndex(MutableIndexSet *self, int index) {
+
+	const uint32_t value = valueForIndex(index);
+	const uint16_t key = value >> 16, low = value & 0xffff;
+
+	IndexSet *indexSet = (IndexSet *) self;
+
+	const size_t i = indexOfContainer(indexSet, key);
+	if (i == indexSet->containerCount || indexSet->containers[i].key != key) {
+		return;
+	}
+
+	IndexSetContainer *container = &indexSet->containers[i];
+
+	if (container->type == IndexSetContainerArray) {
+
+		const size_t j = lowerBound(container->values, container->length, low);
+		if (j == container->length || container->values[j] != low) {
+			return;
+		}
+
+		uint16_t *ptr = container->values + j;
+		memmove(ptr, ptr + 1, (container->length - j - 1) * sizeof(uint16_t));
+
+		container->length--;
+
+	} else {
+
+		if (container->type == IndexSetContainerRun) {
+			convertToBitmap(container);
+		}
+
+		const uint64_t bit = 1ull << (low & 63);
+		if ((container->words[low >> 6] & bit) == 0) {
+			return;
+		}
+
+		container->words[low >> 6] &= ~bit;
+	}
+
+	container->cardinality--;
+	indexSet->count--;
+
+	if (container->cardinality == 0) {
+
+		free(container->values);
+
+		memmove(container, container + 1, (indexSet->containerCount - i - 1) * sizeof(IndexSetContainer));
+		indexSet->containerCount--;
+	}
+}
+
+/**
+ * @fn void MutableIndexSet::removeIndexesInRange(MutableIndexSet *self, const Range range)
+ *
+ * @memberof MutableIndexSet
+ */
+static void removeIndexesInRange(MutableIndexSet *self, const Range range) {
+
+	IndexSet *indexSet = alloc(IndexSet, initWithIndexesInRange, range);
+
+	$(self, minusIndexSet, indexSet);
+
+	release(indexSet);
+}
+
+/**
+ * @fn void MutableIndexSet::trimToSize(MutableIndexSet *self)
+ *
+ * @memberof MutableIndexSet
+ */
+static void trimToSize(MutableIndexSet *self) {
+
+	for (size_t i = 0; i < self->indexSet.containerCount; i++) {
+		trimContainer(&self->indexSet.containers[i]);
+	}
+
+	if (self->indexSet.containerCount) {
+		self->indexSet.containers = realloc(self->indexSet.containers, self->indexSet.containerCount * sizeof(IndexSetContainer));
+		assert(self->indexSet.containers);
+	} else {
+		free(self->indexSet.containers);
+		self->indexSet.containers = NULL;
+	}
+
+	self->capacity = self->indexSet.containerCount;
+}
+
+/**
+ * @fn void MutableIndexSet::unionWithIndexSet(MutableIndexSet *self, const IndexSet *indexSet)
+ *
+ * @memberof MutableIndexSet
+ */
+static void unionWithIndexSet(MutableIndexSet *self, const IndexSet *indexSet) {
+
+	assert(indexSet);
+
+	if (indexSet->count) {
+		adoptIndexSet(self, $((IndexSet *) self, indexSetByUnioningIndexSet, indexSet));
+	}
+}
+
+#pragma mark - Class lifecycle
+
+/**
+ * @see Class::initialize(Class *)
+ */
+static void initialize(Class *clazz) {
+
+	((ObjectInterface *) clazz->interface)->sizeInBytes = sizeInBytes;
+
+	MutableIndexSetInterface *mutableIndexSet = (MutableIndexSetInterface *) clazz->interface;
+
+	mutableIndexSet->addIndex = addIndex;
+	mutableIndexSet->addIndexes = addIndexes;
+	mutableIndexSet->addIndexesInRange = addIndexesInRange;
+	mutableIndexSet->init = init;
+	mutableIndexSet->initWithCapacity = initWithCapacity;
+	mutableIndexSet->intersectIndexSet = intersectIndexSet;
+	mutableIndexSet->minusIndexSet = minusIndexSet;
+	mutableIndexSet->removeAllIndexes = removeAllIndexes;
+	mutableIndexSet->removeIndex = removeIndex;
+	mutableIndexSet->removeIndexesInRange = removeIndexesInRange;
+	mutableIndexSet->trimToSize = trimToSize;
+	mutableIndexSet->unionWithIndexSet = unionWithIndexSet;
+}
+
+Class _MutableIndexSet = {
+	.name = "MutableIndexSet",
+	.superclass = &_IndexSet,
+	.instanceSize = sizeof(MutableIndexSet),
+	.interfaceOffset = offsetof(MutableIndexSet, interface),
+	.interfaceSize = sizeof(MutableIndexSetInterface),
+	.initialize = initialize,
+};
+
+#undef _Class
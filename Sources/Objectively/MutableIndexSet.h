@@ -0,0 +1,214 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#pragma once
+
+#include <Objectively/IndexSet.h>
+
+/**
+ * @file
+ *
+ * @brief Mutable index sets.
+ */
+
+typedef struct MutableIndexSetInterface MutableIndexSetInterface;
+
+/**
+ * @brief Mutable index sets.
+ *
+ * @details Single indexes are added and removed in place. Array containers are promoted to
+ * bitmaps once they exceed `INDEXSET_ARRAY_MAX` indexes, and run containers are expanded to
+ * bitmaps when they are modified.
+ *
+ * @extends IndexSet
+ */
+struct MutableIndexSet {
+
+	/**
+	 * @brief The parent.
+	 *
+	 * @private
+	 */
+	IndexSet indexSet;
+
+	/**
+	 * @brief The typed interface.
+	 *
+	 * @private
+	 */
+	MutableIndexSetInterface *interface;
+
+	/**
+	 * @brief The capacity of `containers`.
+	 *
+	 * @private
+	 */
+	size_t capacity;
+};
+
+/**
+ * @brief The MutableIndexSet interface.
+ */
+struct MutableIndexSetInterface {
+
+	/**
+	 * @brief The parent interface.
+	 */
+	IndexSetInterface indexSetInterface;
+
+	/**
+	 * @fn void MutableIndexSet::addIndex(MutableIndexSet *self, int index)
+	 *
+	 * @brief Adds the specified index to this MutableIndexSet.
+	 *
+	 * @param index The index.
+	 *
+	 * @memberof MutableIndexSet
+	 */
+	void (*addIndex)(MutableIndexSet *self, int index);
+
+	/**
+	 * @fn void MutableIndexSet::addIndexes(MutableIndexSet *self, const int *indexes, size_t count)
+	 *
+	 * @brief Adds the specified indexes to this MutableIndexSet.
+	 *
+	 * @param indexes The indexes.
+	 * @param count The count of `indexes`.
+	 *
+	 * @memberof MutableIndexSet
+	 */
+	void (*addIndexes)(MutableIndexSet *self, const int *indexes, size_t count);
+
+	/**
+	 * @fn void MutableIndexSet::addIndexesInRange(MutableIndexSet *self, const Range range)
+	 *
+	 * @brief Adds the indexes in the specified Range to this MutableIndexSet.
+	 *
+	 * @param range The Range.
+	 *
+	 * @memberof MutableIndexSet
+	 */
+	void (*addIndexesInRange)(MutableIndexSet *self, const Range range);
+
+	/**
+	 * @fn MutableIndexSet *MutableIndexSet::init(MutableIndexSet *self)
+	 *
+	 * @brief Initializes this MutableIndexSet.
+	 *
+	 * @return The initialized MutableIndexSet, or `NULL` on error.
+	 *
+	 * @memberof MutableIndexSet
+	 */
+	MutableIndexSet *(*init)(MutableIndexSet *self);
+
+	/**
+	 * @fn MutableIndexSet *MutableIndexSet::initWithCapacity(MutableIndexSet *self, size_t capacity)
+	 *
+	 * @brief Initializes this MutableIndexSet with the specified capacity.
+	 *
+	 * @param capacity The desired initial capacity, in containers of 65536 indexes.
+	 *
+	 * @return The initialized MutableIndexSet, or `NULL` on error.
+	 *
+	 * @memberof MutableIndexSet
+	 */
+	MutableIndexSet *(*initWithCapacity)(MutableIndexSet *self, size_t capacity);
+
+	/**
+	 * @fn void MutableIndexSet::intersectIndexSet(MutableIndexSet *self, const IndexSet *indexSet)
+	 *
+	 * @brief Removes the indexes of this MutableIndexSet which are not in `indexSet`.
+	 *
+	 * @param indexSet An IndexSet.
+	 *
+	 * @memberof MutableIndexSet
+	 */
+	void (*intersectIndexSet)(MutableIndexSet *self, const IndexSet *indexSet);
+
+	/**
+	 * @fn void MutableIndexSet::minusIndexSet(MutableIndexSet *self, const IndexSet *indexSet)
+	 *
+	 * @brief Removes the indexes of `indexSet` from this MutableIndexSet.
+	 *
+	 * @param indexSet An IndexSet.
+	 *
+	 * @memberof MutableIndexSet
+	 */
+	void (*minusIndexSet)(MutableIndexSet *self, const IndexSet *indexSet);
+
+	/**
+	 * @fn void MutableIndexSet::removeAllIndexes(MutableIndexSet *self)
+	 *
+	 * @brief Removes all indexes from this MutableIndexSet.
+	 *
+	 * @memberof MutableIndexSet
+	 */
+	void (*removeAllIndexes)(MutableIndexSet *self);
+
+	/**
+	 * @fn void MutableIndexSet::removeIndex(MutableIndexSet *self, int index)
+	 *
+	 * @brief Removes the specified index from this MutableIndexSet.
+	 *
+	 * @param index The index.
+	 *
+	 * @memberof MutableIndexSet
+	 */
+	void (*removeIndex)(MutableIndexSet *self, int index);
+
+	/**
+	 * @fn void MutableIndexSet::removeIndexesInRange(MutableIndexSet *self, const Range range)
+	 *
+	 * @brief Removes the indexes in the specified Range from this MutableIndexSet.
+	 *
+	 * @param range The Range.
+	 *
+	 * @memberof MutableIndexSet
+	 */
+	void (*removeIndexesInRange)(MutableIndexSet *self, const Range range);
+
+	/**
+	 * @fn void MutableIndexSet::trimToSize(MutableIndexSet *self)
+	 *
+	 * @brief Releases the capacity of this MutableIndexSet in excess of its containers, converting sparse bitmap containers to arrays.
+	 *
+	 * @memberof MutableIndexSet
+	 */
+	void (*trimToSize)(MutableIndexSet *self);
+
+	/**
+	 * @fn void MutableIndexSet::unionWithIndexSet(MutableIndexSet *self, const IndexSet *indexSet)
+	 *
+	 * @brief Adds the indexes of `indexSet` to this MutableIndexSet.
+	 *
+	 * @param indexSet An IndexSet.
+	 *
+	 * @memberof MutableIndexSet
+	 */
+	void (*unionWithIndexSet)(MutableIndexSet *self, const IndexSet *indexSet);
+};
+
+/**
+ * @brief The MutableIndexSet Class.
+ */
+extern Class _MutableIndexSet;
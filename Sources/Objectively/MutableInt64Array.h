@@ -0,0 +1,195 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#pragma once
+
+#include <Objectively/Int64Array.h>
+
+/**
+ * @file
+ *
+ * @brief Mutable arrays of unboxed `int64_t` values.
+ */
+
+typedef struct MutableInt64ArrayInterface MutableInt64ArrayInterface;
+
+/**
+ * @brief Mutable arrays of unboxed `int64_t` values.
+ *
+ * @extends Int64Array
+ *
+ * @ingroup Collections
+ */
+struct MutableInt64Array {
+
+	/**
+	 * @brief The parent.
+	 *
+	 * @private
+	 */
+	Int64Array int64Array;
+
+	/**
+	 * @brief The typed interface.
+	 *
+	 * @private
+	 */
+	MutableInt64ArrayInterface *interface;
+
+	/**
+	 * @brief The capacity, in values.
+	 *
+	 * @private
+	 */
+	size_t capacity;
+};
+
+/**
+ * @brief The MutableInt64Array interface.
+ */
+struct MutableInt64ArrayInterface {
+
+	/**
+	 * @brief The parent interface.
+	 */
+	Int64ArrayInterface int64ArrayInterface;
+
+	/**
+	 * @fn void MutableInt64Array::addValue(MutableInt64Array *self, int64_t value)
+	 *
+	 * @brief Adds the specified value to this MutableInt64Array.
+	 *
+	 * @param value The value to add.
+	 *
+	 * @memberof MutableInt64Array
+	 */
+	void (*addValue)(MutableInt64Array *self, int64_t value);
+
+	/**
+	 * @fn void MutableInt64Array::addValues(MutableInt64Array *self, const int64_t *values, size_t count)
+	 *
+	 * @brief Adds the specified values to this MutableInt64Array.
+	 *
+	 * @param values The values to add.
+	 * @param count The count of `values`.
+	 *
+	 * @memberof MutableInt64Array
+	 */
+	void (*addValues)(MutableInt64Array *self, const int64_t *values, size_t count);
+
+	/**
+	 * @static
+	 *
+	 * @fn MutableInt64Array *MutableInt64Array::arrayWithCapacity(size_t capacity)
+	 *
+	 * @brief Returns a new MutableInt64Array with the given `capacity`.
+	 *
+	 * @param capacity The desired initial capacity, in values.
+	 *
+	 * @return The new MutableInt64Array, or `NULL` on error.
+	 *
+	 * @memberof MutableInt64Array
+	 */
+	MutableInt64Array *(*arrayWithCapacity)(size_t capacity);
+
+	/**
+	 * @fn MutableInt64Array *MutableInt64Array::init(MutableInt64Array *self)
+	 *
+	 * @brief Initializes this MutableInt64Array.
+	 *
+	 * @return The initialized MutableInt64Array, or `NULL` on error.
+	 *
+	 * @memberof MutableInt64Array
+	 */
+	MutableInt64Array *(*init)(MutableInt64Array *self);
+
+	/**
+	 * @fn MutableInt64Array *MutableInt64Array::initWithCapacity(MutableInt64Array *self, size_t capacity)
+	 *
+	 * @brief Initializes this MutableInt64Array with the specified capacity.
+	 *
+	 * @param capacity The desired initial capacity, in values.
+	 *
+	 * @return The initialized MutableInt64Array, or `NULL` on error.
+	 *
+	 * @memberof MutableInt64Array
+	 */
+	MutableInt64Array *(*initWithCapacity)(MutableInt64Array *self, size_t capacity);
+
+	/**
+	 * @fn void MutableInt64Array::removeAllValues(MutableInt64Array *self)
+	 *
+	 * @brief Removes all values from this MutableInt64Array, retaining its capacity.
+	 *
+	 * @memberof MutableInt64Array
+	 */
+	void (*removeAllValues)(MutableInt64Array *self);
+
+	/**
+	 * @fn void MutableInt64Array::removeValueAtIndex(MutableInt64Array *self, int index)
+	 *
+	 * @brief Removes the value at the specified index.
+	 *
+	 * @param index The index of the value to remove.
+	 *
+	 * @memberof MutableInt64Array
+	 */
+	void (*removeValueAtIndex)(MutableInt64Array *self, int index);
+
+	/**
+	 * @fn void MutableInt64Array::scale(MutableInt64Array *self, int64_t scalar)
+	 *
+	 * @brief Multiplies each value in this MutableInt64Array by `scalar`.
+	 *
+	 * @param scalar The scalar.
+	 *
+	 * @memberof MutableInt64Array
+	 */
+	void (*scale)(MutableInt64Array *self, int64_t scalar);
+
+	/**
+	 * @fn void MutableInt64Array::setValueAtIndex(MutableInt64Array *self, int64_t value, int index)
+	 *
+	 * @brief Replaces the value at the specified index.
+	 *
+	 * @param value The value.
+	 * @param index The index of the value to replace.
+	 *
+	 * @memberof MutableInt64Array
+	 */
+	void (*setValueAtIndex)(MutableInt64Array *self, int64_t value, int index);
+
+	/**
+	 * @fn void MutableInt64Array::trimToSize(MutableInt64Array *self)
+	 *
+	 * @brief Releases the capacity of this MutableInt64Array in excess of its count.
+	 *
+	 * @memberof MutableInt64Array
+	 */
+	void (*trimToSize)(MutableInt64Array *self);
+};
+
+/**
+ * @brief The MutableInt64Array Class.
+ */
+extern Class _MutableInt64Array;
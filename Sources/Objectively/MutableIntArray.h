@@ -0,0 +1,195 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#pragma once
+
+#include <Objectively/IntArray.h>
+
+/**
+ * @file
+ *
+ * @brief Mutable arrays of unboxed `int` values.
+ */
+
+typedef struct MutableIntArrayInterface MutableIntArrayInterface;
+
+/**
+ * @brief Mutable arrays of unboxed `int` values.
+ *
+ * @extends IntArray
+ *
+ * @ingroup Collections
+ */
+struct MutableIntArray {
+
+	/**
+	 * @brief The parent.
+	 *
+	 * @private
+	 */
+	IntArray intArray;
+
+	/**
+	 * @brief The typed interface.
+	 *
+	 * @private
+	 */
+	MutableIntArrayInterface *interface;
+
+	/**
+	 * @brief The capacity, in values.
+	 *
+	 * @private
+	 */
+	size_t capacity;
+};
+
+/**
+ * @brief The MutableIntArray interface.
+ */
+struct MutableIntArrayInterface {
+
+	/**
+	 * @brief The parent interface.
+	 */
+	IntArrayInterface intArrayInterface;
+
+	/**
+	 * @fn void MutableIntArray::addValue(MutableIntArray *self, int value)
+	 *
+	 * @brief Adds the specified value to this MutableIntArray.
+	 *
+	 * @param value The value to add.
+	 *
+	 * @memberof MutableIntArray
+	 */
+	void (*addValue)(MutableIntArray *self, int value);
+
+	/**
+	 * @fn void MutableIntArray::addValues(MutableIntArray *self, const int *values, size_t count)
+	 *
+	 * @brief Adds the specified values to this MutableIntArray.
+	 *
+	 * @param values The values to add.
+	 * @param count The count of `values`.
+	 *
+	 * @memberof MutableIntArray
+	 */
+	void (*addValues)(MutableIntArray *self, const int *values, size_t count);
+
+	/**
+	 * @static
+	 *
+	 * @fn MutableIntArray *MutableIntArray::arrayWithCapacity(size_t capacity)
+	 *
+	 * @brief Returns a new MutableIntArray with the given `capacity`.
+	 *
+	 * @param capacity The desired initial capacity, in values.
+	 *
+	 * @return The new MutableIntArray, or `NULL` on error.
+	 *
+	 * @memberof MutableIntArray
+	 */
+	MutableIntArray *(*arrayWithCapacity)(size_t capacity);
+
+	/**
+	 * @fn MutableIntArray *MutableIntArray::init(MutableIntArray *self)
+	 *
+	 * @brief Initializes this MutableIntArray.
+	 *
+	 * @return The initialized MutableIntArray, or `NULL` on error.
+	 *
+	 * @memberof MutableIntArray
+	 */
+	MutableIntArray *(*init)(MutableIntArray *self);
+
+	/**
+	 * @fn MutableIntArray *MutableIntArray::initWithCapacity(MutableIntArray *self, size_t capacity)
+	 *
+	 * @brief Initializes this MutableIntArray with the specified capacity.
+	 *
+	 * @param capacity The desired initial capacity, in values.
+	 *
+	 * @return The initialized MutableIntArray, or `NULL` on error.
+	 *
+	 * @memberof MutableIntArray
+	 */
+	MutableIntArray *(*initWithCapacity)(MutableIntArray *self, size_t capacity);
+
+	/**
+	 * @fn void MutableIntArray::removeAllValues(MutableIntArray *self)
+	 *
+	 * @brief Removes all values from this MutableIntArray, retaining its capacity.
+	 *
+	 * @memberof MutableIntArray
+	 */
+	void (*removeAllValues)(MutableIntArray *self);
+
+	/**
+	 * @fn void MutableIntArray::removeValueAtIndex(MutableIntArray *self, int index)
+	 *
+	 * @brief Removes the value at the specified index.
+	 *
+	 * @param index The index of the value to remove.
+	 *
+	 * @memberof MutableIntArray
+	 */
+	void (*removeValueAtIndex)(MutableIntArray *self, int index);
+
+	/**
+	 * @fn void MutableIntArray::scale(MutableIntArray *self, int scalar)
+	 *
+	 * @brief Multiplies each value in this MutableIntArray by `scalar`.
+	 *
+	 * @param scalar The scalar.
+	 *
+	 * @memberof MutableIntArray
+	 */
+	void (*scale)(MutableIntArray *self, int scalar);
+
+	/**
+	 * @fn void MutableIntArray::setValueAtIndex(MutableIntArray *self, int value, int index)
+	 *
+	 * @brief Replaces the value at the specified index.
+	 *
+	 * @param value The value.
+	 * @param index The index of the value to replace.
+	 *
+	 * @memberof MutableIntArray
+	 */
+	void (*setValueAtIndex)(MutableIntArray *self, int value, int index);
+
+	/**
+	 * @fn void MutableIntArray::trimToSize(MutableIntArray *self)
+	 *
+	 * @brief Releases the capacity of this MutableIntArray in excess of its count.
+	 *
+	 * @memberof MutableIntArray
+	 */
+	void (*trimToSize)(MutableIntArray *self);
+};
+
+/**
+ * @brief The MutableIntArray Class.
+ */
+extern Class _MutableIntArray;
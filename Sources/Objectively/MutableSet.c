@@ -24,6 +24,7 @@
 #include <assert.h>
 #include <stdarg.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include <Objectively/Hash.h>
 #include <Objectively/MutableArray.h>
@@ -53,6 +54,71 @@ static Object *copy(const Object *self) {
 
 #pragma mark - MutableSet
 
+/**
+ * @return The inline slot of `obj` in `set`, the first vacant slot in its probe sequence if `set`
+ * does not contain `obj`, or `SET_INLINE_CAPACITY` if neither exists.
+ */
+static size_t inlineSlotForObject(const Set *set, const ident obj) {
+
+	size_t slot = (size_t) HashForObject(HASH_SEED, obj) % SET_INLINE_CAPACITY;
+
+	for (size_t i = 0; i < SET_INLINE_CAPACITY; i++) {
+
+		const ident object = set->objects[slot];
+		if (object == NULL || object == obj || $((Object *) object, isEqual, obj)) {
+			return slot;
+		}
+
+		slot = (slot + 1) % SET_INLINE_CAPACITY;
+	}
+
+	return SET_INLINE_CAPACITY;
+}
+
+/**
+ * @brief Rehashes the Objects of `set`, including any stored inline, into `capacity` bins, or
+ * inline if `capacity` is 0.
+ *
+ * @remarks Static method invocations are used for all operations.
+ */
+static void resize(Set *set, size_t capacity) {
+
+	const size_t oldCapacity = set->capacity;
+	ident *elements = set->elements;
+
+	set->capacity = capacity;
+	set->count = 0;
+
+	if (set->capacity) {
+		set->elements = calloc(set->capacity, sizeof(ident));
+		assert(set->elements);
+	} else {
+		set->elements = NULL;
+	}
+
+	for (size_t i = 0; i < oldCapacity; i++) {
+
+		Array *array = elements[i];
+		if (array) {
+			$$(MutableSet, addObjectsFromArray, (MutableSet *) set, array);
+			release(array);
+		}
+	}
+
+	free(elements);
+
+	for (size_t i = 0; i < lengthof(set->objects); i++) {
+
+		const ident obj = set->objects[i];
+		if (obj) {
+			set->objects[i] = NULL;
+
+			$$(MutableSet, addObject, (MutableSet *) set, obj);
+			release(obj);
+		}
+	}
+}
+
 /**
  * @brief A helper for resizing Sets as Objects are added to them.
  *
@@ -60,33 +126,84 @@ static Object *copy(const Object *self) {
  */
 static void addObject_resize(Set *set) {
 
-	if (set->capacity) {
+	const float load = set->count / set->capacity;
+	if (load >= MUTABLESET_MAX_LOAD) {
+		resize(set, set->capacity * MUTABLESET_GROW_FACTOR);
+	}
+}
 
-		const float load = set->count / set->capacity;
-		if (load >= MUTABLESET_MAX_LOAD) {
+/**
+ * @return The index of the bin of `set` for `obj`, which resides in bin `bin` of a Set with
+ * `capacity` bins.
+ *
+ * @remarks Objects occupy the same bin in Sets of equal capacity, so `obj` is only hashed if the
+ * capacities differ.
+ */
+static size_t binForObject(const Set *set, const ident obj, size_t capacity, size_t bin) {
+	return set->capacity == capacity ? bin : HashForObject(HASH_SEED, obj) % set->capacity;
+}
 
-			size_t capacity = set->capacity;
-			ident *elements = set->elements;
+/**
+ * @return True if `set` contains `obj`, which resides in bin `bin` of a Set with `capacity` bins.
+ */
+static _Bool containsObjectInBin(const Set *set, const ident obj, size_t capacity, size_t bin) {
 
-			set->capacity = set->capacity * MUTABLESET_GROW_FACTOR;
-			set->count = 0;
+	if (set->elements == NULL) {
+		return $(set, containsObject, obj);
+	}
 
-			set->elements = calloc(set->capacity, sizeof(ident));
-			assert(set->elements);
+	const Array *array = set->elements[binForObject(set, obj, capacity, bin)];
+	if (array) {
+		return $(array, containsObject, obj);
+	}
 
-			for (size_t i = 0; i < capacity; i++) {
+	return false;
+}
 
-				Array *array = elements[i];
-				if (array) {
-					$$(MutableSet, addObjectsFromArray, (MutableSet *) set, array);
-					release(array);
+/**
+ * @brief Removes the Objects of `self` whose membership in `set` equals `isMember`.
+ */
+static void removeObjectsByMembership(MutableSet *self, const Set *set, _Bool isMember) {
+
+	if (self->set.elements == NULL) {
+
+		ident removals[SET_INLINE_CAPACITY];
+		size_t count = 0;
+
+		for (size_t i = 0; i < lengthof(self->set.objects); i++) {
+
+			const ident obj = self->set.objects[i];
+			if (obj && containsObjectInBin(set, obj, self->set.capacity, i) == isMember) {
+				removals[count++] = obj;
+			}
+		}
+
+		for (size_t i = 0; i < count; i++) {
+			$(self, removeObject, removals[i]);
+		}
+
+		return;
+	}
+
+	for (size_t i = 0; i < self->set.capacity; i++) {
+
+		MutableArray *array = self->set.elements[i];
+		if (array) {
+
+			for (size_t j = ((Array *) array)->count; j > 0; j--) {
+
+				const ident obj = ((Array *) array)->elements[j - 1];
+				if (containsObjectInBin(set, obj, self->set.capacity, i) == isMember) {
+					$(array, removeObjectAtIndex, j - 1);
+					self->set.count--;
 				}
 			}
 
-			free(elements);
+			if (((Array *) array)->count == 0) {
+				release(array);
+				self->set.elements[i] = NULL;
+			}
 		}
-	} else {
-		$$(MutableSet, initWithCapacity, (MutableSet *) set, MUTABLESET_DEFAULT_CAPACITY);
 	}
 }
 
@@ -99,6 +216,22 @@ static void addObject(MutableSet *self, const ident obj) {
 
 	Set *set = (Set *) self;
 
+	if (set->elements == NULL) {
+
+		const size_t slot = inlineSlotForObject(set, obj);
+		if (slot < SET_INLINE_CAPACITY) {
+
+			if (set->objects[slot] == NULL) {
+				set->objects[slot] = retain(obj);
+				set->count++;
+			}
+
+			return;
+		}
+
+		resize(set, MUTABLESET_DEFAULT_CAPACITY);
+	}
+
 	addObject_resize(set);
 
 	const size_t bin = HashForObject(HASH_SEED, obj) % set->capacity;
@@ -159,7 +292,7 @@ static void addObjectsFromSet(MutableSet *self, const Set *set) {
  */
 static MutableSet *init(MutableSet *self) {
 
-	return $(self, initWithCapacity, MUTABLESET_DEFAULT_CAPACITY);
+	return $(self, initWithCapacity, 0);
 }
 
 /**
@@ -172,8 +305,8 @@ static MutableSet *initWithCapacity(MutableSet *self, size_t capacity) {
 	self = (MutableSet *) super(Object, self, init);
 	if (self) {
 
-		self->set.capacity = capacity;
-		if (self->set.capacity) {
+		if (capacity > SET_INLINE_CAPACITY) {
+			self->set.capacity = capacity;
 
 			self->set.elements = calloc(self->set.capacity, sizeof(ident));
 			assert(self->set.elements);
@@ -183,6 +316,93 @@ static MutableSet *initWithCapacity(MutableSet *self, size_t capacity) {
 	return self;
 }
 
+/**
+ * @fn void MutableSet::intersectSet(MutableSet *self, const Set *set)
+ *
+ * @memberof MutableSet
+ */
+static void intersectSet(MutableSet *self, const Set *set) {
+
+	assert(set);
+
+	if (set->count < self->set.count) {
+
+		Set *result = $((Set *) self, setByIntersectingSet, set);
+
+		$(self, removeAllObjects);
+		free(self->set.elements);
+
+		self->set.capacity = result->capacity;
+		self->set.count = result->count;
+		self->set.elements = result->elements;
+
+		memcpy(self->set.objects, result->objects, sizeof(result->objects));
+
+		result->capacity = result->count = 0;
+		result->elements = NULL;
+
+		memset(result->objects, 0, sizeof(result->objects));
+
+		release(result);
+	} else {
+		removeObjectsByMembership(self, set, false);
+	}
+}
+
+/**
+ * @fn void MutableSet::minusSet(MutableSet *self, const Set *set)
+ *
+ * @memberof MutableSet
+ */
+static void minusSet(MutableSet *self, const Set *set) {
+
+	assert(set);
+
+	if (set->count < self->set.count) {
+
+		if (self->set.elements && set->elements) {
+
+			for (size_t i = 0; i < set->capacity; i++) {
+
+				const Array *array = set->elements[i];
+				if (array) {
+
+					for (size_t j = 0; j < array->count; j++) {
+
+						const ident obj = array->elements[j];
+						const size_t bin = binForObject((Set *) self, obj, set->capacity, i);
+
+						MutableArray *objects = self->set.elements[bin];
+						if (objects) {
+
+							const int index = $((Array *) objects, indexOfObject, obj);
+							if (index > -1) {
+
+								$(objects, removeObjectAtIndex, index);
+
+								if (((Array *) objects)->count == 0) {
+									release(objects);
+									self->set.elements[bin] = NULL;
+								}
+
+								self->set.count--;
+							}
+						}
+					}
+				}
+			}
+		} else {
+
+			ident obj;
+			SetForEach(obj, set) {
+				$(self, removeObject, obj);
+			}
+		}
+	} else {
+		removeObjectsByMembership(self, set, true);
+	}
+}
+
 /**
  * @fn void MutableSet::removeAllObjects(MutableSet *self)
  *
@@ -199,9 +419,29 @@ static void removeAllObjects(MutableSet *self) {
 		}
 	}
 
+	for (size_t i = 0; i < lengthof(self->set.objects); i++) {
+		release(self->set.objects[i]);
+		self->set.objects[i] = NULL;
+	}
+
 	self->set.count = 0;
 }
 
+/**
+ * @brief Reinserts the inline Objects of `set` that follow the vacated `slot` in its probe
+ * sequence, so that they remain reachable.
+ */
+static void removeObject_reprobe(Set *set, size_t slot) {
+
+	for (size_t i = (slot + 1) % SET_INLINE_CAPACITY; set->objects[i]; i = (i + 1) % SET_INLINE_CAPACITY) {
+
+		const ident obj = set->objects[i];
+		set->objects[i] = NULL;
+
+		set->objects[inlineSlotForObject(set, obj)] = obj;
+	}
+}
+
 /**
  * @fn void MutableSet::removeObject(MutableSet *self, const ident obj)
  *
@@ -209,6 +449,23 @@ static void removeAllObjects(MutableSet *self) {
  */
 static void removeObject(MutableSet *self, const ident obj) {
 
+	Set *set = (Set *) self;
+
+	if (set->elements == NULL) {
+
+		const size_t slot = inlineSlotForObject(set, obj);
+		if (slot < SET_INLINE_CAPACITY && set->objects[slot]) {
+
+			release(set->objects[slot]);
+			set->objects[slot] = NULL;
+			set->count--;
+
+			removeObject_reprobe(set, slot);
+		}
+
+		return;
+	}
+
 	const size_t bin = HashForObject(HASH_SEED, obj) % self->set.capacity;
 
 	MutableArray *array = self->set.elements[bin];
@@ -249,6 +506,93 @@ static MutableSet *setWithCapacity(size_t capacity) {
 	return alloc(MutableSet, initWithCapacity, capacity);
 }
 
+/**
+ * @fn void MutableSet::trimToSize(MutableSet *self)
+ *
+ * @memberof MutableSet
+ */
+static void trimToSize(MutableSet *self) {
+
+	Set *set = (Set *) self;
+
+	if (set->capacity) {
+
+		if (set->count <= SET_INLINE_CAPACITY) {
+			resize(set, 0);
+		} else {
+			const size_t capacity = set->count / MUTABLESET_MAX_LOAD + 1;
+			if (capacity < set->capacity) {
+				resize(set, capacity);
+			}
+
+			for (size_t i = 0; i < set->capacity; i++) {
+				if (set->elements[i]) {
+					$((MutableArray *) set->elements[i], trimToSize);
+				}
+			}
+		}
+	}
+}
+
+/**
+ * @fn void MutableSet::unionWithSet(MutableSet *self, const Set *set)
+ *
+ * @memberof MutableSet
+ */
+static void unionWithSet(MutableSet *self, const Set *set) {
+
+	assert(set);
+
+	if (set->count == 0) {
+		return;
+	}
+
+	if (self->set.elements || self->set.count + set->count > SET_INLINE_CAPACITY) {
+
+		size_t capacity = self->set.capacity ?: MUTABLESET_DEFAULT_CAPACITY;
+		while (self->set.count + set->count > capacity * MUTABLESET_MAX_LOAD) {
+			capacity *= MUTABLESET_GROW_FACTOR;
+		}
+
+		if (capacity != self->set.capacity) {
+			resize((Set *) self, capacity);
+		}
+	}
+
+	if (self->set.elements == NULL || set->elements == NULL) {
+
+		ident obj;
+		SetForEach(obj, set) {
+			$(self, addObject, obj);
+		}
+
+		return;
+	}
+
+	for (size_t i = 0; i < set->capacity; i++) {
+
+		const Array *array = set->elements[i];
+		if (array) {
+
+			for (size_t j = 0; j < array->count; j++) {
+
+				const ident obj = array->elements[j];
+				const size_t bin = binForObject((Set *) self, obj, set->capacity, i);
+
+				MutableArray *objects = self->set.elements[bin];
+				if (objects == NULL) {
+					objects = self->set.elements[bin] = alloc(MutableArray, init);
+				}
+
+				if ($((Array *) objects, containsObject, obj) == false) {
+					$(objects, addObject, obj);
+					self->set.count++;
+				}
+			}
+		}
+	}
+}
+
 #pragma mark - Class lifecycle
 
 /**
@@ -267,10 +611,14 @@ static void initialize(Class *clazz) {
 	mutableSet->addObjectsFromSet = addObjectsFromSet;
 	mutableSet->init = init;
 	mutableSet->initWithCapacity = initWithCapacity;
+	mutableSet->intersectSet = intersectSet;
+	mutableSet->minusSet = minusSet;
 	mutableSet->removeAllObjects = removeAllObjects;
 	mutableSet->removeObject = removeObject;
 	mutableSet->set = set;
 	mutableSet->setWithCapacity = setWithCapacity;
+	mutableSet->trimToSize = trimToSize;
+	mutableSet->unionWithSet = unionWithSet;
 }
 
 Class _MutableSet = {
@@ -119,12 +119,37 @@ struct MutableSetInterface {
 	 *
 	 * @param capacity The desired initial capacity.
 	 *
+	 * @remarks Up to `SET_INLINE_CAPACITY` Objects are stored inline, and the hash table is
+	 * allocated only once they are outgrown.
+	 *
 	 * @return The initialized Set, or `NULL` on error.
 	 *
 	 * @memberof MutableSet
 	 */
 	MutableSet *(*initWithCapacity)(MutableSet *self, size_t capacity);
 
+	/**
+	 * @fn void MutableSet::intersectSet(MutableSet *self, const Set *set)
+	 *
+	 * @brief Removes the Objects of this Set which are not in `set`.
+	 *
+	 * @param set A Set.
+	 *
+	 * @memberof MutableSet
+	 */
+	void (*intersectSet)(MutableSet *self, const Set *set);
+
+	/**
+	 * @fn void MutableSet::minusSet(MutableSet *self, const Set *set)
+	 *
+	 * @brief Removes the Objects of `set` from this Set.
+	 *
+	 * @param set A Set.
+	 *
+	 * @memberof MutableSet
+	 */
+	void (*minusSet)(MutableSet *self, const Set *set);
+
 	/**
 	 * @fn void MutableSet::removeAllObjects(MutableSet *self)
 	 *
@@ -172,6 +197,26 @@ struct MutableSetInterface {
 	 * @memberof MutableSet
 	 */
 	MutableSet *(*setWithCapacity)(size_t capacity);
+
+	/**
+	 * @fn void MutableSet::trimToSize(MutableSet *self)
+	 *
+	 * @brief Releases the capacity of this MutableSet in excess of its count.
+	 *
+	 * @memberof MutableSet
+	 */
+	void (*trimToSize)(MutableSet *self);
+
+	/**
+	 * @fn void MutableSet::unionWithSet(MutableSet *self, const Set *set)
+	 *
+	 * @brief Adds the Objects of `set` to this Set, resizing it at most once.
+	 *
+	 * @param set A Set.
+	 *
+	 * @memberof MutableSet
+	 */
+	void (*unionWithSet)(MutableSet *self, const Set *set);
 };
 
 /**
@@ -31,6 +31,70 @@
 
 #define _Class _MutableString
 
+#define MUTABLE_STRING_FORMAT_BUFFER_SIZE 512
+
+/**
+ * @return True if the characters of `self` are stored inline, or not yet stored at all.
+ */
+static inline _Bool isInline(const MutableString *self) {
+	return self->string.chars == NULL || self->string.chars == self->string.inlineChars;
+}
+
+/**
+ * @return The number of bytes, including the null terminator, that `self` can hold without
+ * reallocating.
+ */
+static inline size_t capacityOf(const MutableString *self) {
+	return isInline(self) ? STRING_INLINE_CAPACITY : self->capacity;
+}
+
+/**
+ * @brief Ensures that `self` can hold `length` bytes and a null terminator, growing it to
+ * `capacity` bytes if it cannot.
+ */
+static void reserve(MutableString *self, size_t length, size_t capacity) {
+
+	const size_t size = length + 1;
+
+	if (isInline(self)) {
+
+		if (size <= STRING_INLINE_CAPACITY) {
+			if (self->string.chars == NULL) {
+				self->string.chars = self->string.inlineChars;
+				self->string.chars[0] = '\0';
+			}
+			return;
+		}
+
+		char *mem = malloc(capacity);
+		assert(mem);
+
+		if (self->string.chars) {
+			memcpy(mem, self->string.chars, self->string.length + 1);
+		} else {
+			mem[0] = '\0';
+		}
+
+		self->string.chars = mem;
+		self->capacity = capacity;
+
+	} else if (size > self->capacity) {
+
+		self->string.chars = realloc(self->string.chars, capacity);
+		assert(self->string.chars);
+
+		self->capacity = capacity;
+	}
+}
+
+/**
+ * @brief Ensures that `self` can hold `length` bytes and a null terminator, growing it
+ * geometrically if it cannot.
+ */
+static void grow(MutableString *self, size_t length) {
+	reserve(self, length, max(capacityOf(self) * 2, length + 1));
+}
+
 #pragma mark - Object
 
 /**
@@ -43,41 +107,62 @@ static Object *copy(const Object *self) {
 	return (Object *) alloc(MutableString, initWithString, this);
 }
 
+/**
+ * @see Object::sizeInBytes(const Object *)
+ */
+static size_t sizeInBytes(const Object *self) {
+
+	const MutableString *this = (MutableString *) self;
+
+	size_t size = super(Object, self, sizeInBytes);
+
+	if (this->string.chars != this->string.inlineChars && this->capacity > this->string.length + 1) {
+		size += this->capacity - this->string.length - 1;
+	}
+
+	return size;
+}
+
 #pragma mark - MutableString
 
 /**
- * @fn void MutableString::appendCharacters(MutableString *self, const char *chars)
+ * @fn void MutableString::appendBytes(MutableString *self, const uint8_t *bytes, size_t length)
  *
  * @memberof MutableString
  */
-static void appendCharacters(MutableString *self, const char *chars) {
+static void appendBytes(MutableString *self, const uint8_t *bytes, size_t length) {
 
-	if (chars) {
+	if (length) {
 
-		const size_t len = strlen(chars);
-		if (len) {
+		const char *chars = (const char *) bytes;
 
-			const size_t newSize = self->string.length + strlen(chars) + 1;
-			const size_t newCapacity = (newSize / _pageSize + 1) * _pageSize;
+		if (chars >= self->string.chars && chars < self->string.chars + self->string.length) {
 
-			if (newCapacity > self->capacity) {
+			const size_t offset = chars - self->string.chars;
 
-				if (self->string.length) {
-					self->string.chars = realloc(self->string.chars, newCapacity);
-				} else {
-					self->string.chars = malloc(newCapacity);
-				}
+			grow(self, self->string.length + length);
 
-				assert(self->string.chars);
-				self->capacity = newCapacity;
-			}
+			chars = self->string.chars + offset;
+		} else {
+			grow(self, self->string.length + length);
+		}
 
-			ident ptr = self->string.chars + self->string.length;
-			memmove(ptr, chars, len);
+		memmove(self->string.chars + self->string.length, chars, length);
 
-			self->string.chars[newSize - 1] = '\0';
-			self->string.length += len;
-		}
+		self->string.length += length;
+		self->string.chars[self->string.length] = '\0';
+	}
+}
+
+/**
+ * @fn void MutableString::appendCharacters(MutableString *self, const char *chars)
+ *
+ * @memberof MutableString
+ */
+static void appendCharacters(MutableString *self, const char *chars) {
+
+	if (chars) {
+		$(self, appendBytes, (const uint8_t *) chars, strlen(chars));
 	}
 }
 
@@ -104,7 +189,7 @@ static void appendFormat(MutableString *self, const char *fmt, ...) {
 static void appendString(MutableString *self, const String *string) {
 
 	if (string) {
-		$(self, appendCharacters, string->chars);
+		$(self, appendBytes, (const uint8_t *) string->chars, string->length);
 	}
 }
 
@@ -114,14 +199,31 @@ static void appendString(MutableString *self, const String *string) {
  * @memberof MutableString
  */
 static void appendVaList(MutableString *self, const char *fmt, va_list args) {
-	char *chars;
-	
-	const int len = vasprintf(&chars, fmt, args);
-	if (len > 0) {
-		$(self, appendCharacters, chars);
+
+	// the arguments may point into our characters, so format outside of them
+	char buffer[MUTABLE_STRING_FORMAT_BUFFER_SIZE];
+
+	va_list copy;
+	va_copy(copy, args);
+
+	const int len = vsnprintf(buffer, sizeof(buffer), fmt, copy);
+	assert(len >= 0);
+
+	va_end(copy);
+
+	if ((size_t) len < sizeof(buffer)) {
+		$(self, appendBytes, (const uint8_t *) buffer, len);
+	} else {
+
+		char *mem = malloc(len + 1);
+		assert(mem);
+
+		vsnprintf(mem, len + 1, fmt, args);
+
+		$(self, appendBytes, (const uint8_t *) mem, len);
+
+		free(mem);
 	}
-	
-	free(chars);
 }
 
 /**
@@ -161,12 +263,7 @@ static MutableString *initWithCapacity(MutableString *self, size_t capacity) {
 	
 	self = (MutableString *) super(String, self, initWithMemory, NULL, 0);
 	if (self) {
-		if (capacity) {
-			self->string.chars = calloc(capacity, sizeof(char));
-			assert(self->string.chars);
-			
-			self->capacity = capacity;
-		}
+		$(self, reserveCapacity, capacity);
 	}
 	
 	return self;
@@ -240,6 +337,18 @@ static void replaceStringInRange(MutableString *self, const Range range, const S
 	$(self, replaceCharactersInRange, range, string->chars);
 }
 
+/**
+ * @fn void MutableString::reserveCapacity(MutableString *self, size_t capacity)
+ *
+ * @memberof MutableString
+ */
+static void reserveCapacity(MutableString *self, size_t capacity) {
+
+	if (capacity > self->string.length) {
+		reserve(self, capacity, capacity + 1);
+	}
+}
+
 /**
  * @fn MutableString *MutableString::string(void)
  *
@@ -260,6 +369,33 @@ static MutableString *stringWithCapacity(size_t capacity) {
 	return alloc(MutableString, initWithCapacity, capacity);
 }
 
+/**
+ * @fn void MutableString::trimToSize(MutableString *self)
+ *
+ * @memberof MutableString
+ */
+static void trimToSize(MutableString *self) {
+
+	if (self->string.chars && self->string.chars != self->string.inlineChars) {
+
+		if (self->string.length < STRING_INLINE_CAPACITY) {
+
+			memcpy(self->string.inlineChars, self->string.chars, self->string.length + 1);
+			free(self->string.chars);
+
+			self->string.chars = self->string.inlineChars;
+			self->capacity = 0;
+
+		} else if (self->capacity > self->string.length + 1) {
+
+			self->capacity = self->string.length + 1;
+
+			self->string.chars = realloc(self->string.chars, self->capacity);
+			assert(self->string.chars);
+		}
+	}
+}
+
 #pragma mark - Class lifecycle
 
 /**
@@ -270,9 +406,11 @@ static void initialize(Class *clazz) {
 	ObjectInterface *object = (ObjectInterface *) clazz->interface;
 
 	object->copy = copy;
+	object->sizeInBytes = sizeInBytes;
 
 	MutableStringInterface *mutableString = (MutableStringInterface *) clazz->interface;
 
+	mutableString->appendBytes = appendBytes;
 	mutableString->appendCharacters = appendCharacters;
 	mutableString->appendFormat = appendFormat;
 	mutableString->appendString = appendString;
@@ -285,8 +423,10 @@ static void initialize(Class *clazz) {
 	mutableString->insertStringAtIndex = insertStringAtIndex;
 	mutableString->replaceCharactersInRange = replaceCharactersInRange;
 	mutableString->replaceStringInRange = replaceStringInRange;
+	mutableString->reserveCapacity = reserveCapacity;
 	mutableString->string = string;
 	mutableString->stringWithCapacity = stringWithCapacity;
+	mutableString->trimToSize = trimToSize;
 }
 
 Class _MutableString = {
@@ -59,7 +59,8 @@ struct MutableString {
 	/**
 	 * @brief The capacity of the String, in bytes.
 	 *
-	 * @remarks The capacity is always `>= self->string.length`.
+	 * @remarks The capacity is always `>= self->string.length` for heap allocated characters,
+	 * and `0` while the characters are stored inline.
 	 *
 	 * @private
 	 */
@@ -76,6 +77,18 @@ struct MutableStringInterface {
 	 */
 	StringInterface stringInterface;
 
+	/**
+	 * @fn void MutableString::appendBytes(MutableString *self, const uint8_t *bytes, size_t length)
+	 *
+	 * @brief Appends `length` bytes of UTF-8 encoded characters.
+	 *
+	 * @param bytes The UTF-8 encoded characters, which need not be null-terminated.
+	 * @param length The length of `bytes`.
+	 *
+	 * @memberof MutableString
+	 */
+	void (*appendBytes)(MutableString *self, const uint8_t *bytes, size_t length);
+
 	/**
 	 * @fn void MutableString::appendCharacters(MutableString *self, const char *chars)
 	 *
@@ -217,6 +230,17 @@ struct MutableStringInterface {
 	 */
 	void (*replaceStringInRange)(MutableString *self, const Range range, const String *string);
 
+	/**
+	 * @fn void MutableString::reserveCapacity(MutableString *self, size_t capacity)
+	 *
+	 * @brief Ensures that this MutableString can grow to `capacity` bytes without reallocating.
+	 *
+	 * @param capacity The capacity, in bytes, excluding the null terminator.
+	 *
+	 * @memberof MutableString
+	 */
+	void (*reserveCapacity)(MutableString *self, size_t capacity);
+
 	/**
 	 * @static
 	 *
@@ -244,6 +268,15 @@ struct MutableStringInterface {
 	 * @memberof MutableString
 	 */
 	MutableString *(*stringWithCapacity)(size_t capacity);
+
+	/**
+	 * @fn void MutableString::trimToSize(MutableString *self)
+	 *
+	 * @brief Releases the capacity of this MutableString in excess of its length.
+	 *
+	 * @memberof MutableString
+	 */
+	void (*trimToSize)(MutableString *self);
 };
 
 /**
@@ -58,6 +58,16 @@ static void dealloc(Object *self) {
 	free(self);
 }
 
+/**
+ * @fn size_t Object::deepSizeInBytes(const Object *self)
+ *
+ * @memberof Object
+ */
+static size_t deepSizeInBytes(const Object *self) {
+
+	return $(self, sizeInBytes);
+}
+
 /**
  * @fn String *Object::description(const Object *self)
  *
@@ -118,6 +128,16 @@ static _Bool isKindOfClass(const Object *self, const Class *clazz) {
 	return false;
 }
 
+/**
+ * @fn size_t Object::sizeInBytes(const Object *self)
+ *
+ * @memberof Object
+ */
+static size_t sizeInBytes(const Object *self) {
+
+	return self->clazz->instanceSize;
+}
+
 #pragma mark - Class lifecycle
 
 /**
@@ -129,11 +149,13 @@ static void initialize(Class *clazz) {
 
 	object->copy = copy;
 	object->dealloc = dealloc;
+	object->deepSizeInBytes = deepSizeInBytes;
 	object->description = description;
 	object->hash = hash;
 	object->init = init;
 	object->isEqual = isEqual;
 	object->isKindOfClass = isKindOfClass;
+	object->sizeInBytes = sizeInBytes;
 }
 
 Class _Object = {
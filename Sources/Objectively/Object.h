@@ -102,6 +102,19 @@ struct ObjectInterface {
 	 */
 	void (*dealloc)(Object *self);
 
+	/**
+	 * @fn size_t Object::deepSizeInBytes(const Object *self)
+	 *
+	 * @param self The object.
+	 *
+	 * @return The size of this Object in bytes, including the Objects it contains.
+	 *
+	 * @remarks Objects that are contained more than once are counted each time.
+	 *
+	 * @memberof Object
+	 */
+	size_t (*deepSizeInBytes)(const Object *self);
+
 	/**
 	 * @fn String *Object::description(const Object *self)
 	 *
@@ -164,6 +177,18 @@ struct ObjectInterface {
 	 * @memberof Object
 	 */
 	_Bool (*isKindOfClass)(const Object *self, const Class *clazz);
+
+	/**
+	 * @fn size_t Object::sizeInBytes(const Object *self)
+	 *
+	 * @param self The object.
+	 *
+	 * @return The size of this Object in bytes, including any storage it owns, but excluding
+	 * the Objects it contains.
+	 *
+	 * @memberof Object
+	 */
+	size_t (*sizeInBytes)(const Object *self);
 };
 
 /**
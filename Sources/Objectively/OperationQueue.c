@@ -70,7 +70,7 @@ static void addOperation(OperationQueue *self, Operation *operation) {
 	assert(operation->isFinished == false);
 
 	WithLock(self->locals.condition, {
-		$(self->locals.operations, addObject, operation);
+		$(self->locals.operations, pushLastObject, operation);
 		$(self->locals.condition, broadcast);
 	});
 }
@@ -158,7 +158,7 @@ static OperationQueue *init(OperationQueue *self) {
 		self->locals.condition = alloc(Condition, init);
 		assert(self->locals.condition);
 
-		self->locals.operations = alloc(MutableArray, init);
+		self->locals.operations = alloc(MutableDeque, init);
 		assert(self->locals.operations);
 
 		self->locals.thread = alloc(Thread, initWithFunction, run, self);
@@ -180,7 +180,7 @@ static int operationCount(const OperationQueue *self) {
 	int count;
 
 	WithLock(self->locals.condition, {
-		count = ((Array *) self->locals.operations)->count;
+		count = ((Deque *) self->locals.operations)->count;
 	});
 
 	return count;
@@ -196,7 +196,7 @@ static Array *operations(const OperationQueue *self) {
 	ident operations;
 
 	WithLock(self->locals.condition, {
-		operations = $((Object * ) self->locals.operations, copy);
+		operations = $((Deque *) self->locals.operations, allObjects);
 	});
 
 	return (Array *) operations;
@@ -225,7 +225,7 @@ static void removeOperation(OperationQueue *self, Operation *operation) {
  */
 static void waitUntilAllOperationsAreFinished(OperationQueue *self) {
 
-	Array *operations = (Array *) self->locals.operations;
+	const Deque *operations = (Deque *) self->locals.operations;
 	while (operations->count > 0) {
 
 		WithLock(self->locals.condition, {
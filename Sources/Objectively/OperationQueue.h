@@ -24,6 +24,7 @@
 #pragma once
 
 #include <Objectively/Condition.h>
+#include <Objectively/MutableDeque.h>
 #include <Objectively/Object.h>
 #include <Objectively/Operation.h>
 #include <Objectively/Thread.h>
@@ -73,7 +74,7 @@ struct OperationQueue {
 		/**
 		 * @brief The Operations.
 		 */
-		MutableArray *operations;
+		MutableDeque *operations;
 
 		/**
 		 * @brief The backing Thread.
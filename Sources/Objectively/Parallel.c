@@ -0,0 +1,226 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <assert.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <Objectively/Condition.h>
+#include <Objectively/Once.h>
+#include <Objectively/Parallel.h>
+#include <Objectively/Thread.h>
+
+/**
+ * @brief The count of chunks per participating Thread chosen by default, which allows
+ * Threads that finish early to balance the load.
+ */
+#define PARALLEL_CHUNKS_PER_THREAD 8
+
+/**
+ * @brief A parallel loop, posted to the pool by the calling Thread.
+ */
+typedef struct ParallelJob {
+	ParallelFunction function;
+	ident data;
+	size_t count;
+	size_t chunkSize;
+	size_t chunks;
+	volatile size_t next;
+	volatile size_t completed;
+	size_t workers;
+	struct ParallelJob *nextJob;
+} ParallelJob;
+
+/**
+ * @brief The shared pool of worker Threads.
+ */
+static struct {
+	Condition *condition;
+	ParallelJob *jobs;
+	Thread **threads;
+	size_t threadCount;
+} _pool;
+
+/**
+ * @brief Claims and executes chunks of `job` until none remain.
+ */
+static void executeJob(ParallelJob *job) {
+
+	while (true) {
+
+		const size_t chunk = __sync_fetch_and_add(&job->next, 1);
+		if (chunk >= job->chunks) {
+			break;
+		}
+
+		const size_t begin = chunk * job->chunkSize;
+		const size_t end = min(begin + job->chunkSize, job->count);
+
+		job->function(chunk, begin, end, job->data);
+
+		__sync_fetch_and_add(&job->completed, 1);
+	}
+}
+
+/**
+ * @brief Removes `job` from the pool, if it is still posted. The pool must be locked.
+ */
+static void removeJob(ParallelJob *job) {
+
+	for (ParallelJob **j = &_pool.jobs; *j; j = &(*j)->nextJob) {
+		if (*j == job) {
+			*j = job->nextJob;
+			break;
+		}
+	}
+}
+
+/**
+ * @brief ThreadFunction for the worker Threads.
+ */
+static ident run(Thread *thread) {
+
+	while (true) {
+
+		ParallelJob *job;
+
+		WithLock(_pool.condition, {
+			while (_pool.jobs == NULL) {
+				$(_pool.condition, wait);
+			}
+
+			job = _pool.jobs;
+			job->workers++;
+		});
+
+		executeJob(job);
+
+		WithLock(_pool.condition, {
+			removeJob(job);
+			job->workers--;
+			$(_pool.condition, broadcast);
+		});
+	}
+
+	return NULL;
+}
+
+/**
+ * @brief Starts the worker Threads, one fewer than the count of online processors.
+ */
+static void startPool(void) {
+
+	static Once once;
+
+	do_once(&once, {
+
+		size_t processors = 1;
+
+#if defined(_SC_NPROCESSORS_ONLN)
+		const long count = sysconf(_SC_NPROCESSORS_ONLN);
+		if (count > 0) {
+			processors = count;
+		}
+#endif
+
+		_pool.condition = alloc(Condition, init);
+		assert(_pool.condition);
+
+		_pool.threads = calloc(processors, sizeof(Thread *));
+		assert(_pool.threads);
+
+		for (size_t i = 0; i < processors - 1; i++) {
+
+			_pool.threads[i] = alloc(Thread, initWithFunction, run, NULL);
+			assert(_pool.threads[i]);
+
+			$(_pool.threads[i], start);
+			$(_pool.threads[i], detach);
+		}
+
+		_pool.threadCount = processors;
+	});
+}
+
+size_t ParallelChunkSize(size_t count, size_t chunkSize) {
+
+	if (chunkSize == 0) {
+		chunkSize = count / (ParallelThreadCount() * PARALLEL_CHUNKS_PER_THREAD);
+	}
+
+	return max(chunkSize, (size_t) 1);
+}
+
+ident ParallelFold(Reducer reducer, ident obj, ident accumulator, ident data) {
+
+	assert(reducer);
+
+	const ident result = reducer(obj, accumulator, data);
+	if (result != accumulator) {
+		release(accumulator);
+	}
+
+	return result;
+}
+
+void ParallelFor(size_t count, size_t chunkSize, ParallelFunction function, ident data) {
+
+	assert(function);
+
+	chunkSize = ParallelChunkSize(count, chunkSize);
+
+	ParallelJob job = {
+		.function = function,
+		.data = data,
+		.count = count,
+		.chunkSize = chunkSize,
+		.chunks = (count + chunkSize - 1) / chunkSize,
+	};
+
+	if (job.chunks < 2 || ParallelThreadCount() < 2) {
+		executeJob(&job);
+		return;
+	}
+
+	WithLock(_pool.condition, {
+		job.nextJob = _pool.jobs;
+		_pool.jobs = &job;
+		$(_pool.condition, broadcast);
+	});
+
+	executeJob(&job);
+
+	WithLock(_pool.condition, {
+		removeJob(&job);
+		while (job.completed < job.chunks || job.workers) {
+			$(_pool.condition, wait);
+		}
+	});
+}
+
+size_t ParallelThreadCount(void) {
+
+	startPool();
+
+	return _pool.threadCount;
+}
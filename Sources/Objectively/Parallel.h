@@ -0,0 +1,85 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#pragma once
+
+#include <Objectively/Types.h>
+
+/**
+ * @file
+ *
+ * @brief Data parallelism on a shared pool of worker Threads.
+ *
+ * @ingroup Concurrency
+ */
+
+/**
+ * @brief The function type for parallel loops.
+ *
+ * @param chunk The index of the chunk, which may be used to merge results deterministically.
+ * @param begin The first index of the chunk.
+ * @param end The index after the last index of the chunk.
+ * @param data User data.
+ */
+typedef void (*ParallelFunction)(size_t chunk, size_t begin, size_t end, ident data);
+
+/**
+ * @brief Resolves the chunk size for a parallel loop over `count` indexes.
+ *
+ * @param count The count of indexes.
+ * @param chunkSize The desired chunk size, or `0` to choose one from the count of processors.
+ *
+ * @return The chunk size that ParallelFor will use.
+ */
+extern size_t ParallelChunkSize(size_t count, size_t chunkSize);
+
+/**
+ * @brief Folds `obj` into `accumulator` with `reducer`, for reductions over ParallelFor.
+ *
+ * @param reducer The Reducer.
+ * @param obj The Object to fold.
+ * @param accumulator The accumulator, which is released if `reducer` replaces it.
+ * @param data User data.
+ *
+ * @return The retained result of `reducer`.
+ */
+extern ident ParallelFold(Reducer reducer, ident obj, ident accumulator, ident data);
+
+/**
+ * @brief Invokes `function` for each chunk of the indexes `[0, count)`.
+ *
+ * @param count The count of indexes.
+ * @param chunkSize The count of indexes per chunk, or `0` to choose one automatically.
+ * @param function The ParallelFunction.
+ * @param data User data.
+ *
+ * @remarks The chunks are executed by the shared pool of worker Threads, and by the calling
+ * Thread, which returns once every chunk has completed. Chunks are claimed in ascending order,
+ * but may complete in any order. ParallelFor may be called from within a ParallelFunction.
+ */
+extern void ParallelFor(size_t count, size_t chunkSize, ParallelFunction function, ident data);
+
+/**
+ * @return The count of Threads that participate in parallel loops, including the caller.
+ */
+extern size_t ParallelThreadCount(void);
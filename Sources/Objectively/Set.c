@@ -28,11 +28,16 @@
 #include <Objectively/Hash.h>
 #include <Objectively/MutableArray.h>
 #include <Objectively/MutableSet.h>
+#include <Objectively/MutableString.h>
+#include <Objectively/Parallel.h>
 #include <Objectively/Set.h>
 #include <Objectively/String.h>
 
 #define _Class _Set
 
+#define SET_GROW_FACTOR 2
+#define SET_MAX_LOAD 0.75
+
 #pragma mark - Object
 
 /**
@@ -60,35 +65,77 @@ static void dealloc(Object *self) {
 
 	free(this->elements);
 
+	for (size_t i = 0; i < lengthof(this->objects); i++) {
+		release(this->objects[i]);
+	}
+
 	super(Object, self, dealloc);
 }
 
+/**
+ * @see Object::deepSizeInBytes(const Object *)
+ */
+static size_t deepSizeInBytes(const Object *self) {
+
+	const Set *this = (Set *) self;
+
+	size_t size = $(self, sizeInBytes);
+
+	const Object *obj;
+	SetForEach(obj, this) {
+		size += $(obj, deepSizeInBytes);
+	}
+
+	return size;
+}
+
 /**
  * @see Object::description(const Object *)
  */
 static String *description(const Object *self) {
 
-	const Array *array = $((Set *) self, allObjects);
+	MutableString *desc = alloc(MutableString, init);
+
+	$(desc, appendCharacters, "[");
+
+	const Object *obj;
+	size_t i = 0;
+
+	SetForEach(obj, (Set *) self) {
+
+		if (i++) {
+			$(desc, appendCharacters, ", ");
+		}
+
+		String *string = $(obj, description);
+		$(desc, appendString, string);
+
+		release(string);
+	}
+
+	$(desc, appendCharacters, "]");
 
-	return $((Object *) array, description);
+	return (String *) desc;
 }
 
 /**
  * @see Object::hash(const Object *)
+ *
+ * @remarks The Objects are combined without regard to order, as their order depends on how the
+ * Set was populated.
  */
 static int hash(const Object *self) {
 
 	const Set *this = (Set *) self;
 
-	int hash = HashForInteger(HASH_SEED, this->count);
+	unsigned int objects = 0;
 
-	for (size_t i = 0; i < this->capacity; i++) {
-		if (this->elements[i]) {
-			hash = HashForObject(hash, this->elements[i]);
-		}
+	const Object *obj;
+	SetForEach(obj, this) {
+		objects += HashForObject(HASH_SEED, (ident) obj);
 	}
 
-	return hash;
+	return HashForInteger(HashForInteger(HASH_SEED, this->count), objects);
 }
 
 /**
@@ -126,8 +173,74 @@ static _Bool isEqual(const Object *self, const Object *other) {
 	return false;
 }
 
+/**
+ * @see Object::sizeInBytes(const Object *)
+ */
+static size_t sizeInBytes(const Object *self) {
+
+	const Set *this = (Set *) self;
+
+	size_t size = super(Object, self, sizeInBytes) + this->capacity * sizeof(ident);
+
+	for (size_t i = 0; i < this->capacity; i++) {
+		if (this->elements[i]) {
+			size += $((Object *) this->elements[i], sizeInBytes);
+		}
+	}
+
+	return size;
+}
+
 #pragma mark - Set
 
+/**
+ * @return The inline slot of `obj` in `set`, the first vacant slot in its probe sequence if `set`
+ * does not contain `obj`, or `SET_INLINE_CAPACITY` if neither exists.
+ */
+static size_t inlineSlotForObject(const Set *set, const ident obj) {
+
+	size_t slot = (size_t) HashForObject(HASH_SEED, obj) % SET_INLINE_CAPACITY;
+
+	for (size_t i = 0; i < SET_INLINE_CAPACITY; i++) {
+
+		const ident object = set->objects[slot];
+		if (object == NULL || object == obj || $((Object *) object, isEqual, obj)) {
+			return slot;
+		}
+
+		slot = (slot + 1) % SET_INLINE_CAPACITY;
+	}
+
+	return SET_INLINE_CAPACITY;
+}
+
+/**
+ * @return The count of table slots of `set`: its bins, or its inline Objects.
+ */
+static size_t slotCount(const Set *set) {
+	return set->elements ? set->capacity : SET_INLINE_CAPACITY;
+}
+
+/**
+ * @return The count of Objects, returned in `objects`, in table slot `slot` of `set`.
+ */
+static size_t objectsInSlot(const Set *set, size_t slot, ident **objects) {
+
+	if (set->elements) {
+
+		const Array *array = set->elements[slot];
+		if (array) {
+			*objects = array->elements;
+			return array->count;
+		}
+
+		return 0;
+	}
+
+	*objects = (ident *) set->objects + slot;
+	return **objects ? 1 : 0;
+}
+
 /**
  * @brief SetEnumerator for allObjects.
  */
@@ -157,6 +270,16 @@ static Array *allObjects(const Set *self) {
  */
 static _Bool containsObject(const Set *self, const ident obj) {
 
+	if (self->elements == NULL) {
+
+		const size_t slot = inlineSlotForObject(self, obj);
+		if (slot < SET_INLINE_CAPACITY) {
+			return self->objects[slot] != NULL;
+		}
+
+		return false;
+	}
+
 	const size_t bin = HashForObject(HASH_SEED, obj) % self->capacity;
 
 	const Array *array = self->elements[bin];
@@ -176,48 +299,174 @@ static void enumerateObjects(const Set *self, SetEnumerator enumerator, ident da
 
 	assert(enumerator);
 
-	for (size_t i = 0; i < self->capacity; i++) {
+	ident obj;
+	SetForEach(obj, self) {
+		if (enumerator(self, obj, data)) {
+			return;
+		}
+	}
+}
 
-		Array *array = self->elements[i];
-		if (array) {
+/**
+ * @brief The context of Set::enumerateObjectsConcurrently.
+ */
+typedef struct {
+	const Set *set;
+	SetEnumerator enumerator;
+	ident data;
+	volatile _Bool stop;
+} EnumerateConcurrently;
+
+/**
+ * @brief ParallelFunction for enumerateObjectsConcurrently.
+ */
+static void enumerateObjectsConcurrently_parallel(size_t chunk, size_t begin, size_t end, ident data) {
+
+	EnumerateConcurrently *context = data;
 
-			for (size_t j = 0; j < array->count; j++) {
-				ident obj = $(array, objectAtIndex, j);
+	for (size_t i = begin; i < end && context->stop == false; i++) {
 
-				if (enumerator(self, obj, data)) {
-					return;
+		ident *objects;
+		const size_t count = objectsInSlot(context->set, i, &objects);
+
+		for (size_t j = 0; j < count && context->stop == false; j++) {
+			if (context->enumerator(context->set, objects[j], context->data)) {
+				context->stop = true;
+			}
+		}
+	}
+}
+
+/**
+ * @fn void Set::enumerateObjectsConcurrently(const Set *self, SetEnumerator enumerator, ident data, size_t chunkSize)
+ *
+ * @memberof Set
+ */
+static void enumerateObjectsConcurrently(const Set *self, SetEnumerator enumerator, ident data, size_t chunkSize) {
+
+	assert(enumerator);
+
+	EnumerateConcurrently context = {
+		.set = self,
+		.enumerator = enumerator,
+		.data = data
+	};
+
+	ParallelFor(slotCount(self), chunkSize, enumerateObjectsConcurrently_parallel, &context);
+}
+
+/**
+ * @brief The context of Set::filterConcurrently and Set::mapConcurrently.
+ */
+typedef struct {
+	const Set *set;
+	Predicate predicate;
+	Functor functor;
+	ident data;
+	ident *results;
+	size_t count;
+} TransformConcurrently;
+
+/**
+ * @brief ParallelFunction for filterConcurrently.
+ *
+ * @remarks The elements that pass keep their hash, and so their table slot, in the new Set.
+ */
+static void filterConcurrently_parallel(size_t chunk, size_t begin, size_t end, ident data) {
+
+	TransformConcurrently *context = data;
+
+	size_t count = 0;
+
+	for (size_t i = begin; i < end; i++) {
+
+		ident *elements;
+		const size_t elementCount = objectsInSlot(context->set, i, &elements);
+
+		MutableArray *objects = NULL;
+
+		for (size_t j = 0; j < elementCount; j++) {
+
+			ident obj = elements[j];
+
+			if (context->predicate(obj, context->data)) {
+
+				if (objects == NULL) {
+					objects = alloc(MutableArray, initWithCapacity, elementCount);
 				}
+
+				$(objects, addObject, obj);
+				count++;
 			}
 		}
+
+		context->results[i] = objects;
 	}
+
+	__sync_fetch_and_add(&context->count, count);
 }
 
 /**
- * @fn void Set::filteredSet(const Set *self, Predicate predicate, ident data)
+ * @fn Set *Set::filterConcurrently(const Set *self, Predicate predicate, ident data, size_t chunkSize)
  *
  * @memberof Set
  */
-static Set *filteredSet(const Set *self, Predicate predicate, ident data) {
+static Set *filterConcurrently(const Set *self, Predicate predicate, ident data, size_t chunkSize) {
 
 	assert(predicate);
 
-	MutableSet *set = alloc(MutableSet, init);
+	Set *set = (Set *) super(Object, _alloc(&_Set), init);
+	if (set) {
 
-	for (size_t i = 0; i < self->capacity; i++) {
+		set->capacity = self->capacity;
 
-		Array *array = self->elements[i];
-		if (array) {
+		if (set->capacity) {
+
+			TransformConcurrently context = {
+				.set = self,
+				.predicate = predicate,
+				.data = data,
+				.results = calloc(set->capacity, sizeof(ident))
+			};
 
-			for (size_t j = 0; j < array->count; j++) {
-				ident obj = $(array, objectAtIndex, j);
+			assert(context.results);
 
+			ParallelFor(self->capacity, chunkSize, filterConcurrently_parallel, &context);
+
+			set->elements = context.results;
+			set->count = context.count;
+		} else {
+
+			ident obj;
+			SetForEach(obj, self) {
 				if (predicate(obj, data)) {
-					$(set, addObject, obj);
+					$$(MutableSet, addObject, (MutableSet *) set, obj);
 				}
 			}
 		}
 	}
 
+	return set;
+}
+
+/**
+ * @fn void Set::filteredSet(const Set *self, Predicate predicate, ident data)
+ *
+ * @memberof Set
+ */
+static Set *filteredSet(const Set *self, Predicate predicate, ident data) {
+
+	assert(predicate);
+
+	MutableSet *set = alloc(MutableSet, init);
+
+	ident obj;
+	SetForEach(obj, self) {
+		if (predicate(obj, data)) {
+			$(set, addObject, obj);
+		}
+	}
+
 	return (Set *) set;
 }
 
@@ -300,6 +549,394 @@ static Set *initWithSet(Set *self, const Set *set) {
 	return self;
 }
 
+/**
+ * @return The index of the bin of `set` for `obj`, which resides in bin `bin` of a Set with
+ * `capacity` bins.
+ *
+ * @remarks Objects occupy the same bin in Sets of equal capacity, so `obj` is only hashed if the
+ * capacities differ.
+ */
+static size_t binForObject(const Set *set, const ident obj, size_t capacity, size_t bin) {
+	return set->capacity == capacity ? bin : HashForObject(HASH_SEED, obj) % set->capacity;
+}
+
+/**
+ * @return True if `set` contains `obj`, which resides in bin `bin` of a Set with `capacity` bins.
+ */
+static _Bool containsObjectInBin(const Set *set, const ident obj, size_t capacity, size_t bin) {
+
+	if (set->elements == NULL) {
+		return $(set, containsObject, obj);
+	}
+
+	const Array *array = set->elements[binForObject(set, obj, capacity, bin)];
+	if (array) {
+		return $(array, containsObject, obj);
+	}
+
+	return false;
+}
+
+/**
+ * @brief Adds `obj`, which `set` does not already contain, to bin `bin` of `set`.
+ *
+ * @remarks Sets that store their Objects inline add `obj` by probing instead.
+ */
+static void addObjectToBin(Set *set, size_t bin, const ident obj) {
+
+	if (set->elements == NULL) {
+		$$(MutableSet, addObject, (MutableSet *) set, obj);
+		return;
+	}
+
+	MutableArray *array = set->elements[bin];
+	if (array == NULL) {
+		array = set->elements[bin] = alloc(MutableArray, init);
+	}
+
+	$(array, addObject, obj);
+	set->count++;
+}
+
+/**
+ * @return A new, empty Set with `capacity` bins.
+ */
+static Set *emptySetWithCapacity(size_t capacity) {
+
+	Set *set = (Set *) super(Object, _alloc(&_Set), init);
+	if (set) {
+
+		set->capacity = capacity;
+		if (set->capacity) {
+
+			set->elements = calloc(set->capacity, sizeof(ident));
+			assert(set->elements);
+		}
+	}
+
+	return set;
+}
+
+/**
+ * @fn _Bool Set::intersectsSet(const Set *self, const Set *set)
+ *
+ * @memberof Set
+ */
+static _Bool intersectsSet(const Set *self, const Set *set) {
+
+	assert(set);
+
+	const Set *smaller = self->count < set->count ? self : set;
+	const Set *larger = smaller == self ? set : self;
+
+	for (size_t i = 0; i < slotCount(smaller); i++) {
+
+		ident *objects;
+		const size_t count = objectsInSlot(smaller, i, &objects);
+
+		for (size_t j = 0; j < count; j++) {
+			if (containsObjectInBin(larger, objects[j], smaller->capacity, i)) {
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+/**
+ * @fn _Bool Set::isSubsetOfSet(const Set *self, const Set *set)
+ *
+ * @memberof Set
+ */
+static _Bool isSubsetOfSet(const Set *self, const Set *set) {
+
+	assert(set);
+
+	if (self->count > set->count) {
+		return false;
+	}
+
+	for (size_t i = 0; i < slotCount(self); i++) {
+
+		ident *objects;
+		const size_t count = objectsInSlot(self, i, &objects);
+
+		for (size_t j = 0; j < count; j++) {
+			if (containsObjectInBin(set, objects[j], self->capacity, i) == false) {
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+/**
+ * @brief ParallelFunction for mapConcurrently.
+ */
+static void mapConcurrently_parallel(size_t chunk, size_t begin, size_t end, ident data) {
+
+	TransformConcurrently *context = data;
+
+	for (size_t i = begin; i < end; i++) {
+
+		ident *elements;
+		const size_t elementCount = objectsInSlot(context->set, i, &elements);
+
+		if (elementCount) {
+
+			MutableArray *objects = alloc(MutableArray, initWithCapacity, elementCount);
+
+			for (size_t j = 0; j < elementCount; j++) {
+
+				ident obj = context->functor(elements[j], context->data);
+
+				$(objects, addObject, obj);
+
+				release(obj);
+			}
+
+			context->results[i] = objects;
+		}
+	}
+}
+
+/**
+ * @fn Set *Set::mapConcurrently(const Set *self, Functor functor, ident data, size_t chunkSize)
+ *
+ * @memberof Set
+ */
+static Set *mapConcurrently(const Set *self, Functor functor, ident data, size_t chunkSize) {
+
+	assert(functor);
+
+	MutableSet *set = alloc(MutableSet, initWithCapacity, self->capacity);
+
+	if (set && self->count) {
+
+		const size_t slots = slotCount(self);
+
+		TransformConcurrently context = {
+			.set = self,
+			.functor = functor,
+			.data = data,
+			.results = calloc(slots, sizeof(ident))
+		};
+
+		assert(context.results);
+
+		ParallelFor(slots, chunkSize, mapConcurrently_parallel, &context);
+
+		for (size_t i = 0; i < slots; i++) {
+
+			Array *objects = context.results[i];
+			if (objects) {
+
+				$(set, addObjectsFromArray, objects);
+
+				release(objects);
+			}
+		}
+
+		free(context.results);
+	}
+
+	return (Set *) set;
+}
+
+/**
+ * @brief The context of Set::reduceConcurrently.
+ */
+typedef struct {
+	const Set *set;
+	Reducer reducer;
+	ident data;
+	ident *results;
+} ReduceConcurrently;
+
+/**
+ * @brief ParallelFunction for reduceConcurrently.
+ */
+static void reduceConcurrently_parallel(size_t chunk, size_t begin, size_t end, ident data) {
+
+	ReduceConcurrently *context = data;
+
+	ident accumulator = NULL;
+
+	for (size_t i = begin; i < end; i++) {
+
+		ident *objects;
+		const size_t count = objectsInSlot(context->set, i, &objects);
+
+		for (size_t j = 0; j < count; j++) {
+			accumulator = ParallelFold(context->reducer, objects[j], accumulator, context->data);
+		}
+	}
+
+	context->results[chunk] = accumulator;
+}
+
+/**
+ * @fn ident Set::reduceConcurrently(const Set *self, Reducer reducer, Reducer combiner, ident data, size_t chunkSize)
+ *
+ * @memberof Set
+ */
+static ident reduceConcurrently(const Set *self, Reducer reducer, Reducer combiner, ident data, size_t chunkSize) {
+
+	assert(reducer);
+
+	if (self->count == 0) {
+		return NULL;
+	}
+
+	const size_t slots = slotCount(self);
+
+	chunkSize = ParallelChunkSize(slots, chunkSize);
+	const size_t chunks = (slots + chunkSize - 1) / chunkSize;
+
+	ReduceConcurrently context = {
+		.set = self,
+		.reducer = reducer,
+		.data = data,
+		.results = calloc(chunks, sizeof(ident))
+	};
+
+	assert(context.results);
+
+	ParallelFor(slots, chunkSize, reduceConcurrently_parallel, &context);
+
+	ident accumulator = NULL;
+
+	for (size_t i = 0; i < chunks; i++) {
+		if (context.results[i]) {
+			if (accumulator) {
+				accumulator = ParallelFold(combiner ?: reducer, context.results[i], accumulator, data);
+				release(context.results[i]);
+			} else {
+				accumulator = context.results[i];
+			}
+		}
+	}
+
+	free(context.results);
+
+	return accumulator;
+}
+
+/**
+ * @fn Set *Set::setByIntersectingSet(const Set *self, const Set *set)
+ *
+ * @memberof Set
+ */
+static Set *setByIntersectingSet(const Set *self, const Set *set) {
+
+	assert(set);
+
+	const Set *smaller = self->count < set->count ? self : set;
+	const Set *larger = smaller == self ? set : self;
+
+	Set *result = emptySetWithCapacity(smaller->capacity);
+	if (result) {
+
+		for (size_t i = 0; i < slotCount(smaller); i++) {
+
+			ident *objects;
+			const size_t count = objectsInSlot(smaller, i, &objects);
+
+			for (size_t j = 0; j < count; j++) {
+
+				const ident obj = objects[j];
+				if (containsObjectInBin(larger, obj, smaller->capacity, i)) {
+					addObjectToBin(result, i, obj);
+				}
+			}
+		}
+	}
+
+	return result;
+}
+
+/**
+ * @fn Set *Set::setBySubtractingSet(const Set *self, const Set *set)
+ *
+ * @memberof Set
+ */
+static Set *setBySubtractingSet(const Set *self, const Set *set) {
+
+	assert(set);
+
+	Set *result = emptySetWithCapacity(self->capacity);
+	if (result) {
+
+		for (size_t i = 0; i < slotCount(self); i++) {
+
+			ident *objects;
+			const size_t count = objectsInSlot(self, i, &objects);
+
+			for (size_t j = 0; j < count; j++) {
+
+				const ident obj = objects[j];
+				if (containsObjectInBin(set, obj, self->capacity, i) == false) {
+					addObjectToBin(result, i, obj);
+				}
+			}
+		}
+	}
+
+	return result;
+}
+
+/**
+ * @fn Set *Set::setByUnioningSet(const Set *self, const Set *set)
+ *
+ * @memberof Set
+ */
+static Set *setByUnioningSet(const Set *self, const Set *set) {
+
+	assert(set);
+
+	const Set *smaller = self->count < set->count ? self : set;
+	const Set *larger = smaller == self ? set : self;
+
+	size_t capacity = larger->capacity;
+	while (capacity && larger->count + smaller->count > capacity * SET_MAX_LOAD) {
+		capacity *= SET_GROW_FACTOR;
+	}
+
+	Set *result = emptySetWithCapacity(capacity);
+	if (result) {
+
+		for (size_t i = 0; i < slotCount(larger); i++) {
+
+			ident *objects;
+			const size_t count = objectsInSlot(larger, i, &objects);
+
+			for (size_t j = 0; j < count; j++) {
+
+				const ident obj = objects[j];
+				addObjectToBin(result, binForObject(result, obj, larger->capacity, i), obj);
+			}
+		}
+
+		for (size_t i = 0; i < slotCount(smaller); i++) {
+
+			ident *objects;
+			const size_t count = objectsInSlot(smaller, i, &objects);
+
+			for (size_t j = 0; j < count; j++) {
+
+				const ident obj = objects[j];
+				if (containsObjectInBin(result, obj, smaller->capacity, i) == false) {
+					addObjectToBin(result, binForObject(result, obj, smaller->capacity, i), obj);
+				}
+			}
+		}
+	}
+
+	return result;
+}
+
 /**
  * @fn Set *Set::setWithArray(const Array *array)
  *
@@ -355,19 +992,30 @@ static void initialize(Class *clazz) {
 
 	object->copy = copy;
 	object->dealloc = dealloc;
+	object->deepSizeInBytes = deepSizeInBytes;
 	object->description = description;
 	object->hash = hash;
 	object->isEqual = isEqual;
+	object->sizeInBytes = sizeInBytes;
 
 	SetInterface *set = (SetInterface *) clazz->interface;
 
 	set->allObjects = allObjects;
 	set->containsObject = containsObject;
 	set->enumerateObjects = enumerateObjects;
+	set->enumerateObjectsConcurrently = enumerateObjectsConcurrently;
+	set->filterConcurrently = filterConcurrently;
 	set->filteredSet = filteredSet;
 	set->initWithArray = initWithArray;
 	set->initWithSet = initWithSet;
 	set->initWithObjects = initWithObjects;
+	set->intersectsSet = intersectsSet;
+	set->isSubsetOfSet = isSubsetOfSet;
+	set->mapConcurrently = mapConcurrently;
+	set->reduceConcurrently = reduceConcurrently;
+	set->setByIntersectingSet = setByIntersectingSet;
+	set->setBySubtractingSet = setBySubtractingSet;
+	set->setByUnioningSet = setByUnioningSet;
 	set->setWithArray = setWithArray;
 	set->setWithObjects = setWithObjects;
 	set->setWithSet = setWithSet;
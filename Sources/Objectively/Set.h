@@ -38,6 +38,11 @@
  * @brief Abstract data types for aggregating Objects.
  */
 
+/**
+ * @brief The count of Objects a Set stores inline, before allocating its hash table.
+ */
+#define SET_INLINE_CAPACITY 8
+
 typedef struct Set Set;
 typedef struct SetInterface SetInterface;
 
@@ -76,7 +81,7 @@ struct Set {
 	SetInterface *interface;
 
 	/**
-	 * @brief The internal size (number of bins).
+	 * @brief The internal size (number of bins), or `0` while the Objects are stored inline.
 	 *
 	 * @private
 	 */
@@ -88,11 +93,18 @@ struct Set {
 	size_t count;
 
 	/**
-	 * @brief The elements.
+	 * @brief The elements, or `NULL` while the Objects are stored inline.
 	 *
 	 * @private
 	 */
 	ident *elements;
+
+	/**
+	 * @brief Up to `SET_INLINE_CAPACITY` Objects, linearly probed.
+	 *
+	 * @private
+	 */
+	ident objects[SET_INLINE_CAPACITY];
 };
 
 /**
@@ -137,6 +149,37 @@ struct SetInterface {
 	 */
 	void (*enumerateObjects)(const Set *self, SetEnumerator enumerator, ident data);
 
+	/**
+	 * @fn void Set::enumerateObjectsConcurrently(const Set *self, SetEnumerator enumerator, ident data, size_t chunkSize)
+	 *
+	 * @brief Enumerate the elements of this Set concurrently, in chunks of table slots.
+	 *
+	 * @param enumerator The enumerator function, which must be thread safe.
+	 * @param data User data.
+	 * @param chunkSize The count of table slots per chunk, or `0` to choose one automatically.
+	 *
+	 * @remarks The enumerator may return `true` to stop the enumeration as soon as possible.
+	 * The calling thread participates, and returns once every chunk has completed.
+	 *
+	 * @memberof Set
+	 */
+	void (*enumerateObjectsConcurrently)(const Set *self, SetEnumerator enumerator, ident data, size_t chunkSize);
+
+	/**
+	 * @fn Set *Set::filterConcurrently(const Set *self, Predicate predicate, ident data, size_t chunkSize)
+	 *
+	 * @brief Creates a new Set with elements that pass `predicate`, evaluated concurrently.
+	 *
+	 * @param predicate The predicate function, which must be thread safe.
+	 * @param data User data.
+	 * @param chunkSize The count of table slots per chunk, or `0` to choose one automatically.
+	 *
+	 * @return The new, filtered Set.
+	 *
+	 * @memberof Set
+	 */
+	Set *(*filterConcurrently)(const Set *self, Predicate predicate, ident data, size_t chunkSize);
+
 	/**
 	 * @fn void Set::filteredSet(const Set *self, Predicate predicate, ident data)
 	 *
@@ -188,6 +231,93 @@ struct SetInterface {
 	 */
 	Set *(*initWithSet)(Set *self, const Set *set);
 
+	/**
+	 * @fn _Bool Set::intersectsSet(const Set *self, const Set *set)
+	 *
+	 * @param set A Set.
+	 *
+	 * @return True if this Set and `set` share at least one Object, false otherwise.
+	 *
+	 * @memberof Set
+	 */
+	_Bool (*intersectsSet)(const Set *self, const Set *set);
+
+	/**
+	 * @fn _Bool Set::isSubsetOfSet(const Set *self, const Set *set)
+	 *
+	 * @param set A Set.
+	 *
+	 * @return True if every Object in this Set is also in `set`, false otherwise.
+	 *
+	 * @memberof Set
+	 */
+	_Bool (*isSubsetOfSet)(const Set *self, const Set *set);
+
+	/**
+	 * @fn Set *Set::mapConcurrently(const Set *self, Functor functor, ident data, size_t chunkSize)
+	 *
+	 * @brief Creates a new Set with the results of `functor` applied to each element.
+	 *
+	 * @param functor The Functor, which must be thread safe.
+	 * @param data User data.
+	 * @param chunkSize The count of table slots per chunk, or `0` to choose one automatically.
+	 *
+	 * @return The new, mapped Set, which may be smaller than this Set if results are equal.
+	 *
+	 * @memberof Set
+	 */
+	Set *(*mapConcurrently)(const Set *self, Functor functor, ident data, size_t chunkSize);
+
+	/**
+	 * @fn ident Set::reduceConcurrently(const Set *self, Reducer reducer, Reducer combiner, ident data, size_t chunkSize)
+	 *
+	 * @brief Reduces the elements of this Set concurrently, in chunks of table slots.
+	 *
+	 * @param reducer The Reducer applied to the elements of each chunk, which must be thread safe.
+	 * @param combiner The Reducer applied to the results of the chunks, or `NULL` to use `reducer`.
+	 * @param data User data.
+	 * @param chunkSize The count of table slots per chunk, or `0` to choose one automatically.
+	 *
+	 * @return The accumulated result, which the caller must release, or `NULL` if this Set
+	 * is empty.
+	 *
+	 * @memberof Set
+	 */
+	ident (*reduceConcurrently)(const Set *self, Reducer reducer, Reducer combiner, ident data, size_t chunkSize);
+
+	/**
+	 * @fn Set *Set::setByIntersectingSet(const Set *self, const Set *set)
+	 *
+	 * @param set A Set.
+	 *
+	 * @return A new Set containing the Objects in both this Set and `set`.
+	 *
+	 * @memberof Set
+	 */
+	Set *(*setByIntersectingSet)(const Set *self, const Set *set);
+
+	/**
+	 * @fn Set *Set::setBySubtractingSet(const Set *self, const Set *set)
+	 *
+	 * @param set A Set.
+	 *
+	 * @return A new Set containing the Objects in this Set but not in `set`.
+	 *
+	 * @memberof Set
+	 */
+	Set *(*setBySubtractingSet)(const Set *self, const Set *set);
+
+	/**
+	 * @fn Set *Set::setByUnioningSet(const Set *self, const Set *set)
+	 *
+	 * @param set A Set.
+	 *
+	 * @return A new Set containing the Objects in either this Set or `set`.
+	 *
+	 * @memberof Set
+	 */
+	Set *(*setByUnioningSet)(const Set *self, const Set *set);
+
 	/**
 	 * @static
 	 *
@@ -238,3 +368,76 @@ struct SetInterface {
  * @brief The Set Class.
  */
 extern Class _Set;
+
+/**
+ * @brief A stack-allocated cursor over the objects of a Set.
+ *
+ * @remarks Iterators do not retain the Set, and must not outlive it. The Set must not be
+ * modified while it is being iterated.
+ */
+typedef struct {
+
+	/**
+	 * @brief The Set.
+	 */
+	const Set *set;
+
+	/**
+	 * @brief The current bin, or inline Object.
+	 */
+	size_t bin;
+
+	/**
+	 * @brief The index of the next object within the current bin.
+	 */
+	size_t index;
+} SetIterator;
+
+/**
+ * @return A SetIterator positioned before the first object of `set`.
+ */
+static inline SetIterator MakeSetIterator(const Set *set) {
+	return (SetIterator) { .set = set, .bin = 0, .index = 0 };
+}
+
+/**
+ * @brief Advances `iterator` to the next object.
+ *
+ * @param iterator The SetIterator.
+ * @param obj Receives the next object.
+ *
+ * @return True if an object was available, false if `iterator` is exhausted.
+ */
+static inline _Bool SetIteratorNext(SetIterator *iterator, ident *obj) {
+
+	const Set *set = iterator->set;
+
+	if (set->elements == NULL) {
+
+		for (; iterator->bin < SET_INLINE_CAPACITY; iterator->bin++) {
+			if (set->objects[iterator->bin]) {
+				*obj = set->objects[iterator->bin++];
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	for (; iterator->bin < set->capacity; iterator->bin++, iterator->index = 0) {
+
+		const Array *array = (const Array *) set->elements[iterator->bin];
+		if (array && iterator->index < array->count) {
+			*obj = array->elements[iterator->index++];
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/**
+ * @brief Iterates the objects of `set`, assigning each to `obj`.
+ */
+#define SetForEach(obj, set) \
+	for (SetIterator _iterator = MakeSetIterator(set); SetIteratorNext(&_iterator, (ident *) &(obj)); )
@@ -0,0 +1,950 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <Objectively/Number.h>
+#include <Objectively/Parallel.h>
+#include <Objectively/Sort.h>
+#include <Objectively/String.h>
+
+/**
+ * @brief Partitions smaller than this are sorted by insertion.
+ */
+#define SORT_INSERTION_THRESHOLD 24
+
+/**
+ * @brief Partitions larger than this select their pivot with Tukey's ninther.
+ */
+#define SORT_NINTHER_THRESHOLD 128
+
+/**
+ * @brief The maximum number of moves permitted when speculatively insertion sorting.
+ */
+#define SORT_PARTIAL_INSERTION_LIMIT 8
+
+/**
+ * @brief The maximum depth of the Timsort run stack.
+ */
+#define SORT_MAX_RUNS 85
+
+/**
+ * @brief Concurrent sorts assign at least this many elements to each thread.
+ */
+#define SORT_CONCURRENT_THRESHOLD (1 << 15)
+
+/**
+ * @brief Key sorts smaller than this are sorted by insertion.
+ */
+#define SORT_RADIX_THRESHOLD 64
+
+/**
+ * @brief String key sorts recurse by radix to at most this depth, in bytes, before breaking
+ * remaining ties by comparison.
+ */
+#define SORT_RADIX_MAX_DEPTH 64
+
+/**
+ * @return True if `a` is ordered before `b`.
+ */
+static inline _Bool less(Comparator comparator, const ident a, const ident b) {
+	return comparator(a, b) < OrderSame;
+}
+
+/**
+ * @brief Swaps the elements at `a` and `b`.
+ */
+static inline void swap(ident *a, ident *b) {
+	const ident obj = *a;
+	*a = *b;
+	*b = obj;
+}
+
+/**
+ * @brief Reverses `count` `elements` in place.
+ */
+static void reverse(ident *elements, size_t count) {
+
+	for (size_t i = 0, j = count - 1; i < j; i++, j--) {
+		swap(elements + i, elements + j);
+	}
+}
+
+/**
+ * @brief A stable insertion sort for small partitions.
+ */
+static void insertionSort(ident *begin, ident *end, Comparator comparator) {
+
+	if (begin == end) {
+		return;
+	}
+
+	for (ident *cur = begin + 1; cur < end; cur++) {
+
+		ident *sift = cur;
+		if (less(comparator, *sift, *(sift - 1))) {
+
+			const ident obj = *sift;
+			do {
+				*sift = *(sift - 1);
+				sift--;
+			} while (sift > begin && less(comparator, obj, *(sift - 1)));
+
+			*sift = obj;
+		}
+	}
+}
+
+/**
+ * @brief Insertion sorts the given partition, unless doing so would require more than
+ * SORT_PARTIAL_INSERTION_LIMIT moves.
+ *
+ * @return True if the partition was sorted, false if the attempt was abandoned.
+ */
+static _Bool partialInsertionSort(ident *begin, ident *end, Comparator comparator) {
+
+	if (begin == end) {
+		return true;
+	}
+
+	size_t moves = 0;
+
+	for (ident *cur = begin + 1; cur < end; cur++) {
+
+		ident *sift = cur;
+		if (less(comparator, *sift, *(sift - 1))) {
+
+			const ident obj = *sift;
+			do {
+				*sift = *(sift - 1);
+				sift--;
+			} while (sift > begin && less(comparator, obj, *(sift - 1)));
+
+			*sift = obj;
+			moves += cur - sift;
+		}
+
+		if (moves > SORT_PARTIAL_INSERTION_LIMIT) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/**
+ * @brief Restores the max-heap property for the subtree rooted at `root`.
+ */
+static void siftDown(ident *elements, size_t root, size_t count, Comparator comparator) {
+
+	const ident obj = elements[root];
+
+	while (true) {
+
+		size_t child = 2 * root + 1;
+		if (child >= count) {
+			break;
+		}
+
+		if (child + 1 < count && less(comparator, elements[child], elements[child + 1])) {
+			child++;
+		}
+
+		if (less(comparator, obj, elements[child]) == false) {
+			break;
+		}
+
+		elements[root] = elements[child];
+		root = child;
+	}
+
+	elements[root] = obj;
+}
+
+/**
+ * @brief Heap sort, the worst-case fallback for pathological quicksort partitions.
+ */
+static void heapSort(ident *begin, ident *end, Comparator comparator) {
+
+	const size_t count = end - begin;
+
+	for (size_t i = count / 2; i > 0; i--) {
+		siftDown(begin, i - 1, count, comparator);
+	}
+
+	for (size_t i = count - 1; i > 0; i--) {
+		swap(begin, begin + i);
+		siftDown(begin, 0, i, comparator);
+	}
+}
+
+/**
+ * @brief Sorts the three given elements.
+ */
+static void sort3(ident *a, ident *b, ident *c, Comparator comparator) {
+
+	if (less(comparator, *b, *a)) {
+		swap(a, b);
+	}
+	if (less(comparator, *c, *b)) {
+		swap(b, c);
+	}
+	if (less(comparator, *b, *a)) {
+		swap(a, b);
+	}
+}
+
+/**
+ * @brief Partitions around the pivot at `begin`, placing elements equal to the pivot on
+ * the right.
+ *
+ * @param alreadyPartitioned Set to true if no elements were swapped.
+ *
+ * @return The final position of the pivot.
+ */
+static ident *partitionRight(ident *begin, ident *end, Comparator comparator, _Bool *alreadyPartitioned) {
+
+	const ident pivot = *begin;
+
+	ident *first = begin;
+	ident *last = end;
+
+	while (less(comparator, *++first, pivot)) {
+		;
+	}
+
+	if (first - 1 == begin) {
+		while (first < last && less(comparator, *--last, pivot) == false) {
+			;
+		}
+	} else {
+		while (less(comparator, *--last, pivot) == false) {
+			;
+		}
+	}
+
+	*alreadyPartitioned = first >= last;
+
+	while (first < last) {
+		swap(first, last);
+		while (less(comparator, *++first, pivot)) {
+			;
+		}
+		while (less(comparator, *--last, pivot) == false) {
+			;
+		}
+	}
+
+	ident *position = first - 1;
+
+	*begin = *position;
+	*position = pivot;
+
+	return position;
+}
+
+/**
+ * @brief Partitions around the pivot at `begin`, placing elements equal to the pivot on
+ * the left. This is used to skip runs of elements equal to a previous pivot.
+ *
+ * @return The final position of the pivot.
+ */
+static ident *partitionLeft(ident *begin, ident *end, Comparator comparator) {
+
+	const ident pivot = *begin;
+
+	ident *first = begin;
+	ident *last = end;
+
+	while (less(comparator, pivot, *--last)) {
+		;
+	}
+
+	if (last + 1 == end) {
+		while (first < last && less(comparator, pivot, *++first) == false) {
+			;
+		}
+	} else {
+		while (less(comparator, pivot, *++first) == false) {
+			;
+		}
+	}
+
+	while (first < last) {
+		swap(first, last);
+		while (less(comparator, pivot, *--last)) {
+			;
+		}
+		while (less(comparator, pivot, *++first) == false) {
+			;
+		}
+	}
+
+	*begin = *last;
+	*last = pivot;
+
+	return last;
+}
+
+/**
+ * @brief Pattern-defeating quicksort.
+ *
+ * @param badAllowed The number of unbalanced partitions tolerated before falling back to
+ * heap sort.
+ * @param leftmost True if this partition has no predecessor.
+ *
+ * @see https://github.com/orlp/pdqsort
+ */
+static void pdqSort(ident *begin, ident *end, Comparator comparator, int badAllowed, _Bool leftmost) {
+
+	while (true) {
+
+		const size_t size = end - begin;
+
+		if (size < SORT_INSERTION_THRESHOLD) {
+			insertionSort(begin, end, comparator);
+			return;
+		}
+
+		const size_t half = size / 2;
+
+		if (size > SORT_NINTHER_THRESHOLD) {
+			sort3(begin, begin + half, end - 1, comparator);
+			sort3(begin + 1, begin + (half - 1), end - 2, comparator);
+			sort3(begin + 2, begin + (half + 1), end - 3, comparator);
+			sort3(begin + (half - 1), begin + half, begin + (half + 1), comparator);
+			swap(begin, begin + half);
+		} else {
+			sort3(begin + half, begin, end - 1, comparator);
+		}
+
+		if (leftmost == false && less(comparator, *(begin - 1), *begin) == false) {
+			begin = partitionLeft(begin, end, comparator) + 1;
+			continue;
+		}
+
+		_Bool alreadyPartitioned;
+		ident *pivot = partitionRight(begin, end, comparator, &alreadyPartitioned);
+
+		const size_t leftSize = pivot - begin;
+		const size_t rightSize = end - (pivot + 1);
+
+		if (leftSize < size / 8 || rightSize < size / 8) {
+
+			if (--badAllowed == 0) {
+				heapSort(begin, end, comparator);
+				return;
+			}
+
+			if (leftSize >= SORT_INSERTION_THRESHOLD) {
+				swap(begin, begin + leftSize / 4);
+				swap(pivot - 1, pivot - leftSize / 4);
+
+				if (leftSize > SORT_NINTHER_THRESHOLD) {
+					swap(begin + 1, begin + (leftSize / 4 + 1));
+					swap(begin + 2, begin + (leftSize / 4 + 2));
+					swap(pivot - 2, pivot - (leftSize / 4 + 1));
+					swap(pivot - 3, pivot - (leftSize / 4 + 2));
+				}
+			}
+
+			if (rightSize >= SORT_INSERTION_THRESHOLD) {
+				swap(pivot + 1, pivot + (1 + rightSize / 4));
+				swap(end - 1, end - rightSize / 4);
+
+				if (rightSize > SORT_NINTHER_THRESHOLD) {
+					swap(pivot + 2, pivot + (2 + rightSize / 4));
+					swap(pivot + 3, pivot + (3 + rightSize / 4));
+					swap(end - 2, end - (1 + rightSize / 4));
+					swap(end - 3, end - (2 + rightSize / 4));
+				}
+			}
+		} else if (alreadyPartitioned) {
+			if (partialInsertionSort(begin, pivot, comparator) &&
+				partialInsertionSort(pivot + 1, end, comparator)) {
+				return;
+			}
+		}
+
+		pdqSort(begin, pivot, comparator, badAllowed, leftmost);
+
+		begin = pivot + 1;
+		leftmost = false;
+	}
+}
+
+/**
+ * @brief Sorts `count` `elements` with pattern-defeating quicksort.
+ */
+static void unstableSort(ident *elements, size_t count, Comparator comparator) {
+
+	int badAllowed = 1;
+	for (size_t n = count; n > 1; n >>= 1) {
+		badAllowed++;
+	}
+
+	pdqSort(elements, elements + count, comparator, badAllowed, true);
+}
+
+/**
+ * @return The index of the first element in `elements` that is ordered after `obj`.
+ */
+static size_t upperBound(const ident *elements, size_t count, const ident obj, Comparator comparator) {
+
+	size_t lo = 0, hi = count;
+	while (lo < hi) {
+		const size_t mid = lo + (hi - lo) / 2;
+		if (less(comparator, obj, elements[mid])) {
+			hi = mid;
+		} else {
+			lo = mid + 1;
+		}
+	}
+
+	return lo;
+}
+
+/**
+ * @return The index of the first element in `elements` that is not ordered before `obj`.
+ */
+static size_t lowerBound(const ident *elements, size_t count, const ident obj, Comparator comparator) {
+
+	size_t lo = 0, hi = count;
+	while (lo < hi) {
+		const size_t mid = lo + (hi - lo) / 2;
+		if (less(comparator, elements[mid], obj)) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	return lo;
+}
+
+/**
+ * @brief Stably merges the adjacent sorted runs `[0, mid)` and `[mid, count)`.
+ *
+ * @param buffer Scratch space for at least `mid` elements.
+ */
+static void merge(ident *elements, size_t mid, size_t count, ident *buffer, Comparator comparator) {
+
+	if (mid == 0 || mid == count) {
+		return;
+	}
+
+	if (less(comparator, elements[mid], elements[mid - 1]) == false) {
+		return;
+	}
+
+	const size_t skip = upperBound(elements, mid, elements[mid], comparator);
+
+	elements += skip;
+	mid -= skip;
+	count -= skip;
+
+	count = mid + lowerBound(elements + mid, count - mid, elements[mid - 1], comparator);
+
+	memcpy(buffer, elements, mid * sizeof(ident));
+
+	size_t i = 0, j = mid, k = 0;
+	while (i < mid && j < count) {
+		if (less(comparator, elements[j], buffer[i])) {
+			elements[k++] = elements[j++];
+		} else {
+			elements[k++] = buffer[i++];
+		}
+	}
+
+	memcpy(elements + k, buffer + i, (mid - i) * sizeof(ident));
+}
+
+/**
+ * @brief A sorted run, for Timsort.
+ */
+typedef struct {
+	size_t location;
+	size_t length;
+} SortRun;
+
+/**
+ * @return The minimum run length for Timsort.
+ */
+static size_t minimumRunLength(size_t count) {
+
+	size_t r = 0;
+	while (count >= 64) {
+		r |= count & 1;
+		count >>= 1;
+	}
+
+	return count + r;
+}
+
+/**
+ * @brief Identifies the run beginning at `elements`, reversing it if it is strictly descending.
+ *
+ * @return The length of the run.
+ */
+static size_t countRun(ident *elements, size_t count, Comparator comparator) {
+
+	if (count < 2) {
+		return count;
+	}
+
+	size_t length = 2;
+
+	if (less(comparator, elements[1], elements[0])) {
+		while (length < count && less(comparator, elements[length], elements[length - 1])) {
+			length++;
+		}
+		reverse(elements, length);
+	} else {
+		while (length < count && less(comparator, elements[length], elements[length - 1]) == false) {
+			length++;
+		}
+	}
+
+	return length;
+}
+
+/**
+ * @brief Merges runs `i` and `i + 1` on the run stack.
+ */
+static void mergeAt(ident *elements, SortRun *runs, size_t *size, size_t i, ident *buffer, Comparator comparator) {
+
+	SortRun *a = runs + i, *b = runs + i + 1;
+
+	merge(elements + a->location, a->length, a->length + b->length, buffer, comparator);
+
+	a->length += b->length;
+
+	if (i + 2 < *size) {
+		runs[i + 1] = runs[i + 2];
+	}
+
+	(*size)--;
+}
+
+/**
+ * @brief Sorts `count` `elements` with Timsort.
+ *
+ * @param buffer Scratch space for at least `count` elements.
+ */
+static void stableSort(ident *elements, size_t count, Comparator comparator, ident *buffer) {
+
+	if (count < SORT_INSERTION_THRESHOLD) {
+		insertionSort(elements, elements + count, comparator);
+		return;
+	}
+
+	const size_t minimum = minimumRunLength(count);
+
+	SortRun runs[SORT_MAX_RUNS];
+	size_t size = 0;
+
+	for (size_t location = 0; location < count; ) {
+
+		size_t length = countRun(elements + location, count - location, comparator);
+		if (length < minimum) {
+			const size_t forced = min(minimum, count - location);
+			insertionSort(elements + location, elements + location + forced, comparator);
+			length = forced;
+		}
+
+		assert(size < SORT_MAX_RUNS);
+		runs[size++] = (SortRun) { location, length };
+
+		location += length;
+
+		while (size > 1) {
+			size_t n = size - 2;
+
+			if ((n > 0 && runs[n - 1].length <= runs[n].length + runs[n + 1].length) ||
+				(n > 1 && runs[n - 2].length <= runs[n - 1].length + runs[n].length)) {
+				if (runs[n - 1].length < runs[n + 1].length) {
+					n--;
+				}
+			} else if (runs[n].length > runs[n + 1].length) {
+				break;
+			}
+
+			mergeAt(elements, runs, &size, n, buffer, comparator);
+		}
+	}
+
+	while (size > 1) {
+		size_t n = size - 2;
+		if (n > 0 && runs[n - 1].length < runs[n + 1].length) {
+			n--;
+		}
+		mergeAt(elements, runs, &size, n, buffer, comparator);
+	}
+}
+
+/**
+ * @brief A unit of work for concurrent sorting.
+ */
+typedef struct {
+	ident *elements;
+	size_t mid;
+	size_t count;
+	ident *buffer;
+	Comparator comparator;
+} SortTask;
+
+/**
+ * @brief Stably sorts, or merges, the given SortTask.
+ */
+static void executeSortTask(const SortTask *task) {
+
+	if (task->mid) {
+		merge(task->elements, task->mid, task->count, task->buffer, task->comparator);
+	} else {
+		stableSort(task->elements, task->count, task->comparator, task->buffer);
+	}
+}
+
+/**
+ * @brief ParallelFunction for concurrent SortTasks.
+ */
+static void executeSortTasks_parallel(size_t chunk, size_t begin, size_t end, ident data) {
+
+	for (size_t i = begin; i < end; i++) {
+		executeSortTask((SortTask *) data + i);
+	}
+}
+
+/**
+ * @brief Executes `count` SortTasks on the shared worker pool and the calling thread.
+ */
+static void executeSortTasks(SortTask *tasks, size_t count) {
+
+	ParallelFor(count, 1, executeSortTasks_parallel, tasks);
+}
+
+/**
+ * @brief Sorts `count` `elements` with a concurrent merge sort. Each processor sorts a
+ * contiguous partition, and the partitions are then merged pairwise, concurrently.
+ *
+ * @param buffer Scratch space for at least `count` elements.
+ */
+static void concurrentSort(ident *elements, size_t count, Comparator comparator, ident *buffer) {
+
+	const size_t processors = ParallelThreadCount();
+
+	size_t partitions = min(processors, count / SORT_CONCURRENT_THRESHOLD);
+	if (partitions < 2) {
+		stableSort(elements, count, comparator, buffer);
+		return;
+	}
+
+	SortTask tasks[partitions];
+	size_t bounds[partitions + 1];
+
+	for (size_t i = 0; i <= partitions; i++) {
+		bounds[i] = count * i / partitions;
+	}
+
+	for (size_t i = 0; i < partitions; i++) {
+		tasks[i] = (SortTask) {
+			.elements = elements + bounds[i],
+			.count = bounds[i + 1] - bounds[i],
+			.buffer = buffer + bounds[i],
+			.comparator = comparator
+		};
+	}
+
+	executeSortTasks(tasks, partitions);
+
+	while (partitions > 1) {
+
+		const size_t merges = partitions / 2;
+
+		for (size_t i = 0; i < merges; i++) {
+			const size_t lo = bounds[2 * i], mid = bounds[2 * i + 1], hi = bounds[2 * i + 2];
+			tasks[i] = (SortTask) {
+				.elements = elements + lo,
+				.mid = mid - lo,
+				.count = hi - lo,
+				.buffer = buffer + lo,
+				.comparator = comparator
+			};
+		}
+
+		executeSortTasks(tasks, merges);
+
+		size_t j = 0;
+		for (size_t i = 0; i <= partitions; i += 2) {
+			bounds[j++] = bounds[i];
+		}
+		if (partitions & 1) {
+			bounds[j++] = bounds[partitions];
+		}
+
+		partitions = j - 1;
+	}
+}
+
+void Sort(ident *elements, size_t count, Comparator comparator, SortOptions options) {
+
+	assert(comparator);
+
+	if (count < 2) {
+		return;
+	}
+
+	assert(elements);
+
+	if (options & (SortOptionStable | SortOptionConcurrent)) {
+
+		ident *buffer = malloc(count * sizeof(ident));
+		assert(buffer);
+
+		if (options & SortOptionConcurrent) {
+			concurrentSort(elements, count, comparator, buffer);
+		} else {
+			stableSort(elements, count, comparator, buffer);
+		}
+
+		free(buffer);
+	} else {
+		unstableSort(elements, count, comparator);
+	}
+}
+
+/**
+ * @brief A fixed-width, order-preserving sort key, and the element it was extracted from.
+ */
+typedef struct {
+	uint64_t key;
+	ident obj;
+} SortKey;
+
+/**
+ * @brief A stable insertion sort for small SortKey partitions.
+ */
+static void insertionSortKeys(SortKey *keys, size_t count) {
+
+	for (size_t i = 1; i < count; i++) {
+
+		const SortKey key = keys[i];
+
+		size_t j = i;
+		while (j > 0 && keys[j - 1].key > key.key) {
+			keys[j] = keys[j - 1];
+			j--;
+		}
+
+		keys[j] = key;
+	}
+}
+
+/**
+ * @brief Stably sorts `count` `keys` by least significant digit, one byte per pass. Passes
+ * in which every key shares the same digit are skipped.
+ *
+ * @param buffer Scratch space for at least `count` SortKeys.
+ */
+static void radixSortKeys(SortKey *keys, SortKey *buffer, size_t count) {
+
+	if (count < SORT_RADIX_THRESHOLD) {
+		insertionSortKeys(keys, count);
+		return;
+	}
+
+	size_t histograms[8][256];
+	memset(histograms, 0, sizeof(histograms));
+
+	for (size_t i = 0; i < count; i++) {
+		const uint64_t key = keys[i].key;
+		for (size_t digit = 0; digit < 8; digit++) {
+			histograms[digit][(key >> (digit * 8)) & 0xff]++;
+		}
+	}
+
+	SortKey *in = keys, *out = buffer;
+
+	for (size_t digit = 0; digit < 8; digit++) {
+
+		size_t *histogram = histograms[digit];
+
+		if (histogram[(in[0].key >> (digit * 8)) & 0xff] == count) {
+			continue;
+		}
+
+		size_t offset = 0;
+		for (size_t i = 0; i < 256; i++) {
+			const size_t n = histogram[i];
+			histogram[i] = offset;
+			offset += n;
+		}
+
+		for (size_t i = 0; i < count; i++) {
+			out[histogram[(in[i].key >> (digit * 8)) & 0xff]++] = in[i];
+		}
+
+		SortKey *swap = in;
+		in = out;
+		out = swap;
+	}
+
+	if (in != keys) {
+		memcpy(keys, in, count * sizeof(SortKey));
+	}
+}
+
+/**
+ * @return The order-preserving bit pattern of the given Number's value.
+ */
+static uint64_t numberKey(const Number *number) {
+
+	union {
+		double value;
+		uint64_t bits;
+	} key = { .value = number->value };
+
+	if (key.bits & 0x8000000000000000ull) {
+		return ~key.bits;
+	}
+
+	return key.bits | 0x8000000000000000ull;
+}
+
+/**
+ * @return The eight bytes of the given String at `depth`, packed big-endian and zero-padded.
+ */
+static uint64_t stringKey(const String *string, size_t depth) {
+
+	uint64_t key = 0;
+
+	if (depth < string->length) {
+
+		const uint8_t *bytes = (const uint8_t *) string->chars + depth;
+		const size_t length = min(string->length - depth, (size_t) 8);
+
+		for (size_t i = 0; i < length; i++) {
+			key |= (uint64_t) bytes[i] << (56 - 8 * i);
+		}
+	}
+
+	return key;
+}
+
+/**
+ * @brief A bytewise Comparator for Strings.
+ */
+static Order compareStrings(const ident obj1, const ident obj2) {
+
+	const String *a = obj1, *b = obj2;
+
+	const int i = memcmp(a->chars, b->chars, min(a->length, b->length));
+	if (i) {
+		return i < 0 ? OrderAscending : OrderDescending;
+	}
+
+	return a->length < b->length ? OrderAscending : a->length > b->length ? OrderDescending : OrderSame;
+}
+
+/**
+ * @brief Sorts `count` String `keys` by most significant digit, beginning at `depth`.
+ */
+static void radixSortStrings(SortKey *keys, SortKey *buffer, size_t count, size_t depth) {
+
+	for (size_t i = 0; i < count; i++) {
+		keys[i].key = stringKey(keys[i].obj, depth);
+	}
+
+	radixSortKeys(keys, buffer, count);
+
+	for (size_t i = 0; i < count; ) {
+
+		size_t j = i + 1;
+		while (j < count && keys[j].key == keys[i].key) {
+			j++;
+		}
+
+		if (j - i > 1 && (keys[i].key & 0xff)) {
+			if (depth + 8 < SORT_RADIX_MAX_DEPTH) {
+				radixSortStrings(keys + i, buffer, j - i, depth + 8);
+			} else {
+				ident *objs = (ident *) buffer;
+				for (size_t k = i; k < j; k++) {
+					objs[k - i] = keys[k].obj;
+				}
+
+				stableSort(objs, j - i, compareStrings, objs + (j - i));
+
+				for (size_t k = i; k < j; k++) {
+					keys[k].obj = objs[k - i];
+				}
+			}
+		}
+
+		i = j;
+	}
+}
+
+void SortByKey(ident *elements, size_t count) {
+
+	if (count < 2) {
+		return;
+	}
+
+	assert(elements);
+
+	SortKey *keys = malloc(count * sizeof(SortKey));
+	assert(keys);
+
+	SortKey *buffer = malloc(count * sizeof(SortKey));
+	assert(buffer);
+
+	const Object *first = cast(Object, elements[0]);
+	if ($(first, isKindOfClass, &_Number)) {
+
+		for (size_t i = 0; i < count; i++) {
+			keys[i].key = numberKey(cast(Number, elements[i]));
+			keys[i].obj = elements[i];
+		}
+
+		radixSortKeys(keys, buffer, count);
+
+	} else {
+		assert($(first, isKindOfClass, &_String));
+
+		for (size_t i = 0; i < count; i++) {
+			keys[i].obj = cast(String, elements[i]);
+		}
+
+		radixSortStrings(keys, buffer, count, 0);
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		elements[i] = keys[i].obj;
+	}
+
+	free(buffer);
+	free(keys);
+}
@@ -0,0 +1,85 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#pragma once
+
+#include <Objectively/Types.h>
+
+/**
+ * @file
+ *
+ * @brief Sorting algorithms for contiguous collections of Objects.
+ *
+ * @ingroup Collections
+ */
+
+/**
+ * @brief Options controlling the sorting algorithm.
+ */
+typedef enum {
+
+	/**
+	 * @brief An unstable, pattern-defeating quicksort. This is the fastest option for
+	 * sequential sorting, but it does not preserve the order of equal elements.
+	 */
+	SortOptionNone = 0,
+
+	/**
+	 * @brief A stable, natural merge sort (Timsort). Equal elements retain their relative
+	 * order, and presorted runs are detected and merged in linear time.
+	 */
+	SortOptionStable = 0x1,
+
+	/**
+	 * @brief A stable merge sort that partitions the elements across the available processors.
+	 * Sorts that are too small to benefit from concurrency fall back to `SortOptionStable`.
+	 */
+	SortOptionConcurrent = 0x2,
+} SortOptions;
+
+/**
+ * @brief Sorts `count` `elements` in place using `comparator`.
+ *
+ * @param elements The elements to sort.
+ * @param count The count of `elements`.
+ * @param comparator The Comparator.
+ * @param options The SortOptions.
+ *
+ * @remarks The Comparator is invoked directly, without an intermediary trampoline. For
+ * concurrent sorts, it must be safe to invoke from multiple threads simultaneously.
+ */
+extern void Sort(ident *elements, size_t count, Comparator comparator, SortOptions options);
+
+/**
+ * @brief Stably sorts `count` `elements` in place by radix, without a Comparator.
+ *
+ * @param elements The elements to sort, which must be either all Numbers or all Strings.
+ * @param count The count of `elements`.
+ *
+ * @remarks A fixed-width key is extracted from each element exactly once: the order-preserving
+ * bit pattern of Number::value, or the leading eight bytes of a String. Numbers are then
+ * sorted by least significant digit, and Strings by most significant digit, recursing into
+ * the following eight bytes only for Strings whose keys are equal. The resulting order
+ * agrees with Number::compareTo and with bytewise String comparison.
+ */
+extern void SortByKey(ident *elements, size_t count);
@@ -23,6 +23,7 @@
 
 #include <assert.h>
 #include <iconv.h>
+#include <pthread.h>
 #include <stdarg.h>
 #include <stdlib.h>
 #include <stdio.h>
@@ -30,102 +31,937 @@
 #include <wchar.h>
 
 #include <Objectively/Hash.h>
+#include <Objectively/HashMap.h>
 #include <Objectively/MutableArray.h>
 #include <Objectively/MutableString.h>
+#include <Objectively/Once.h>
 #include <Objectively/String.h>
 
+#include "ByteVector.h"
+
 #if defined(__MINGW32__)
 #define towlower_l _towlower_l
 #define towupper_l _towupper_l
 #endif
 
-#define _Class _String
+#define _Class _String
+
+/**
+ * @brief Needles of at least this many bytes are searched with Horspool's algorithm, whose
+ * skips outpace the vector filter.
+ */
+#define SEARCH_HORSPOOL_MIN 32
+
+/**
+ * @return `c`, folded to lowercase if it is an ASCII letter.
+ */
+static inline uint8_t foldByte(uint8_t c) {
+	return (uint8_t) (c - 'A') < 26 ? c | 0x20 : c;
+}
+
+/**
+ * @return `vector`, with its ASCII letters folded to lowercase.
+ */
+static inline ByteVector foldByteVector(ByteVector vector) {
+
+	const ByteVector upper = (ByteVector) ((vector >= 'A') & (vector <= 'Z'));
+
+	return vector | (upper & 0x20);
+}
+
+/**
+ * @return True if the `length` bytes at `a` and `b` are equal, folding ASCII letters if `fold`.
+ */
+static inline _Bool searchEqual(const uint8_t *a, const uint8_t *b, size_t length, _Bool fold) {
+
+	if (fold) {
+		for (size_t i = 0; i < length; i++) {
+			if (foldByte(a[i]) != foldByte(b[i])) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	return memcmp(a, b, length) == 0;
+}
+
+/**
+ * @return The mask of positions in `haystack[0, BYTE_VECTOR_LANES)` at which `needle` may begin,
+ * having matched its first and last bytes. Each candidate sets the low bit of its byte.
+ */
+static inline ByteVectorMask searchCandidates(const uint8_t *haystack, size_t length, ByteVector first, ByteVector last, _Bool fold) {
+
+	ByteVector head = loadByteVector(haystack);
+	ByteVector tail = loadByteVector(haystack + length - 1);
+
+	if (fold) {
+		head = foldByteVector(head);
+		tail = foldByteVector(tail);
+	}
+
+	return (ByteVectorMask) ((head == first) & (tail == last)) & 0x0101010101010101ull;
+}
+
+/**
+ * @brief Searches with Horspool's algorithm, which skips ahead by the distance from the last
+ * occurrence of the mismatched byte to the end of `needle`.
+ */
+static const uint8_t *searchHorspool(const uint8_t *haystack, size_t haystackLength, const uint8_t *needle, size_t length, StringSearchOptions options) {
+
+	const _Bool fold = options & StringSearchOptionCaseInsensitive;
+
+	size_t shift[256];
+	for (size_t i = 0; i < lengthof(shift); i++) {
+		shift[i] = length;
+	}
+
+	if (options & StringSearchOptionBackwards) {
+
+		for (size_t i = length - 1; i > 0; i--) {
+			shift[fold ? foldByte(needle[i]) : needle[i]] = i;
+		}
+
+		const uint8_t first = fold ? foldByte(needle[0]) : needle[0];
+
+		for (size_t i = haystackLength - length + 1; i > 0; ) {
+
+			const uint8_t *candidate = haystack + i - 1;
+			const uint8_t c = fold ? foldByte(*candidate) : *candidate;
+
+			if (c == first && searchEqual(candidate + 1, needle + 1, length - 1, fold)) {
+				return candidate;
+			}
+
+			i = i > shift[c] ? i - shift[c] : 0;
+		}
+	} else {
+
+		for (size_t i = 0; i < length - 1; i++) {
+			shift[fold ? foldByte(needle[i]) : needle[i]] = length - 1 - i;
+		}
+
+		const uint8_t last = fold ? foldByte(needle[length - 1]) : needle[length - 1];
+
+		for (size_t i = 0; i + length <= haystackLength; ) {
+
+			const uint8_t *candidate = haystack + i;
+			const uint8_t c = fold ? foldByte(candidate[length - 1]) : candidate[length - 1];
+
+			if (c == last && searchEqual(candidate, needle, length - 1, fold)) {
+				return candidate;
+			}
+
+			i += shift[c];
+		}
+	}
+
+	return NULL;
+}
+
+/**
+ * @brief Searches by comparing the first and last bytes of `needle` against a vector of
+ * positions at a time, and the remaining bytes only where both match.
+ */
+static const uint8_t *searchVector(const uint8_t *haystack, size_t haystackLength, const uint8_t *needle, size_t length, StringSearchOptions options) {
+
+	const _Bool fold = options & StringSearchOptionCaseInsensitive;
+
+	const uint8_t f = fold ? foldByte(needle[0]) : needle[0];
+	const uint8_t l = fold ? foldByte(needle[length - 1]) : needle[length - 1];
+
+	const ByteVector first = (ByteVector) { 0 } + f;
+	const ByteVector last = (ByteVector) { 0 } + l;
+
+	const size_t positions = haystackLength - length + 1;
+
+	if (options & StringSearchOptionBackwards) {
+
+		size_t end = positions;
+		for (; end >= BYTE_VECTOR_LANES; end -= BYTE_VECTOR_LANES) {
+
+			const uint8_t *block = haystack + end - BYTE_VECTOR_LANES;
+			const ByteVectorMask mask = searchCandidates(block, length, first, last, fold);
+
+			for (size_t w = lengthof(mask); w > 0; w--) {
+				for (uint64_t word = mask[w - 1]; word; word &= ~(1ull << (63 - __builtin_clzll(word)))) {
+
+					const uint8_t *candidate = block + (w - 1) * 8 + ((63 - __builtin_clzll(word)) >> 3);
+					if (length < 3 || searchEqual(candidate + 1, needle + 1, length - 2, fold)) {
+						return candidate;
+					}
+				}
+			}
+		}
+
+		while (end > 0) {
+			const uint8_t *candidate = haystack + --end;
+			if (searchEqual(candidate, needle, length, fold)) {
+				return candidate;
+			}
+		}
+	} else {
+
+		size_t start = 0;
+		for (; start + BYTE_VECTOR_LANES <= positions; start += BYTE_VECTOR_LANES) {
+
+			const uint8_t *block = haystack + start;
+			const ByteVectorMask mask = searchCandidates(block, length, first, last, fold);
+
+			for (size_t w = 0; w < lengthof(mask); w++) {
+				for (uint64_t word = mask[w]; word; word &= word - 1) {
+
+					const uint8_t *candidate = block + w * 8 + (__builtin_ctzll(word) >> 3);
+					if (length < 3 || searchEqual(candidate + 1, needle + 1, length - 2, fold)) {
+						return candidate;
+					}
+				}
+			}
+		}
+
+		for (; start < positions; start++) {
+			const uint8_t *candidate = haystack + start;
+			if (searchEqual(candidate, needle, length, fold)) {
+				return candidate;
+			}
+		}
+	}
+
+	return NULL;
+}
+
+/**
+ * @return The occurrence of `needle` in `haystack` selected by `options`, or `NULL`.
+ */
+static const char *searchCharacters(const char *haystack, size_t haystackLength, const char *needle, size_t length, StringSearchOptions options) {
+
+	if (length == 0 || length > haystackLength) {
+		return NULL;
+	}
+
+	const uint8_t *h = (const uint8_t *) haystack;
+	const uint8_t *n = (const uint8_t *) needle;
+
+	const _Bool fold = options & StringSearchOptionCaseInsensitive;
+
+	if (options & StringSearchOptionAnchored) {
+
+		if (options & StringSearchOptionBackwards) {
+			h += haystackLength - length;
+		}
+
+		return searchEqual(h, n, length, fold) ? (const char *) h : NULL;
+	}
+
+	if (length == 1 && !(options & StringSearchOptionBackwards) && (!fold || (uint8_t) (foldByte(*n) - 'a') >= 26)) {
+		return memchr(haystack, *needle, haystackLength);
+	}
+
+	if (length >= SEARCH_HORSPOOL_MIN) {
+		return (const char *) searchHorspool(h, haystackLength, n, length, options);
+	}
+
+	return (const char *) searchVector(h, haystackLength, n, length, options);
+}
+
+/**
+ * @brief The key of an interned String: its characters, which need not be null-terminated.
+ */
+typedef struct {
+	const char *chars;
+	size_t length;
+} InternKey;
+
+/**
+ * @return The hash of `key`.
+ */
+static inline size_t hashInternKey(const InternKey key) {
+	return (size_t) HashForBytes64(HASH_SEED, (const uint8_t *) key.chars, key.length);
+}
+
+/**
+ * @return True if the keys `a` and `b` have the same characters.
+ */
+static inline _Bool internKeysEqual(const InternKey a, const InternKey b) {
+	return a.length == b.length && memcmp(a.chars, b.chars, a.length) == 0;
+}
+
+/**
+ * @brief Maps characters to their interned Strings.
+ */
+DECLARE_HASHMAP(InternTable, InternKey, String *, hashInternKey, internKeysEqual);
+
+static InternTable _internTable;
+static pthread_rwlock_t _internLock = PTHREAD_RWLOCK_INITIALIZER;
+
+/**
+ * @return The interned String for the `length` bytes at `chars`, interning `string` if it is
+ * given and suitable, or a copy of `chars` otherwise.
+ *
+ * @remarks Lookups share a read lock, so that only interning a new String serializes callers.
+ */
+static String *internCharacters(const char *chars, size_t length, const String *string) {
+
+	const InternKey key = { chars, length };
+
+	String *interned = NULL;
+
+	pthread_rwlock_rdlock(&_internLock);
+
+	String **value = InternTableGet(&_internTable, key);
+	if (value) {
+		interned = *value;
+	}
+
+	pthread_rwlock_unlock(&_internLock);
+
+	if (interned) {
+		return interned;
+	}
+
+	pthread_rwlock_wrlock(&_internLock);
+
+	value = InternTableGet(&_internTable, key);
+	if (value) {
+		interned = *value;
+	} else {
+		if (string && classof(string) == &_String && string->backing == NULL) {
+			interned = retain((String *) string);
+		} else {
+			char *mem = malloc(length + 1);
+			assert(mem);
+
+			memcpy(mem, chars, length);
+			mem[length] = '\0';
+
+			interned = $$(String, stringWithMemory, mem, length);
+		}
+
+		interned->isInterned = true;
+
+		const InternKey internedKey = { interned->chars, interned->length };
+		InternTableSet(&_internTable, internedKey, interned);
+	}
+
+	pthread_rwlock_unlock(&_internLock);
+
+	return interned;
+}
+
+#pragma mark - Object
+
+/**
+ * @see Object::copy(const Object *)
+ */
+static Object *copy(const Object *self) {
+
+	String *this = (String *) self;
+	String *that = $$(String, stringWithCharacters, this->chars);
+
+	return (Object *) that;
+}
+
+/**
+ * @see Object::dealloc(Object *)
+ */
+static void dealloc(Object *self) {
+
+	String *this = (String *) self;
+
+	if (this->backing) {
+		release(this->backing);
+	} else if (this->chars != this->inlineChars) {
+		free(this->chars);
+	}
+
+	super(Object, self, dealloc);
+}
+
+/**
+ * @see Object::description(const Object *)
+ */
+static String *description(const Object *self) {
+
+	return (String *) $(self, copy);
+}
+
+/**
+ * @see Object::hash(const Object *)
+ */
+static int hash(const Object *self) {
+
+	String *this = (String *) self;
+
+	return HashForCString(HASH_SEED, this->chars);
+}
+
+/**
+ * @see Object::isEqual(const Object *, const Object *)
+ */
+static _Bool isEqual(const Object *self, const Object *other) {
+
+	if (super(Object, self, isEqual, other)) {
+		return true;
+	}
+
+	if (other && $(other, isKindOfClass, &_String)) {
+
+		const String *this = (String *) self;
+		const String *that = (String *) other;
+
+		if (this->isInterned && that->isInterned) {
+			return false;
+		}
+
+		if (this->length == that->length) {
+
+			const Range range = { 0, this->length };
+			return $(this, compareTo, that, range) == OrderSame;
+		}
+	}
+
+	return false;
+}
+
+/**
+ * @see Object::sizeInBytes(const Object *)
+ */
+static size_t sizeInBytes(const Object *self) {
+
+	const String *this = (String *) self;
+
+	size_t size = super(Object, self, sizeInBytes);
+
+	if (this->chars && this->chars != this->inlineChars && this->backing == NULL) {
+		size += this->length + 1;
+	}
+
+	return size;
+}
+
+#pragma mark - String
+
+/**
+ * @fn void String::compact(String *self)
+ *
+ * @memberof String
+ */
+static void compact(String *self) {
+
+	if (self->backing) {
+
+		if (self->length < STRING_INLINE_CAPACITY) {
+			memcpy(self->inlineChars, self->chars, self->length + 1);
+			self->chars = self->inlineChars;
+		} else {
+			char *mem = malloc(self->length + 1);
+			assert(mem);
+
+			memcpy(mem, self->chars, self->length + 1);
+			self->chars = mem;
+		}
+
+		release(self->backing);
+		self->backing = NULL;
+	}
+}
+
+/**
+ * @brief Initializes `self` with a copy of the first `length` bytes of `chars`, stored inline.
+ */
+static String *initWithInlineCharacters(String *self, const char *chars, size_t length) {
+
+	assert(length < STRING_INLINE_CAPACITY);
+
+	self = (String *) super(Object, self, init);
+	if (self) {
+
+		memcpy(self->inlineChars, chars, length);
+		self->inlineChars[length] = '\0';
+
+		self->chars = self->inlineChars;
+		self->length = length;
+	}
+
+	return self;
+}
+
+/**
+ * @brief Initializes `self` as a view of the null-terminated `chars`, which reside in the buffer
+ * owned by `backing`.
+ */
+static String *initWithView(String *self, Object *backing, const char *chars, size_t length) {
+
+	assert(chars[length] == '\0');
+
+	self = (String *) super(Object, self, init);
+	if (self) {
+
+		self->backing = retain(backing);
+
+		self->chars = (char *) chars;
+		self->length = length;
+	}
+
+	return self;
+}
+
+/**
+ * @brief Character transcoding context for `iconv`.
+ *
+ * @see iconv(3)
+ */
+typedef struct {
+	StringEncoding to;
+	StringEncoding from;
+	char *in;
+	size_t length;
+	char *out;
+	size_t size;
+} Transcode;
+
+/**
+ * @brief The byte order mark, which leads UTF-16 and UTF-32 output.
+ */
+#define BYTE_ORDER_MARK 0xfeff
+
+/**
+ * @return True if `encoding` is transcoded natively rather than via `iconv`.
+ */
+static _Bool isNativeEncoding(StringEncoding encoding) {
+
+	switch (encoding) {
+		case STRING_ENCODING_ASCII:
+		case STRING_ENCODING_LATIN1:
+		case STRING_ENCODING_UTF16:
+		case STRING_ENCODING_UTF32:
+		case STRING_ENCODING_UTF8:
+		case STRING_ENCODING_WCHAR:
+			return true;
+		default:
+			return false;
+	}
+}
+
+/**
+ * @return The code point decoded from the UTF-8 at `*in`, advancing `*in` past it, or `-1` if
+ * `*in` is not a valid, shortest form encoding of a Unicode scalar value.
+ */
+static int32_t decodeUTF8(const uint8_t **in, const uint8_t *end) {
+
+	const uint8_t *s = *in;
+	const uint8_t c = *s;
+
+	int32_t codepoint;
+	size_t length;
+
+	if (c < 0x80) {
+		*in = s + 1;
+		return c;
+	} else if (c >= 0xc2 && c <= 0xdf) {
+		codepoint = c & 0x1f;
+		length = 2;
+	} else if (c >= 0xe0 && c <= 0xef) {
+		codepoint = c & 0x0f;
+		length = 3;
+	} else if (c >= 0xf0 && c <= 0xf4) {
+		codepoint = c & 0x07;
+		length = 4;
+	} else {
+		return -1;
+	}
+
+	if ((size_t) (end - s) < length) {
+		return -1;
+	}
+
+	for (size_t i = 1; i < length; i++) {
+		if ((s[i] & 0xc0) != 0x80) {
+			return -1;
+		}
+		codepoint = (codepoint << 6) | (s[i] & 0x3f);
+	}
+
+	if ((length == 3 && codepoint < 0x800) || (length == 4 && codepoint < 0x10000)) {
+		return -1;
+	}
+
+	if ((codepoint >= 0xd800 && codepoint <= 0xdfff) || codepoint > 0x10ffff) {
+		return -1;
+	}
+
+	*in = s + length;
+	return codepoint;
+}
+
+/**
+ * @return The number of bytes of UTF-8 written to `out` to encode `codepoint`.
+ */
+static size_t encodeUTF8(int32_t codepoint, uint8_t *out) {
+
+	if (codepoint < 0x80) {
+		out[0] = codepoint;
+		return 1;
+	} else if (codepoint < 0x800) {
+		out[0] = 0xc0 | (codepoint >> 6);
+		out[1] = 0x80 | (codepoint & 0x3f);
+		return 2;
+	} else if (codepoint < 0x10000) {
+		out[0] = 0xe0 | (codepoint >> 12);
+		out[1] = 0x80 | ((codepoint >> 6) & 0x3f);
+		out[2] = 0x80 | (codepoint & 0x3f);
+		return 3;
+	} else {
+		out[0] = 0xf0 | (codepoint >> 18);
+		out[1] = 0x80 | ((codepoint >> 12) & 0x3f);
+		out[2] = 0x80 | ((codepoint >> 6) & 0x3f);
+		out[3] = 0x80 | (codepoint & 0x3f);
+		return 4;
+	}
+}
+
+/**
+ * @return True if every byte of `vector` is ASCII.
+ */
+static inline _Bool isASCIIVector(ByteVector vector) {
+
+	const ByteVectorMask high = (ByteVectorMask) (vector & 0x80);
+
+	uint64_t any = 0;
+	for (size_t i = 0; i < lengthof(high); i++) {
+		any |= high[i];
+	}
+
+	return any == 0;
+}
+
+/**
+ * @return True if the `length` bytes at `bytes` are valid UTF-8.
+ *
+ * @remarks Runs of ASCII are skipped a vector at a time. Vectors containing other bytes are
+ * decoded sequence by sequence, after which the vector scan resumes.
+ */
+static _Bool validateUTF8(const uint8_t *bytes, size_t length) {
+
+	const uint8_t *in = bytes;
+	const uint8_t *end = bytes + length;
+
+	while (in < end) {
+
+		if (end - in >= BYTE_VECTOR_LANES && isASCIIVector(loadByteVector(in))) {
+			in += BYTE_VECTOR_LANES;
+			continue;
+		}
+
+		const uint8_t *stop = min(in + BYTE_VECTOR_LANES, end);
+		while (in < stop) {
+			if (decodeUTF8(&in, end) < 0) {
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+/**
+ * @return The count of code points in the `length` bytes of UTF-8 at `bytes`, which is the
+ * count of bytes that do not continue a sequence.
+ */
+static size_t countCodePoints(const uint8_t *bytes, size_t length) {
+
+	size_t count = 0, i = 0;
+
+	while (i + BYTE_VECTOR_LANES <= length) {
+
+		ByteVector leads = { 0 };
+
+		for (size_t j = 0; j < 255 && i + BYTE_VECTOR_LANES <= length; j++, i += BYTE_VECTOR_LANES) {
+			const ByteVector vector = loadByteVector(bytes + i);
+			leads -= (ByteVector) ((vector & 0xc0) != 0x80);
+		}
+
+		for (size_t j = 0; j < BYTE_VECTOR_LANES; j++) {
+			count += leads[j];
+		}
+	}
+
+	for (; i < length; i++) {
+		count += (bytes[i] & 0xc0) != 0x80;
+	}
+
+	return count;
+}
+
+/**
+ * @return The width in bytes of the code units of `encoding`, which must be UTF-16, UTF-32 or
+ * wide characters.
+ */
+static inline size_t unitSize(StringEncoding encoding) {
+
+	switch (encoding) {
+		case STRING_ENCODING_UTF16:
+			return sizeof(uint16_t);
+		case STRING_ENCODING_UTF32:
+			return sizeof(uint32_t);
+		default:
+			return sizeof(wchar_t);
+	}
+}
+
+/**
+ * @return The code unit of `size` bytes at `in`, in host byte order, swapping its bytes if `swap`.
+ */
+static inline uint32_t readUnit(const uint8_t *in, size_t size, _Bool swap) {
+
+	if (size == sizeof(uint16_t)) {
+		uint16_t unit;
+		memcpy(&unit, in, sizeof(unit));
+		return swap ? __builtin_bswap16(unit) : unit;
+	} else {
+		uint32_t unit;
+		memcpy(&unit, in, sizeof(unit));
+		return swap ? __builtin_bswap32(unit) : unit;
+	}
+}
+
+/**
+ * @brief Writes the code unit `unit` of `size` bytes to `out`, in host byte order.
+ */
+static inline void writeUnit(uint32_t unit, size_t size, uint8_t *out) {
+
+	if (size == sizeof(uint16_t)) {
+		const uint16_t u = unit;
+		memcpy(out, &u, sizeof(u));
+	} else {
+		memcpy(out, &unit, sizeof(unit));
+	}
+}
+
+/**
+ * @brief Transcodes between the native encodings without `iconv`.
+ *
+ * @return The number of bytes written to `trans->out`, or `-1` if the input is invalid or the
+ * output does not fit.
+ */
+static size_t transcodeNative(const Transcode *trans) {
+
+	const uint8_t *in = (const uint8_t *) trans->in;
+	const uint8_t *end = in + trans->length;
+
+	uint8_t *out = (uint8_t *) trans->out;
+	uint8_t *limit = out + trans->size;
+
+	if (trans->from == STRING_ENCODING_UTF8 && trans->to == STRING_ENCODING_UTF8) {
+
+		if (trans->length > trans->size) {
+			return (size_t) -1;
+		}
+
+		if (validateUTF8(in, trans->length) == false) {
+			return (size_t) -1;
+		}
+
+		memcpy(out, trans->in, trans->length);
+		return trans->length;
+	}
+
+	_Bool swap = false;
+
+	if (trans->from == STRING_ENCODING_UTF16 || trans->from == STRING_ENCODING_UTF32) {
+
+		const size_t size = unitSize(trans->from);
+		if ((size_t) (end - in) >= size) {
+
+			const uint32_t unit = readUnit(in, size, false);
+			if (unit == BYTE_ORDER_MARK) {
+				in += size;
+			} else if (unit == (size == sizeof(uint16_t) ? 0xfffe : 0xfffe0000)) {
+				in += size;
+				swap = true;
+			}
+		}
+	}
+
+	if ((trans->to == STRING_ENCODING_UTF16 || trans->to == STRING_ENCODING_UTF32) && in < end) {
+
+		const size_t size = unitSize(trans->to);
+		if ((size_t) (limit - out) < size) {
+			return (size_t) -1;
+		}
 
-#pragma mark - Object
+		writeUnit(BYTE_ORDER_MARK, size, out);
+		out += size;
+	}
 
-/**
- * @see Object::copy(const Object *)
- */
-static Object *copy(const Object *self) {
+	while (in < end) {
 
-	String *this = (String *) self;
-	String *that = $$(String, stringWithCharacters, this->chars);
+		int32_t codepoint;
 
-	return (Object *) that;
-}
+		switch (trans->from) {
+			case STRING_ENCODING_ASCII:
+				codepoint = *in < 0x80 ? *in++ : -1;
+				break;
 
-/**
- * @see Object::dealloc(Object *)
- */
-static void dealloc(Object *self) {
+			case STRING_ENCODING_LATIN1:
+				codepoint = *in++;
+				break;
 
-	String *this = (String *) self;
+			case STRING_ENCODING_UTF8:
+				codepoint = decodeUTF8(&in, end);
+				break;
 
-	free(this->chars);
+			default: {
+				const size_t size = unitSize(trans->from);
+				if ((size_t) (end - in) < size) {
+					return (size_t) -1;
+				}
 
-	super(Object, self, dealloc);
+				uint32_t unit = readUnit(in, size, swap);
+				in += size;
+
+				if (size == sizeof(uint16_t) && unit >= 0xd800 && unit <= 0xdbff) {
+
+					if ((size_t) (end - in) < size) {
+						return (size_t) -1;
+					}
+
+					const uint32_t low = readUnit(in, size, swap);
+					if (low < 0xdc00 || low > 0xdfff) {
+						return (size_t) -1;
+					}
+
+					in += size;
+					unit = 0x10000 + ((unit - 0xd800) << 10) + (low - 0xdc00);
+
+				} else if (unit >= 0xd800 && unit <= 0xdfff) {
+					return (size_t) -1;
+				}
+
+				codepoint = unit <= 0x10ffff ? (int32_t) unit : -1;
+			}
+				break;
+		}
+
+		if (codepoint < 0) {
+			return (size_t) -1;
+		}
+
+		switch (trans->to) {
+			case STRING_ENCODING_ASCII:
+			case STRING_ENCODING_LATIN1:
+				if (codepoint >= (trans->to == STRING_ENCODING_ASCII ? 0x80 : 0x100) || out == limit) {
+					return (size_t) -1;
+				}
+				*out++ = codepoint;
+				break;
+
+			case STRING_ENCODING_UTF8: {
+				uint8_t bytes[4];
+
+				const size_t length = encodeUTF8(codepoint, bytes);
+				if ((size_t) (limit - out) < length) {
+					return (size_t) -1;
+				}
+
+				memcpy(out, bytes, length);
+				out += length;
+			}
+				break;
+
+			default: {
+				const size_t size = unitSize(trans->to);
+				if (size == sizeof(uint16_t) && codepoint >= 0x10000) {
+
+					if ((size_t) (limit - out) < size * 2) {
+						return (size_t) -1;
+					}
+
+					writeUnit(0xd800 + ((codepoint - 0x10000) >> 10), size, out);
+					writeUnit(0xdc00 + ((codepoint - 0x10000) & 0x3ff), size, out + size);
+					out += size * 2;
+
+				} else {
+
+					if ((size_t) (limit - out) < size) {
+						return (size_t) -1;
+					}
+
+					writeUnit(codepoint, size, out);
+					out += size;
+				}
+			}
+				break;
+		}
+	}
+
+	return out - (uint8_t *) trans->out;
 }
 
 /**
- * @see Object::description(const Object *)
+ * @brief The `iconv` descriptors opened by the current thread, indexed by their encodings.
  */
-static String *description(const Object *self) {
+typedef struct {
+	iconv_t descriptors[STRING_ENCODING_WCHAR + 1][STRING_ENCODING_WCHAR + 1];
+} TranscodeCache;
 
-	return (String *) $(self, copy);
-}
+static pthread_key_t _transcodeCacheKey;
 
 /**
- * @see Object::hash(const Object *)
+ * @brief Closes the `iconv` descriptors of an exiting thread.
  */
-static int hash(const Object *self) {
+static void freeTranscodeCache(void *data) {
 
-	String *this = (String *) self;
+	TranscodeCache *cache = data;
 
-	return HashForCString(HASH_SEED, this->chars);
+	for (size_t i = 0; i < lengthof(cache->descriptors); i++) {
+		for (size_t j = 0; j < lengthof(cache->descriptors[i]); j++) {
+			if (cache->descriptors[i][j]) {
+				iconv_close(cache->descriptors[i][j]);
+			}
+		}
+	}
+
+	free(cache);
 }
 
 /**
- * @see Object::isEqual(const Object *, const Object *)
+ * @return The `iconv` descriptor of the current thread for transcoding `from` to `to`, reset to
+ * its initial shift state.
  */
-static _Bool isEqual(const Object *self, const Object *other) {
+static iconv_t transcodeDescriptor(StringEncoding to, StringEncoding from) {
 
-	if (super(Object, self, isEqual, other)) {
-		return true;
-	}
+	static Once once;
 
-	if (other && $(other, isKindOfClass, &_String)) {
+	do_once(&once, {
+		const int err = pthread_key_create(&_transcodeCacheKey, freeTranscodeCache);
+		assert(err == 0);
+	});
 
-		const String *this = (String *) self;
-		const String *that = (String *) other;
+	TranscodeCache *cache = pthread_getspecific(_transcodeCacheKey);
+	if (cache == NULL) {
 
-		if (this->length == that->length) {
+		cache = calloc(1, sizeof(TranscodeCache));
+		assert(cache);
 
-			const Range range = { 0, this->length };
-			return $(this, compareTo, that, range) == OrderSame;
-		}
+		const int err = pthread_setspecific(_transcodeCacheKey, cache);
+		assert(err == 0);
 	}
 
-	return false;
-}
-
-#pragma mark - String
+	iconv_t cd = cache->descriptors[to][from];
+	if (cd == NULL) {
+		cd = cache->descriptors[to][from] = iconv_open(NameForStringEncoding(to), NameForStringEncoding(from));
+		assert(cd != (iconv_t) -1);
+	} else {
+		iconv(cd, NULL, NULL, NULL, NULL);
+	}
 
-/**
- * @brief Character transcoding context for `iconv`.
- *
- * @see iconv(3)
- */
-typedef struct {
-	StringEncoding to;
-	StringEncoding from;
-	char *in;
-	size_t length;
-	char *out;
-	size_t size;
-} Transcode;
+	return cd;
+}
 
 /**
- * @brief Transcodes input from one character encoding to another via `iconv`.
+ * @brief Transcodes input from one character encoding to another, natively where possible and
+ * via `iconv` otherwise.
  *
  * @param trans A Transcode struct.
  *
@@ -139,8 +975,11 @@ static size_t transcode(Transcode *trans) {
 	assert(trans->out);
 	assert(trans->size);
 
-	iconv_t cd = iconv_open(NameForStringEncoding(trans->to), NameForStringEncoding(trans->from));
-	assert(cd != (iconv_t ) -1);
+	if (isNativeEncoding(trans->to) && isNativeEncoding(trans->from)) {
+		return transcodeNative(trans);
+	}
+
+	iconv_t cd = transcodeDescriptor(trans->to, trans->from);
 
 	char *in = trans->in;
 	char *out = trans->out;
@@ -149,14 +988,22 @@ static size_t transcode(Transcode *trans) {
 	size_t outBytesRemaining = trans->size;
 
 	const size_t ret = iconv(cd, &in, &inBytesRemaining, &out, &outBytesRemaining);
-	assert(ret != (size_t ) -1);
-
-	int err = iconv_close(cd);
-	assert(err == 0);
+	if (ret == (size_t) -1) {
+		return (size_t) -1;
+	}
 
 	return trans->size - outBytesRemaining;
 }
 
+/**
+ * @fn size_t String::codePointCount(const String *self)
+ *
+ * @memberof String
+ */
+static size_t codePointCount(const String *self) {
+	return countCodePoints((const uint8_t *) self->chars, self->length);
+}
+
 /**
  * @fn Order String::compareTo(const String *self, const String *other, const Range range)
  *
@@ -190,25 +1037,49 @@ static Array *componentsSeparatedByCharacters(const String *self, const char *ch
 
 	MutableArray *components = alloc(MutableArray, init);
 
+	Data *buffer = NULL;
+
+	const size_t length = strlen(chars);
+
 	Range search = { 0, self->length };
-	Range result = $(self, rangeOfCharacters, chars, search);
+	const char *result;
+
+	do {
+		result = searchCharacters(self->chars + search.location, search.length, chars, length, StringSearchOptionNone);
+		if (result) {
+			search.length = (int) (result - self->chars) - search.location;
+		}
+
+		String *component;
+		if (search.length < STRING_INLINE_CAPACITY) {
+			component = $(self, substring, search);
+		} else {
+			if (buffer == NULL) {
+
+				char *mem = malloc(self->length + 1);
+				assert(mem);
 
-	while (result.length) {
-		search.length = result.location - search.location;
+				memcpy(mem, self->chars, self->length + 1);
+
+				buffer = $$(Data, dataWithMemory, mem, self->length + 1);
+			}
+
+			char *mem = (char *) buffer->bytes;
+			mem[search.location + search.length] = '\0';
+
+			component = initWithView((String *) _alloc(&_String), (Object *) buffer, mem + search.location, search.length);
+		}
 
-		String *component = $(self, substring, search);
 		$(components, addObject, component);
 		release(component);
 
-		search.location = result.location + result.length;
-		search.length = self->length - search.location;
-
-		result = $(self, rangeOfCharacters, chars, search);
-	}
+		if (result) {
+			search.location += search.length + length;
+			search.length = self->length - search.location;
+		}
+	} while (result);
 
-	String *component = $(self, substring, search);
-	$(components, addObject, component);
-	release(component);
+	release(buffer);
 
 	return (Array *) components;
 }
@@ -232,21 +1103,28 @@ static Array *componentsSeparatedByString(const String *self, const String *stri
  */
 static Data *getData(const String *self, StringEncoding encoding) {
 
+	const size_t size = (self->length + 1) * sizeof(uint32_t);
+
 	Transcode trans = {
 		.to = encoding,
 		.from = STRING_ENCODING_UTF8,
 		.in = self->chars,
 		.length = self->length,
-		.out = calloc(self->length, sizeof(Unicode) / sizeof(char)),
-		.size = self->length * sizeof(Unicode)
+		.out = calloc(size, sizeof(char)),
+		.size = size
 	};
 
 	assert(trans.out);
 
-	const size_t size = transcode(&trans);
-	assert(size <= trans.size);
+	const size_t length = transcode(&trans);
+	assert(length <= trans.size);
 
-	return $$(Data, dataWithMemory, trans.out, size);
+	if (length && length < size) {
+		trans.out = realloc(trans.out, length);
+		assert(trans.out);
+	}
+
+	return $$(Data, dataWithMemory, trans.out, length);
 }
 
 /**
@@ -288,18 +1166,29 @@ static String *initWithBytes(String *self, const uint8_t *bytes, size_t length,
 
 	if (bytes) {
 
+		size_t capacity = length * sizeof(Unicode) + 1;
+		if (encoding == STRING_ENCODING_UTF8 || encoding == STRING_ENCODING_ASCII) {
+			capacity = length + 1;
+		}
+
 		Transcode trans = {
 			.to = STRING_ENCODING_UTF8,
 			.from = encoding,
 			.in = (char *) bytes,
 			.length = length,
-			.out = calloc(length * sizeof(Unicode) + 1, sizeof(char)),
-			.size = length * sizeof(Unicode) + 1
+			.out = calloc(capacity, sizeof(char)),
+			.size = capacity
 		};
 
 		assert(trans.out);
 
 		const size_t size = transcode(&trans);
+		if (size == (size_t) -1) {
+			free(trans.out);
+			release(self);
+			return NULL;
+		}
+
 		assert(size < trans.size);
 
 		ident mem = realloc(trans.out, size + 1);
@@ -320,10 +1209,15 @@ static String *initWithCharacters(String *self, const char *chars) {
 
 	if (chars) {
 
-		ident mem = strdup(chars);
+		const size_t length = strlen(chars);
+		if (length < STRING_INLINE_CAPACITY) {
+			return initWithInlineCharacters(self, chars, length);
+		}
+
+		ident mem = malloc(length + 1);
 		assert(mem);
 
-		size_t length = strlen(chars);
+		memcpy(mem, chars, length + 1);
 
 		return $(self, initWithMemory, mem, length);
 	}
@@ -389,7 +1283,18 @@ static String *initWithMemory(String *self, const ident mem, size_t length) {
 	if (self) {
 
 		if (mem) {
-			self->chars = (char *) mem;
+			if (length < STRING_INLINE_CAPACITY) {
+
+				memcpy(self->inlineChars, mem, length);
+				self->inlineChars[length] = '\0';
+
+				free(mem);
+
+				self->chars = self->inlineChars;
+			} else {
+				self->chars = (char *) mem;
+			}
+
 			self->length = length;
 		}
 	}
@@ -408,9 +1313,22 @@ static String *initWithVaList(String *self, const char *fmt, va_list args) {
 	if (self) {
 
 		if (fmt) {
-			const int len = vasprintf(&self->chars, fmt, args);
+
+			va_list copy;
+			va_copy(copy, args);
+
+			int len = vsnprintf(self->inlineChars, sizeof(self->inlineChars), fmt, copy);
 			assert(len >= 0);
 
+			va_end(copy);
+
+			if (len < STRING_INLINE_CAPACITY) {
+				self->chars = self->inlineChars;
+			} else {
+				len = vasprintf(&self->chars, fmt, args);
+				assert(len >= 0);
+			}
+
 			self->length = len;
 		}
 	}
@@ -419,39 +1337,161 @@ static String *initWithVaList(String *self, const char *fmt, va_list args) {
 }
 
 /**
- * @fn String *String::lowercaseString(const String *self)
+ * @fn String *String::intern(const String *self)
  *
  * @memberof String
  */
-static String *lowercaseString(const String *self) {
-	return $(self, lowercaseStringWithLocale, NULL);
+static String *intern(const String *self) {
+
+	if (self->isInterned) {
+		return (String *) self;
+	}
+
+	return internCharacters(self->chars, self->length, self);
 }
 
 /**
- * @fn String *String::lowercaseStringWithLocale(const String *self, const Locale *locale)
+ * @fn String *String::internedStringWithCharacters(const char *chars, size_t length)
  *
  * @memberof String
  */
-static String *lowercaseStringWithLocale(const String *self, const Locale *locale) {
+static String *internedStringWithCharacters(const char *chars, size_t length) {
 
-	Data *data = $(self, getData, STRING_ENCODING_WCHAR);
-	assert(data);
+	assert(chars);
+
+	return internCharacters(chars, length, NULL);
+}
 
-	const size_t codepoints = data->length / sizeof(Unicode);
-	Unicode *unicode = (Unicode *) data->bytes;
+/**
+ * @return True if the `length` bytes at `chars` are all ASCII.
+ */
+static _Bool isASCII(const char *chars, size_t length) {
 
-	for (size_t i = 0; i < codepoints; i++, unicode++) {
-		if (locale) {
-			*unicode = towlower_l(*unicode, locale->locale);
-		} else {
-			*unicode = towlower(*unicode);
+	const uint8_t *bytes = (const uint8_t *) chars;
+
+	size_t i = 0;
+	ByteVector any = { 0 };
+
+	for (; i + BYTE_VECTOR_LANES <= length; i += BYTE_VECTOR_LANES) {
+		any |= loadByteVector(bytes + i);
+	}
+
+	uint8_t high = 0;
+	for (size_t j = 0; j < BYTE_VECTOR_LANES; j++) {
+		high |= any[j];
+	}
+
+	for (; i < length; i++) {
+		high |= bytes[i];
+	}
+
+	return (high & 0x80) == 0;
+}
+
+/**
+ * @brief Maps the ASCII letters of the `length` bytes at `in` to lowercase, or to uppercase if
+ * `upper`, writing them to `out`.
+ */
+static void mapASCIICase(const char *in, char *out, size_t length, _Bool upper) {
+
+	const uint8_t *src = (const uint8_t *) in;
+	uint8_t *dst = (uint8_t *) out;
+
+	const uint8_t from = upper ? 'a' : 'A';
+	const uint8_t to = upper ? 'z' : 'Z';
+
+	size_t i = 0;
+	for (; i + BYTE_VECTOR_LANES <= length; i += BYTE_VECTOR_LANES) {
+
+		const ByteVector vector = loadByteVector(src + i);
+		const ByteVector letters = (ByteVector) ((vector >= from) & (vector <= to));
+		const ByteVector mapped = vector ^ (letters & 0x20);
+
+		memcpy(dst + i, &mapped, sizeof(mapped));
+	}
+
+	for (; i < length; i++) {
+		dst[i] = src[i] >= from && src[i] <= to ? src[i] ^ 0x20 : src[i];
+	}
+}
+
+/**
+ * @return A new String with the characters of `self` mapped to lowercase, or to uppercase if
+ * `upper`, in `locale`.
+ *
+ * @remarks ASCII Strings in the default Locale are mapped a vector at a time. Others are decoded
+ * and encoded directly, and bytes that are not valid UTF-8 are copied unchanged.
+ */
+static String *mapCase(const String *self, const Locale *locale, _Bool upper) {
+
+	if (locale == NULL && isASCII(self->chars, self->length)) {
+
+		if (self->length < STRING_INLINE_CAPACITY) {
+
+			char chars[STRING_INLINE_CAPACITY];
+			mapASCIICase(self->chars, chars, self->length, upper);
+
+			return initWithInlineCharacters((String *) _alloc(&_String), chars, self->length);
 		}
+
+		char *mem = malloc(self->length + 1);
+		assert(mem);
+
+		mapASCIICase(self->chars, mem, self->length, upper);
+		mem[self->length] = '\0';
+
+		return $$(String, stringWithMemory, mem, self->length);
 	}
 
-	String *lowercase = $$(String, stringWithData, data, STRING_ENCODING_WCHAR);
+	char *mem = malloc(self->length * 2 + 1); // no mapping grows a character by more than half
+	assert(mem);
+
+	const uint8_t *in = (const uint8_t *) self->chars;
+	const uint8_t *end = in + self->length;
 
-	release(data);
-	return lowercase;
+	uint8_t *out = (uint8_t *) mem;
+
+	while (in < end) {
+
+		int32_t codepoint = decodeUTF8(&in, end);
+		if (codepoint < 0) {
+			*out++ = *in++;
+			continue;
+		}
+
+		if (codepoint <= WCHAR_MAX) {
+			if (locale) {
+				codepoint = upper ? towupper_l(codepoint, locale->locale) : towlower_l(codepoint, locale->locale);
+			} else {
+				codepoint = upper ? towupper(codepoint) : towlower(codepoint);
+			}
+		}
+
+		out += encodeUTF8(codepoint, out);
+	}
+
+	const size_t length = out - (uint8_t *) mem;
+	*out = '\0';
+
+	return $$(String, stringWithMemory, mem, length);
+}
+
+/**
+ * @fn String *String::lowercaseString(const String *self)
+ *
+ * @memberof String
+ */
+static String *lowercaseString(const String *self) {
+	return $(self, lowercaseStringWithLocale, NULL);
+}
+
+/**
+ * @fn String *String::lowercaseStringWithLocale(const String *self, const Locale *locale)
+ *
+ * @memberof String
+ */
+static String *lowercaseStringWithLocale(const String *self, const Locale *locale) {
+	return mapCase(self, locale, false);
 }
 
 /**
@@ -470,6 +1510,15 @@ static MutableString *mutableCopy(const String *self) {
  * @memberof String
  */
 static Range rangeOfCharacters(const String *self, const char *chars, const Range range) {
+	return $(self, rangeOfCharactersWithOptions, chars, range, StringSearchOptionNone);
+}
+
+/**
+ * @fn Range String::rangeOfCharactersWithOptions(const String *self, const char *chars, const Range range, StringSearchOptions options)
+ *
+ * @memberof String
+ */
+static Range rangeOfCharactersWithOptions(const String *self, const char *chars, const Range range, StringSearchOptions options) {
 
 	assert(chars);
 	assert(range.location > -1);
@@ -477,15 +1526,12 @@ static Range rangeOfCharacters(const String *self, const char *chars, const Rang
 	assert(range.location + range.length <= self->length);
 
 	Range match = { -1, 0 };
-	const size_t len = strlen(chars);
 
-	const char *str = self->chars + range.location;
-	for (size_t i = 0; i < range.length; i++, str++) {
-		if (strncmp(str, chars, len) == 0) {
-			match.location = range.location + i;
-			match.length = len;
-			break;
-		}
+	const size_t length = strlen(chars);
+	const char *str = searchCharacters(self->chars + range.location, range.length, chars, length, options);
+	if (str) {
+		match.location = (int) (str - self->chars);
+		match.length = (int) length;
 	}
 
 	return match;
@@ -497,10 +1543,30 @@ static Range rangeOfCharacters(const String *self, const char *chars, const Rang
  * @memberof String
  */
 static Range rangeOfString(const String *self, const String *string, const Range range) {
+	return $(self, rangeOfStringWithOptions, string, range, StringSearchOptionNone);
+}
+
+/**
+ * @fn Range String::rangeOfStringWithOptions(const String *self, const String *string, const Range range, StringSearchOptions options)
+ *
+ * @memberof String
+ */
+static Range rangeOfStringWithOptions(const String *self, const String *string, const Range range, StringSearchOptions options) {
 
 	assert(string);
+	assert(range.location > -1);
+	assert(range.length > -1);
+	assert(range.location + range.length <= self->length);
+
+	Range match = { -1, 0 };
 
-	return $(self, rangeOfCharacters, string->chars, range);
+	const char *str = searchCharacters(self->chars + range.location, range.length, string->chars, string->length, options);
+	if (str) {
+		match.location = (int) (str - self->chars);
+		match.length = (int) string->length;
+	}
+
+	return match;
 }
 
 /**
@@ -579,6 +1645,17 @@ static String *substring(const String *self, const Range range) {
 
 	assert(range.location + range.length <= self->length);
 
+	if (range.length < STRING_INLINE_CAPACITY) {
+		return initWithInlineCharacters((String *) _alloc(&_String), self->chars + range.location, range.length);
+	}
+
+	if (range.location + range.length == self->length && classof(self) == &_String) {
+
+		Object *backing = self->backing ?: (Object *) self;
+
+		return initWithView((String *) _alloc(&_String), backing, self->chars + range.location, range.length);
+	}
+
 	ident mem = calloc(range.length + 1, sizeof(char));
 	assert(mem);
 
@@ -602,25 +1679,7 @@ static String *uppercaseString(const String *self) {
  * @memberof String
  */
 static String *uppercaseStringWithLocale(const String *self, const Locale *locale) {
-
-	Data *data = $(self, getData, STRING_ENCODING_WCHAR);
-	assert(data);
-
-	const size_t codepoints = data->length / sizeof(Unicode);
-	Unicode *unicode = (Unicode *) data->bytes;
-
-	for (size_t i = 0; i < codepoints; i++, unicode++) {
-		if (locale) {
-			*unicode = towupper_l(*unicode, locale->locale);
-		} else {
-			*unicode = towupper(*unicode);
-		}
-	}
-
-	String *uppercase = $$(String, stringWithData, data, STRING_ENCODING_WCHAR);
-
-	release(data);
-	return uppercase;
+	return mapCase(self, locale, true);
 }
 
 /**
@@ -653,9 +1712,12 @@ static void initialize(Class *clazz) {
 	object->description = description;
 	object->hash = hash;
 	object->isEqual = isEqual;
+	object->sizeInBytes = sizeInBytes;
 
 	StringInterface *string = (StringInterface *) clazz->interface;
 
+	string->codePointCount = codePointCount;
+	string->compact = compact;
 	string->compareTo = compareTo;
 	string->componentsSeparatedByCharacters = componentsSeparatedByCharacters;
 	string->componentsSeparatedByString = componentsSeparatedByString;
@@ -669,11 +1731,15 @@ static void initialize(Class *clazz) {
 	string->initWithFormat = initWithFormat;
 	string->initWithMemory = initWithMemory;
 	string->initWithVaList = initWithVaList;
+	string->intern = intern;
+	string->internedStringWithCharacters = internedStringWithCharacters;
 	string->lowercaseString = lowercaseString;
 	string->lowercaseStringWithLocale = lowercaseStringWithLocale;
 	string->mutableCopy = mutableCopy;
 	string->rangeOfCharacters = rangeOfCharacters;
+	string->rangeOfCharactersWithOptions = rangeOfCharactersWithOptions;
 	string->rangeOfString = rangeOfString;
+	string->rangeOfStringWithOptions = rangeOfStringWithOptions;
 	string->stringWithBytes = stringWithBytes;
 	string->stringWithCharacters = stringWithCharacters;
 	string->stringWithContentsOfFile = stringWithContentsOfFile;
@@ -686,6 +1752,20 @@ static void initialize(Class *clazz) {
 	string->writeToFile = writeToFile;
 }
 
+/**
+ * @see Class::destroy(Class *)
+ */
+static void destroy(Class *clazz) {
+
+	for (size_t i = 0; i < _internTable.capacity; i++) {
+		if (_internTable.entries[i].occupied) {
+			release(_internTable.entries[i].value);
+		}
+	}
+
+	InternTableFree(&_internTable);
+}
+
 Class _String = {
 	.name = "String",
 	.superclass = &_Object,
@@ -693,10 +1773,18 @@ Class _String = {
 	.interfaceOffset = offsetof(String, interface),
 	.interfaceSize = sizeof(StringInterface),
 	.initialize = initialize,
+	.destroy = destroy,
 };
 
 #undef _Class
 
+_Bool IsValidUTF8(const uint8_t *bytes, size_t length) {
+
+	assert(bytes || length == 0);
+
+	return validateUTF8(bytes, length);
+}
+
 const char *NameForStringEncoding(StringEncoding encoding) {
 
 	switch (encoding) {
@@ -755,3 +1843,27 @@ String *str(const char *fmt, ...) {
 
 	return string;
 }
+
+_Bool StringCodePointIteratorNext(StringCodePointIterator *iterator, Unicode *codePoint) {
+
+	const String *string = iterator->string;
+
+	if (iterator->index < string->length) {
+
+		const uint8_t *in = (const uint8_t *) string->chars + iterator->index;
+		const uint8_t *end = (const uint8_t *) string->chars + string->length;
+
+		int32_t decoded = decodeUTF8(&in, end);
+		if (decoded < 0) {
+			decoded = 0xfffd;
+			in++;
+		}
+
+		*codePoint = decoded;
+		iterator->index = in - (const uint8_t *) string->chars;
+
+		return true;
+	}
+
+	return false;
+}
@@ -56,6 +56,37 @@ typedef enum {
 	STRING_ENCODING_WCHAR,
 } StringEncoding;
 
+/**
+ * @brief Options for searching Strings.
+ */
+typedef enum {
+
+	/**
+	 * @brief Find the first occurrence, comparing bytes exactly.
+	 */
+	StringSearchOptionNone = 0,
+
+	/**
+	 * @brief Only match at the start of the range, or at its end when searching backwards.
+	 */
+	StringSearchOptionAnchored = 0x1,
+
+	/**
+	 * @brief Find the last occurrence rather than the first.
+	 */
+	StringSearchOptionBackwards = 0x2,
+
+	/**
+	 * @brief Compare ASCII letters without regard to case. Other bytes are compared exactly.
+	 */
+	StringSearchOptionCaseInsensitive = 0x4,
+} StringSearchOptions;
+
+/**
+ * @brief The size of the inline character buffer of a String, including the null terminator.
+ */
+#define STRING_INLINE_CAPACITY 24
+
 typedef struct StringInterface StringInterface;
 
 /**
@@ -94,6 +125,27 @@ struct String {
 	 * @brief The length of the String in bytes.
 	 */
 	size_t length;
+
+	/**
+	 * @brief The Object owning the buffer that `chars` points into, if this String is a view of
+	 * a buffer it shares with other Strings.
+	 *
+	 * @private
+	 */
+	Object *backing;
+
+	/**
+	 * @brief True if this String is the canonical instance returned by String::intern.
+	 */
+	_Bool isInterned;
+
+	/**
+	 * @brief Strings shorter than `STRING_INLINE_CAPACITY` bytes are stored here, and `chars`
+	 * points to this buffer rather than to a separate allocation.
+	 *
+	 * @private
+	 */
+	char inlineChars[STRING_INLINE_CAPACITY];
 };
 
 typedef struct MutableString MutableString;
@@ -108,6 +160,27 @@ struct StringInterface {
 	 */
 	ObjectInterface objectInterface;
 
+	/**
+	 * @fn size_t String::codePointCount(const String *self)
+	 *
+	 * @return The count of Unicode code points in this String.
+	 *
+	 * @memberof String
+	 */
+	size_t (*codePointCount)(const String *self);
+
+	/**
+	 * @fn void String::compact(String *self)
+	 *
+	 * @brief Copies the characters of this String if it shares a buffer with other Strings.
+	 *
+	 * @remarks Substrings and components may keep the characters of a much larger String alive.
+	 * Compact those that outlive it.
+	 *
+	 * @memberof String
+	 */
+	void (*compact)(String *self);
+
 	/**
 	 * @fn Order String::compareTo(const String *self, const String *other, const Range range)
 	 *
@@ -131,6 +204,8 @@ struct StringInterface {
 	 *
 	 * @return An Array of substrings that were separated by `chars`.
 	 *
+	 * @remarks The components share a single copy of this String's characters.
+	 *
 	 * @memberof String
 	 */
 	Array *(*componentsSeparatedByCharacters)(const String *self, const char *chars);
@@ -196,7 +271,10 @@ struct StringInterface {
 	 * @param length The length of `bytes` to decode.
 	 * @param encoding The character encoding.
 	 *
-	 * @return The initialized String, or `NULL` on error.
+	 * @return The initialized String, or `NULL` if `bytes` are not valid in `encoding`.
+	 *
+	 * @remarks UTF-8 input is validated at vector speed for runs of ASCII, so that untrusted
+	 * input may be decoded safely.
 	 *
 	 * @memberof String
 	 */
@@ -286,6 +364,38 @@ struct StringInterface {
 	 */
 	String *(*initWithVaList)(String *string, const char *fmt, va_list args);
 
+	/**
+	 * @fn String *String::intern(const String *self)
+	 *
+	 * @brief Returns the canonical instance of Strings with the characters of this String.
+	 *
+	 * @return The interned String, which may be this String.
+	 *
+	 * @remarks Interned Strings are immutable and remain valid until the String class is
+	 * destroyed. The caller does not own the returned String, and should retain it to store it,
+	 * as with any other Object. Interned Strings with different characters are never equal, so
+	 * comparing them costs only a pointer comparison.
+	 *
+	 * @memberof String
+	 */
+	String *(*intern)(const String *self);
+
+	/**
+	 * @fn String *String::internedStringWithCharacters(const char *chars, size_t length)
+	 *
+	 * @brief Returns the interned String for the specified UTF-8 encoded characters.
+	 *
+	 * @param chars The characters, which need not be null-terminated.
+	 * @param length The length of `chars` in bytes.
+	 *
+	 * @return The interned String, which the caller does not own.
+	 *
+	 * @see String::intern(const String *)
+	 *
+	 * @memberof String
+	 */
+	String *(*internedStringWithCharacters)(const char *chars, size_t length);
+
 	/**
 	 * @fn String *String::lowercaseString(const String *self)
 	 *
@@ -323,12 +433,29 @@ struct StringInterface {
 	 * @param chars The characters to search for.
 	 * @param range The range in which to search.
 	 *
-	 * @return A Range specifying the first occurrence of `chars` in this String.
+	 * @return A Range specifying the first occurrence of `chars` in this String, or `{ -1, 0 }` if
+	 * `chars` does not occur within `range`.
 	 *
 	 * @memberof String
 	 */
 	Range (*rangeOfCharacters)(const String *self, const char *chars, const Range range);
 
+	/**
+	 * @fn Range String::rangeOfCharactersWithOptions(const String *self, const char *chars, const Range range, StringSearchOptions options)
+	 *
+	 * @brief Finds and returns an occurrence of `chars` in this String.
+	 *
+	 * @param chars The characters to search for.
+	 * @param range The range in which to search.
+	 * @param options The StringSearchOptions.
+	 *
+	 * @return A Range specifying the occurrence of `chars` in this String, or `{ -1, 0 }` if
+	 * `chars` does not occur within `range`.
+	 *
+	 * @memberof String
+	 */
+	Range (*rangeOfCharactersWithOptions)(const String *self, const char *chars, const Range range, StringSearchOptions options);
+
 	/**
 	 * @fn Range String::rangeOfString(const String *self, const String *string, const Range range)
 	 *
@@ -337,12 +464,29 @@ struct StringInterface {
 	 * @param string The String to search for.
 	 * @param range The range in which to search.
 	 *
-	 * @return A Range specifying the first occurrence of `string` in this String.
+	 * @return A Range specifying the first occurrence of `string` in this String, or `{ -1, 0 }`
+	 * if `string` does not occur within `range`.
 	 *
 	 * @memberof String
 	 */
 	Range (*rangeOfString)(const String *self, const String *string, const Range range);
 
+	/**
+	 * @fn Range String::rangeOfStringWithOptions(const String *self, const String *string, const Range range, StringSearchOptions options)
+	 *
+	 * @brief Finds and returns an occurrence of `string` in this String.
+	 *
+	 * @param string The String to search for.
+	 * @param range The range in which to search.
+	 * @param options The StringSearchOptions.
+	 *
+	 * @return A Range specifying the occurrence of `string` in this String, or `{ -1, 0 }` if
+	 * `string` does not occur within `range`.
+	 *
+	 * @memberof String
+	 */
+	Range (*rangeOfStringWithOptions)(const String *self, const String *string, const Range range, StringSearchOptions options);
+
 	/**
 	 * @static
 	 *
@@ -447,6 +591,9 @@ struct StringInterface {
 	 *
 	 * @return The new String.
 	 *
+	 * @remarks Substrings extending to the end of an immutable String reference its characters
+	 * rather than copying them. Use String::compact to release the parent.
+	 *
 	 * @memberof String
 	 */
 	String *(*substring)(const String *self, const Range range);
@@ -491,6 +638,70 @@ struct StringInterface {
  */
 extern Class _String;
 
+/**
+ * @brief A stack-allocated cursor over the code points of a String.
+ *
+ * @remarks Iterators do not retain the String, and must not outlive it.
+ */
+typedef struct {
+
+	/**
+	 * @brief The String.
+	 */
+	const String *string;
+
+	/**
+	 * @brief The byte index of the next code point.
+	 */
+	size_t index;
+} StringCodePointIterator;
+
+/**
+ * @return A StringCodePointIterator positioned before the first code point of `string`.
+ *
+ * @relates String
+ */
+static inline StringCodePointIterator MakeStringCodePointIterator(const String *string) {
+	return (StringCodePointIterator) { .string = string, .index = 0 };
+}
+
+/**
+ * @brief Advances `iterator` to the next code point.
+ *
+ * @param iterator The StringCodePointIterator.
+ * @param codePoint Receives the next code point, or U+FFFD for each byte that is not valid UTF-8.
+ *
+ * @return True if a code point was available, false if `iterator` is exhausted.
+ *
+ * @relates String
+ */
+_Bool StringCodePointIteratorNext(StringCodePointIterator *iterator, Unicode *codePoint);
+
+/**
+ * @brief Iterates the code points of `string`, assigning each to `codePoint`.
+ *
+ * @code
+ * Unicode c;
+ * StringForEachCodePoint(c, string) {
+ *     printf("U+%04X\n", c);
+ * }
+ * @endcode
+ *
+ * @relates String
+ */
+#define StringForEachCodePoint(codePoint, string) \
+	for (StringCodePointIterator _iterator = MakeStringCodePointIterator(string); StringCodePointIteratorNext(&_iterator, &(codePoint)); )
+
+/**
+ * @param bytes The bytes.
+ * @param length The length of `bytes`.
+ *
+ * @return True if `bytes` are valid UTF-8: shortest form encodings of Unicode scalar values.
+ *
+ * @relates String
+ */
+_Bool IsValidUTF8(const uint8_t *bytes, size_t length);
+
 /**
  * @param encoding A StringEncoding.
  *
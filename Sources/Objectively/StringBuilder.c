@@ -0,0 +1,483 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/uio.h>
+
+#include <Objectively/StringBuilder.h>
+
+#ifndef IOV_MAX
+ #define IOV_MAX 1024
+#endif
+
+/**
+ * @brief The maximum count of chunks gathered by each call to `writev`.
+ */
+#define WRITEV_CHUNKS min(IOV_MAX, 64)
+
+#define _Class _StringBuilder
+
+/**
+ * @brief A chunk of a StringBuilder.
+ */
+typedef struct {
+
+	/**
+	 * @brief The bytes.
+	 */
+	uint8_t *bytes;
+
+	/**
+	 * @brief The length of the bytes.
+	 */
+	size_t length;
+
+	/**
+	 * @brief The capacity of the bytes, or `0` if they are adopted, and may not be written.
+	 */
+	size_t capacity;
+
+	/**
+	 * @brief The offset of the bytes in the StringBuilder.
+	 */
+	size_t offset;
+
+	/**
+	 * @brief The Object owning adopted bytes, or `NULL`.
+	 */
+	Object *owner;
+} Chunk;
+
+/**
+ * @return The last chunk of `self`, if it may be appended to, or `NULL`.
+ */
+static Chunk *writableChunk(const StringBuilder *self) {
+
+	if (self->locals.count) {
+
+		Chunk *chunk = (Chunk *) self->locals.chunks + self->locals.count - 1;
+		if (chunk->length < chunk->capacity) {
+			return chunk;
+		}
+	}
+
+	return NULL;
+}
+
+/**
+ * @brief Adds a chunk of `capacity` bytes, or an empty chunk for adoption if `capacity` is `0`.
+ *
+ * @return The new chunk.
+ */
+static Chunk *addChunk(StringBuilder *self, size_t capacity) {
+
+	if (self->locals.count == self->locals.capacity) {
+
+		self->locals.capacity = max(self->locals.capacity * 2, 8);
+
+		self->locals.chunks = realloc(self->locals.chunks, self->locals.capacity * sizeof(Chunk));
+		assert(self->locals.chunks);
+	}
+
+	Chunk *chunk = (Chunk *) self->locals.chunks + self->locals.count++;
+
+	*chunk = (Chunk) {
+		.capacity = capacity,
+		.offset = self->length
+	};
+
+	if (capacity) {
+		chunk->bytes = malloc(capacity);
+		assert(chunk->bytes);
+	}
+
+	return chunk;
+}
+
+/**
+ * @brief Appends `length` bytes at `bytes` owned by `owner` to `self`, retaining `owner` rather
+ * than copying them if it is immutable and the bytes are long enough to be worth a chunk.
+ */
+static void adoptBytes(StringBuilder *self, const uint8_t *bytes, size_t length, const Object *owner, _Bool immutable) {
+
+	if (immutable && length >= STRING_BUILDER_ADOPTION_MIN) {
+
+		Chunk *chunk = addChunk(self, 0);
+
+		chunk->bytes = (uint8_t *) bytes;
+		chunk->length = length;
+		chunk->owner = retain((Object *) owner);
+
+		self->length += length;
+	} else {
+		$(self, appendBytes, bytes, length);
+	}
+}
+
+#pragma mark - Object
+
+/**
+ * @see Object::dealloc(Object *)
+ */
+static void dealloc(Object *self) {
+
+	StringBuilder *this = (StringBuilder *) self;
+
+	Chunk *chunks = this->locals.chunks;
+	for (size_t i = 0; i < this->locals.count; i++) {
+		if (chunks[i].owner) {
+			release(chunks[i].owner);
+		} else {
+			free(chunks[i].bytes);
+		}
+	}
+
+	free(chunks);
+
+	super(Object, self, dealloc);
+}
+
+/**
+ * @see Object::deepSizeInBytes(const Object *)
+ */
+static size_t deepSizeInBytes(const Object *self) {
+
+	const StringBuilder *this = (StringBuilder *) self;
+
+	size_t size = $(self, sizeInBytes);
+
+	const Chunk *chunks = this->locals.chunks;
+	for (size_t i = 0; i < this->locals.count; i++) {
+		if (chunks[i].owner) {
+			size += $(chunks[i].owner, deepSizeInBytes);
+		}
+	}
+
+	return size;
+}
+
+/**
+ * @see Object::description(const Object *)
+ */
+static String *description(const Object *self) {
+
+	return $((StringBuilder *) self, string);
+}
+
+/**
+ * @see Object::sizeInBytes(const Object *)
+ */
+static size_t sizeInBytes(const Object *self) {
+
+	const StringBuilder *this = (StringBuilder *) self;
+
+	size_t size = super(Object, self, sizeInBytes) + this->locals.capacity * sizeof(Chunk);
+
+	const Chunk *chunks = this->locals.chunks;
+	for (size_t i = 0; i < this->locals.count; i++) {
+		size += chunks[i].capacity;
+	}
+
+	return size;
+}
+
+#pragma mark - StringBuilder
+
+/**
+ * @fn void StringBuilder::appendBytes(StringBuilder *self, const uint8_t *bytes, size_t length)
+ *
+ * @memberof StringBuilder
+ */
+static void appendBytes(StringBuilder *self, const uint8_t *bytes, size_t length) {
+
+	while (length) {
+
+		Chunk *chunk = writableChunk(self);
+		if (chunk == NULL) {
+			chunk = addChunk(self, STRING_BUILDER_CHUNK_SIZE);
+		}
+
+		const size_t count = min(length, chunk->capacity - chunk->length);
+
+		memcpy(chunk->bytes + chunk->length, bytes, count);
+
+		chunk->length += count;
+		self->length += count;
+
+		bytes += count;
+		length -= count;
+	}
+}
+
+/**
+ * @fn void StringBuilder::appendCharacters(StringBuilder *self, const char *chars)
+ *
+ * @memberof StringBuilder
+ */
+static void appendCharacters(StringBuilder *self, const char *chars) {
+
+	assert(chars);
+
+	$(self, appendBytes, (const uint8_t *) chars, strlen(chars));
+}
+
+/**
+ * @fn void StringBuilder::appendData(StringBuilder *self, const Data *data)
+ *
+ * @memberof StringBuilder
+ */
+static void appendData(StringBuilder *self, const Data *data) {
+
+	assert(data);
+
+	adoptBytes(self, data->bytes, data->length, (Object *) data, classof(data) == &_Data);
+}
+
+/**
+ * @fn void StringBuilder::appendFormat(StringBuilder *self, const char *fmt, ...)
+ *
+ * @memberof StringBuilder
+ */
+static void appendFormat(StringBuilder *self, const char *fmt, ...) {
+
+	va_list args;
+	va_start(args, fmt);
+
+	$(self, appendVaList, fmt, args);
+
+	va_end(args);
+}
+
+/**
+ * @fn void StringBuilder::appendString(StringBuilder *self, const String *string)
+ *
+ * @memberof StringBuilder
+ */
+static void appendString(StringBuilder *self, const String *string) {
+
+	assert(string);
+
+	const uint8_t *bytes = (const uint8_t *) string->chars;
+
+	adoptBytes(self, bytes, string->length, (Object *) string, classof(string) == &_String);
+}
+
+/**
+ * @fn void StringBuilder::appendVaList(StringBuilder *self, const char *fmt, va_list args)
+ *
+ * @memberof StringBuilder
+ */
+static void appendVaList(StringBuilder *self, const char *fmt, va_list args) {
+
+	va_list copy;
+	va_copy(copy, args);
+
+	Chunk *chunk = writableChunk(self);
+
+	const size_t spare = chunk ? chunk->capacity - chunk->length : 0;
+	char *out = chunk ? (char *) chunk->bytes + chunk->length : NULL;
+
+	const int length = vsnprintf(out, spare, fmt, args);
+	assert(length >= 0);
+
+	if (length && (size_t) length >= spare) {
+
+		chunk = addChunk(self, max((size_t) length + 1, STRING_BUILDER_CHUNK_SIZE));
+
+		const int written = vsnprintf((char *) chunk->bytes, chunk->capacity, fmt, copy);
+		assert(written == length);
+	}
+
+	if (chunk) {
+		chunk->length += length;
+		self->length += length;
+	}
+
+	va_end(copy);
+}
+
+/**
+ * @fn size_t StringBuilder::getBytes(const StringBuilder *self, uint8_t *bytes, size_t offset, size_t length)
+ *
+ * @memberof StringBuilder
+ */
+static size_t getBytes(const StringBuilder *self, uint8_t *bytes, size_t offset, size_t length) {
+
+	if (offset >= self->length) {
+		return 0;
+	}
+
+	const Chunk *chunks = self->locals.chunks;
+
+	size_t low = 0, high = self->locals.count - 1;
+	while (low < high) {
+		const size_t mid = (low + high + 1) / 2;
+		if (chunks[mid].offset <= offset) {
+			low = mid;
+		} else {
+			high = mid - 1;
+		}
+	}
+
+	size_t count = 0;
+
+	for (size_t i = low; i < self->locals.count && count < length; i++) {
+
+		const size_t start = offset + count - chunks[i].offset;
+		const size_t n = min(length - count, chunks[i].length - start);
+
+		memcpy(bytes + count, chunks[i].bytes + start, n);
+		count += n;
+	}
+
+	return count;
+}
+
+/**
+ * @fn StringBuilder *StringBuilder::init(StringBuilder *self)
+ *
+ * @memberof StringBuilder
+ */
+static StringBuilder *init(StringBuilder *self) {
+
+	return (StringBuilder *) super(Object, self, init);
+}
+
+/**
+ * @fn String *StringBuilder::string(const StringBuilder *self)
+ *
+ * @memberof StringBuilder
+ */
+static String *string(const StringBuilder *self) {
+
+	char *mem = malloc(self->length + 1);
+	assert(mem);
+
+	const size_t length = $(self, getBytes, (uint8_t *) mem, 0, self->length);
+	assert(length == self->length);
+
+	mem[length] = '\0';
+
+	return $$(String, stringWithMemory, mem, length);
+}
+
+/**
+ * @fn _Bool StringBuilder::writeToFileDescriptor(const StringBuilder *self, int fd)
+ *
+ * @memberof StringBuilder
+ */
+static _Bool writeToFileDescriptor(const StringBuilder *self, int fd) {
+
+	const Chunk *chunks = self->locals.chunks;
+
+	size_t i = 0, written = 0;
+
+	while (true) {
+
+		while (i < self->locals.count && written == chunks[i].length) {
+			i++;
+			written = 0;
+		}
+
+		if (i == self->locals.count) {
+			break;
+		}
+
+		struct iovec iov[WRITEV_CHUNKS];
+		int count = 0;
+
+		for (size_t j = i; j < self->locals.count && count < (int) lengthof(iov); j++) {
+			const size_t skip = j == i ? written : 0;
+
+			iov[count].iov_base = chunks[j].bytes + skip;
+			iov[count].iov_len = chunks[j].length - skip;
+			count++;
+		}
+
+		ssize_t n = writev(fd, iov, count);
+		if (n == -1) {
+			if (errno == EINTR) {
+				continue;
+			}
+			return false;
+		}
+
+		while (n > 0) {
+			const size_t remaining = chunks[i].length - written;
+			if ((size_t) n >= remaining) {
+				n -= remaining;
+				i++;
+				written = 0;
+			} else {
+				written += n;
+				n = 0;
+			}
+		}
+	}
+
+	return true;
+}
+
+#pragma mark - Class lifecycle
+
+/**
+ * @see Class::initialize(Class *)
+ */
+static void initialize(Class *clazz) {
+
+	ObjectInterface *object = (ObjectInterface *) clazz->interface;
+
+	object->dealloc = dealloc;
+	object->deepSizeInBytes = deepSizeInBytes;
+	object->description = description;
+	object->sizeInBytes = sizeInBytes;
+
+	StringBuilderInterface *builder = (StringBuilderInterface *) clazz->interface;
+
+	builder->appendBytes = appendBytes;
+	builder->appendCharacters = appendCharacters;
+	builder->appendData = appendData;
+	builder->appendFormat = appendFormat;
+	builder->appendString = appendString;
+	builder->appendVaList = appendVaList;
+	builder->getBytes = getBytes;
+	builder->init = init;
+	builder->string = string;
+	builder->writeToFileDescriptor = writeToFileDescriptor;
+}
+
+Class _StringBuilder = {
+	.name = "StringBuilder",
+	.superclass = &_Object,
+	.instanceSize = sizeof(StringBuilder),
+	.interfaceOffset = offsetof(StringBuilder, interface),
+	.interfaceSize = sizeof(StringBuilderInterface),
+	.initialize = initialize,
+};
+
+#undef _Class
@@ -0,0 +1,247 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#pragma once
+
+#include <stdarg.h>
+
+#include <Objectively/Data.h>
+#include <Objectively/String.h>
+
+/**
+ * @file
+ *
+ * @brief Chunked builders for assembling large Strings.
+ */
+
+/**
+ * @brief The size of the chunks that a StringBuilder appends into, in bytes.
+ */
+#define STRING_BUILDER_CHUNK_SIZE 8192
+
+/**
+ * @brief Strings and Data at least this long are adopted by a StringBuilder, rather than copied.
+ */
+#define STRING_BUILDER_ADOPTION_MIN 256
+
+typedef struct StringBuilder StringBuilder;
+typedef struct StringBuilderInterface StringBuilderInterface;
+
+/**
+ * @brief Chunked builders for assembling large Strings.
+ *
+ * @details Unlike MutableString, a StringBuilder never moves the bytes appended to it. It
+ * appends into a list of fixed-size chunks, so that growing it never copies what it already
+ * holds, and it adopts the buffers of immutable Strings and Data by retaining them, rather than
+ * copying them. Its contents may be flattened into a String with a single copy, or written to a
+ * file descriptor or uploaded without ever being flattened.
+ *
+ * @extends Object
+ *
+ * @ingroup ByteStreams
+ */
+struct StringBuilder {
+
+	/**
+	 * @brief The parent.
+	 *
+	 * @private
+	 */
+	Object object;
+
+	/**
+	 * @brief The typed interface.
+	 *
+	 * @private
+	 */
+	StringBuilderInterface *interface;
+
+	/**
+	 * @private
+	 */
+	struct {
+
+		/**
+		 * @brief The chunks.
+		 */
+		ident chunks;
+
+		/**
+		 * @brief The count of chunks.
+		 */
+		size_t count;
+
+		/**
+		 * @brief The capacity of `chunks`.
+		 */
+		size_t capacity;
+
+	} locals;
+
+	/**
+	 * @brief The length of the contents, in bytes.
+	 */
+	size_t length;
+};
+
+/**
+ * @brief The StringBuilder interface.
+ */
+struct StringBuilderInterface {
+
+	/**
+	 * @brief The parent interface.
+	 */
+	ObjectInterface objectInterface;
+
+	/**
+	 * @fn void StringBuilder::appendBytes(StringBuilder *self, const uint8_t *bytes, size_t length)
+	 *
+	 * @brief Appends a copy of the specified bytes to this StringBuilder.
+	 *
+	 * @param bytes The UTF-8 encoded bytes.
+	 * @param length The length of `bytes`.
+	 *
+	 * @memberof StringBuilder
+	 */
+	void (*appendBytes)(StringBuilder *self, const uint8_t *bytes, size_t length);
+
+	/**
+	 * @fn void StringBuilder::appendCharacters(StringBuilder *self, const char *chars)
+	 *
+	 * @brief Appends a copy of the specified characters to this StringBuilder.
+	 *
+	 * @param chars The null-terminated, UTF-8 encoded characters.
+	 *
+	 * @memberof StringBuilder
+	 */
+	void (*appendCharacters)(StringBuilder *self, const char *chars);
+
+	/**
+	 * @fn void StringBuilder::appendData(StringBuilder *self, const Data *data)
+	 *
+	 * @brief Appends the specified Data to this StringBuilder.
+	 *
+	 * @param data The UTF-8 encoded Data.
+	 *
+	 * @remarks Immutable Data of at least `STRING_BUILDER_ADOPTION_MIN` bytes is retained rather
+	 * than copied.
+	 *
+	 * @memberof StringBuilder
+	 */
+	void (*appendData)(StringBuilder *self, const Data *data);
+
+	/**
+	 * @fn void StringBuilder::appendFormat(StringBuilder *self, const char *fmt, ...)
+	 *
+	 * @brief Appends the specified formatted string to this StringBuilder.
+	 *
+	 * @param fmt The format string.
+	 *
+	 * @memberof StringBuilder
+	 */
+	void (*appendFormat)(StringBuilder *self, const char *fmt, ...);
+
+	/**
+	 * @fn void StringBuilder::appendString(StringBuilder *self, const String *string)
+	 *
+	 * @brief Appends the specified String to this StringBuilder.
+	 *
+	 * @param string The String.
+	 *
+	 * @remarks Immutable Strings of at least `STRING_BUILDER_ADOPTION_MIN` bytes are retained
+	 * rather than copied.
+	 *
+	 * @memberof StringBuilder
+	 */
+	void (*appendString)(StringBuilder *self, const String *string);
+
+	/**
+	 * @fn void StringBuilder::appendVaList(StringBuilder *self, const char *fmt, va_list args)
+	 *
+	 * @brief Appends the specified format string to this StringBuilder.
+	 *
+	 * @param fmt The format string.
+	 * @param args The format arguments.
+	 *
+	 * @memberof StringBuilder
+	 */
+	void (*appendVaList)(StringBuilder *self, const char *fmt, va_list args);
+
+	/**
+	 * @fn size_t StringBuilder::getBytes(const StringBuilder *self, uint8_t *bytes, size_t offset, size_t length)
+	 *
+	 * @brief Copies bytes of this StringBuilder, without flattening it.
+	 *
+	 * @param bytes The destination, which must hold at least `length` bytes.
+	 * @param offset The offset of the first byte to copy.
+	 * @param length The count of bytes to copy.
+	 *
+	 * @return The count of bytes copied, which is less than `length` at the end of the contents.
+	 *
+	 * @memberof StringBuilder
+	 */
+	size_t (*getBytes)(const StringBuilder *self, uint8_t *bytes, size_t offset, size_t length);
+
+	/**
+	 * @fn StringBuilder *StringBuilder::init(StringBuilder *self)
+	 *
+	 * @brief Initializes this StringBuilder.
+	 *
+	 * @return The initialized StringBuilder, or `NULL` on error.
+	 *
+	 * @memberof StringBuilder
+	 */
+	StringBuilder *(*init)(StringBuilder *self);
+
+	/**
+	 * @fn String *StringBuilder::string(const StringBuilder *self)
+	 *
+	 * @brief Flattens the contents of this StringBuilder into a String.
+	 *
+	 * @return A new String with the contents of this StringBuilder.
+	 *
+	 * @memberof StringBuilder
+	 */
+	String *(*string)(const StringBuilder *self);
+
+	/**
+	 * @fn _Bool StringBuilder::writeToFileDescriptor(const StringBuilder *self, int fd)
+	 *
+	 * @brief Writes the contents of this StringBuilder to the specified file descriptor.
+	 *
+	 * @param fd The file descriptor.
+	 *
+	 * @return True on success, false on error.
+	 *
+	 * @remarks The chunks are gathered with `writev`, without being flattened.
+	 *
+	 * @memberof StringBuilder
+	 */
+	_Bool (*writeToFileDescriptor)(const StringBuilder *self, int fd);
+};
+
+/**
+ * @brief The StringBuilder Class.
+ */
+extern Class _StringBuilder;
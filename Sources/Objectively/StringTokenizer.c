@@ -0,0 +1,210 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <assert.h>
+#include <limits.h>
+#include <string.h>
+
+#include <Objectively/StringTokenizer.h>
+
+#include "ByteVector.h"
+
+#define _Class _StringTokenizer
+
+/**
+ * @return The index of the first delimiter at or after `index`, or the input length if there is
+ * none.
+ */
+static size_t scanDelimiter(const StringTokenizer *self, size_t index) {
+
+	const uint8_t *bytes = self->bytes;
+	const size_t count = self->locals.delimiterCount;
+
+	if (count && count <= STRING_TOKENIZER_VECTOR_DELIMITERS) {
+
+		ByteVector delimiters[STRING_TOKENIZER_VECTOR_DELIMITERS];
+		for (size_t i = 0; i < count; i++) {
+			delimiters[i] = (ByteVector) { 0 } + self->locals.delimiters[i];
+		}
+
+		for (; index + BYTE_VECTOR_LANES <= self->length; index += BYTE_VECTOR_LANES) {
+
+			const ByteVector vector = loadByteVector(bytes + index);
+
+			ByteVector matches = { 0 };
+			for (size_t i = 0; i < count; i++) {
+				matches |= (ByteVector) (vector == delimiters[i]);
+			}
+
+			const ByteVectorMask mask = (ByteVectorMask) matches;
+			for (size_t w = 0; w < lengthof(mask); w++) {
+				if (mask[w]) {
+					return index + w * 8 + (__builtin_ctzll(mask[w]) >> 3);
+				}
+			}
+		}
+	}
+
+	while (index < self->length && self->locals.isDelimiter[bytes[index]] == false) {
+		index++;
+	}
+
+	return index;
+}
+
+/**
+ * @brief Initializes `self` to tokenize the `length` bytes at `bytes`, owned by `source`.
+ */
+static StringTokenizer *initWithBytes(StringTokenizer *self, Object *source, const uint8_t *bytes, size_t length, const char *delimiters, StringTokenizerOptions options) {
+
+	assert(delimiters);
+	assert(length <= INT_MAX);
+
+	self = (StringTokenizer *) super(Object, self, init);
+	if (self) {
+
+		self->locals.source = retain(source);
+
+		for (const uint8_t *d = (const uint8_t *) delimiters; *d; d++) {
+			if (self->locals.isDelimiter[*d] == false) {
+				self->locals.isDelimiter[*d] = true;
+
+				if (self->locals.delimiterCount < STRING_TOKENIZER_VECTOR_DELIMITERS) {
+					self->locals.delimiters[self->locals.delimiterCount] = *d;
+				}
+
+				self->locals.delimiterCount++;
+			}
+		}
+
+		self->bytes = bytes;
+		self->length = length;
+		self->options = options;
+	}
+
+	return self;
+}
+
+#pragma mark - Object
+
+/**
+ * @see Object::dealloc(Object *)
+ */
+static void dealloc(Object *self) {
+
+	StringTokenizer *this = (StringTokenizer *) self;
+
+	release(this->locals.source);
+
+	super(Object, self, dealloc);
+}
+
+#pragma mark - StringTokenizer
+
+/**
+ * @fn StringTokenizer *StringTokenizer::initWithData(StringTokenizer *self, const Data *data, const char *delimiters, StringTokenizerOptions options)
+ *
+ * @memberof StringTokenizer
+ */
+static StringTokenizer *initWithData(StringTokenizer *self, const Data *data, const char *delimiters, StringTokenizerOptions options) {
+
+	assert(data);
+
+	return initWithBytes(self, (Object *) data, data->bytes, data->length, delimiters, options);
+}
+
+/**
+ * @fn StringTokenizer *StringTokenizer::initWithString(StringTokenizer *self, const String *string, const char *delimiters, StringTokenizerOptions options)
+ *
+ * @memberof StringTokenizer
+ */
+static StringTokenizer *initWithString(StringTokenizer *self, const String *string, const char *delimiters, StringTokenizerOptions options) {
+
+	assert(string);
+
+	const uint8_t *bytes = (const uint8_t *) string->chars;
+
+	return initWithBytes(self, (Object *) string, bytes, string->length, delimiters, options);
+}
+
+/**
+ * @fn _Bool StringTokenizer::nextToken(StringTokenizer *self, Range *range)
+ *
+ * @memberof StringTokenizer
+ */
+static _Bool nextToken(StringTokenizer *self, Range *range) {
+
+	assert(range);
+
+	while (self->index <= self->length) {
+
+		const size_t start = self->index;
+		const size_t end = scanDelimiter(self, start);
+
+		self->index = end + 1;
+
+		if (end > start || (self->options & StringTokenizerOptionSkipEmpty) == 0) {
+			*range = (Range) { (int) start, (int) (end - start) };
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/**
+ * @fn void StringTokenizer::reset(StringTokenizer *self)
+ *
+ * @memberof StringTokenizer
+ */
+static void reset(StringTokenizer *self) {
+	self->index = 0;
+}
+
+#pragma mark - Class lifecycle
+
+/**
+ * @see Class::initialize(Class *)
+ */
+static void initialize(Class *clazz) {
+
+	((ObjectInterface *) clazz->interface)->dealloc = dealloc;
+
+	StringTokenizerInterface *tokenizer = (StringTokenizerInterface *) clazz->interface;
+
+	tokenizer->initWithData = initWithData;
+	tokenizer->initWithString = initWithString;
+	tokenizer->nextToken = nextToken;
+	tokenizer->reset = reset;
+}
+
+Class _StringTokenizer = {
+	.name = "StringTokenizer",
+	.superclass = &_Object,
+	.instanceSize = sizeof(StringTokenizer),
+	.interfaceOffset = offsetof(StringTokenizer, interface),
+	.interfaceSize = sizeof(StringTokenizerInterface),
+	.initialize = initialize,
+};
+
+#undef _Class
@@ -0,0 +1,204 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#pragma once
+
+#include <Objectively/Data.h>
+#include <Objectively/String.h>
+
+/**
+ * @file
+ *
+ * @brief Lazy tokenizers for Strings and Data.
+ */
+
+/**
+ * @brief Delimiter sets of up to this many bytes are scanned for a vector at a time.
+ */
+#define STRING_TOKENIZER_VECTOR_DELIMITERS 8
+
+typedef struct StringTokenizer StringTokenizer;
+typedef struct StringTokenizerInterface StringTokenizerInterface;
+
+/**
+ * @brief StringTokenizer options.
+ */
+typedef enum {
+
+	/**
+	 * @brief Yield every token, including the empty tokens between adjacent delimiters.
+	 */
+	StringTokenizerOptionNone = 0,
+
+	/**
+	 * @brief Skip empty tokens.
+	 */
+	StringTokenizerOptionSkipEmpty = 0x1,
+} StringTokenizerOptions;
+
+/**
+ * @brief Lazy tokenizers for Strings and Data.
+ *
+ * @details A StringTokenizer yields the Range of each token of its input, one at a time,
+ * without allocating anything per token. Tokens are separated by any byte of a set of
+ * delimiters, so that, for example, `"\r\n"` splits lines ending with either.
+ *
+ * @remarks The tokenizer retains its input, which must not be modified while it is tokenized.
+ * Like every Range, token ranges are expressed in `int`, so the input may not exceed `INT_MAX`
+ * bytes; tokenize larger inputs in windows.
+ *
+ * @extends Object
+ *
+ * @ingroup ByteStreams
+ */
+struct StringTokenizer {
+
+	/**
+	 * @brief The parent.
+	 *
+	 * @private
+	 */
+	Object object;
+
+	/**
+	 * @brief The typed interface.
+	 *
+	 * @private
+	 */
+	StringTokenizerInterface *interface;
+
+	/**
+	 * @private
+	 */
+	struct {
+
+		/**
+		 * @brief The String or Data being tokenized.
+		 */
+		Object *source;
+
+		/**
+		 * @brief The delimiters, if there are no more than `STRING_TOKENIZER_VECTOR_DELIMITERS`.
+		 */
+		uint8_t delimiters[STRING_TOKENIZER_VECTOR_DELIMITERS];
+
+		/**
+		 * @brief The count of distinct delimiters.
+		 */
+		size_t delimiterCount;
+
+		/**
+		 * @brief True for each delimiting byte value.
+		 */
+		_Bool isDelimiter[256];
+
+	} locals;
+
+	/**
+	 * @brief The bytes being tokenized.
+	 */
+	const uint8_t *bytes;
+
+	/**
+	 * @brief The length of `bytes`.
+	 */
+	size_t length;
+
+	/**
+	 * @brief The index of the next token, or `length + 1` once the tokens are exhausted.
+	 */
+	size_t index;
+
+	/**
+	 * @brief The StringTokenizerOptions.
+	 */
+	StringTokenizerOptions options;
+};
+
+/**
+ * @brief The StringTokenizer interface.
+ */
+struct StringTokenizerInterface {
+
+	/**
+	 * @brief The parent interface.
+	 */
+	ObjectInterface objectInterface;
+
+	/**
+	 * @fn StringTokenizer *StringTokenizer::initWithData(StringTokenizer *self, const Data *data, const char *delimiters, StringTokenizerOptions options)
+	 *
+	 * @brief Initializes this StringTokenizer with the specified Data.
+	 *
+	 * @param data The Data to tokenize.
+	 * @param delimiters The null-terminated set of delimiting bytes.
+	 * @param options The StringTokenizerOptions.
+	 *
+	 * @return The initialized StringTokenizer, or `NULL` on error.
+	 *
+	 * @memberof StringTokenizer
+	 */
+	StringTokenizer *(*initWithData)(StringTokenizer *self, const Data *data, const char *delimiters, StringTokenizerOptions options);
+
+	/**
+	 * @fn StringTokenizer *StringTokenizer::initWithString(StringTokenizer *self, const String *string, const char *delimiters, StringTokenizerOptions options)
+	 *
+	 * @brief Initializes this StringTokenizer with the specified String.
+	 *
+	 * @param string The String to tokenize.
+	 * @param delimiters The null-terminated set of delimiting bytes.
+	 * @param options The StringTokenizerOptions.
+	 *
+	 * @return The initialized StringTokenizer, or `NULL` on error.
+	 *
+	 * @memberof StringTokenizer
+	 */
+	StringTokenizer *(*initWithString)(StringTokenizer *self, const String *string, const char *delimiters, StringTokenizerOptions options);
+
+	/**
+	 * @fn _Bool StringTokenizer::nextToken(StringTokenizer *self, Range *range)
+	 *
+	 * @brief Advances this StringTokenizer to its next token.
+	 *
+	 * @param range Receives the Range of the next token in the input.
+	 *
+	 * @return True if a token was available, false if this StringTokenizer is exhausted.
+	 *
+	 * @memberof StringTokenizer
+	 */
+	_Bool (*nextToken)(StringTokenizer *self, Range *range);
+
+	/**
+	 * @fn void StringTokenizer::reset(StringTokenizer *self)
+	 *
+	 * @brief Rewinds this StringTokenizer to its first token.
+	 *
+	 * @memberof StringTokenizer
+	 */
+	void (*reset)(StringTokenizer *self);
+};
+
+/**
+ * @brief The StringTokenizer Class.
+ */
+extern Class _StringTokenizer;
@@ -77,6 +77,25 @@ typedef Order (*Comparator)(const ident obj1, const ident obj2);
  */
 typedef _Bool (*Predicate)(ident obj, ident data);
 
+/**
+ * @brief The Functor function type for transforming Objects.
+ *
+ * @return A new reference to the transformed Object, which the caller will release.
+ */
+typedef ident (*Functor)(ident obj, ident data);
+
+/**
+ * @brief The Reducer function type for aggregating Objects.
+ *
+ * @param obj The Object to fold into `accumulator`.
+ * @param accumulator The accumulated value, or `NULL` for the first Object.
+ * @param data User data.
+ *
+ * @return Either `accumulator` itself, or a new reference to the next accumulated value, in
+ * which case the caller will release `accumulator`.
+ */
+typedef ident (*Reducer)(ident obj, ident accumulator, ident data);
+
 /**
  * @return The value, clamped to the bounds.
  */
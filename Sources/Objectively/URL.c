@@ -137,6 +137,16 @@ static URL *baseURL(const URL *self) {
  */
 static URL *initWithCharacters(URL *self, const char *chars) {
 
+	return $(self, initWithCharactersWithOptions, chars, 0);
+}
+
+/**
+ * @fn URL *URL::initWithCharactersWithOptions(URL *self, const char *chars, int options)
+ *
+ * @memberof URL
+ */
+static URL *initWithCharactersWithOptions(URL *self, const char *chars, int options) {
+
 	assert(chars);
 
 	self = (URL *) super(Object, self, init);
@@ -156,9 +166,21 @@ static URL *initWithCharacters(URL *self, const char *chars) {
 
 			self->scheme = $(self->urlString, substring, *scheme);
 
+			if (options & URL_INTERN_COMPONENTS) {
+				String *interned = retain($(self->scheme, intern));
+				release(self->scheme);
+				self->scheme = interned;
+			}
+
 			if (host->location > -1) {
 				self->host = $(self->urlString, substring, *host);
 
+				if (options & URL_INTERN_COMPONENTS) {
+					String *interned = retain($(self->host, intern));
+					release(self->host);
+					self->host = interned;
+				}
+
 				if (port->location > -1) {
 					const char *s = self->urlString->chars + port->location + 1;
 					self->port = strtoul(s, NULL, 10);
@@ -236,6 +258,7 @@ static void initialize(Class *clazz) {
 
 	url->baseURL = baseURL;
 	url->initWithCharacters = initWithCharacters;
+	url->initWithCharactersWithOptions = initWithCharactersWithOptions;
 	url->initWithString = initWithString;
 	url->pathComponents = pathComponents;
 
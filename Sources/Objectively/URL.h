@@ -35,6 +35,13 @@
  * @see http://www.ietf.org/rfc/rfc3986.txt
  */
 
+/**
+ * @brief Interns the scheme and host of the URL, which are typically shared by many URLs.
+ *
+ * @see String::intern(const String *)
+ */
+#define URL_INTERN_COMPONENTS 1
+
 typedef struct URL URL;
 typedef struct URLInterface URLInterface;
 
@@ -131,6 +138,20 @@ struct URLInterface {
 	 */
 	URL *(*initWithCharacters)(URL *self, const char *chars);
 
+	/**
+	 * @fn URL *URL::initWithCharactersWithOptions(URL *self, const char *chars, int options)
+	 *
+	 * @brief Initializes this URL with the specified characters and options.
+	 *
+	 * @param chars The URL characters.
+	 * @param options A bitwise-or of `URL_*`.
+	 *
+	 * @return The initialized URL, or `NULL` on error.
+	 *
+	 * @memberof URL
+	 */
+	URL *(*initWithCharactersWithOptions)(URL *self, const char *chars, int options);
+
 	/**
 	 * @fn URL *URL::initWithString(URL *self, const String *string)
 	 *
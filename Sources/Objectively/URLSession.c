@@ -25,11 +25,17 @@
 
 #include <curl/curl.h>
 
+#include <Objectively/HashMap.h>
 #include <Objectively/Once.h>
 #include <Objectively/URLSession.h>
 
 #define _Class _URLSession
 
+/**
+ * @brief Maps libcurl easy handles to the URLSessionTasks that own them.
+ */
+DECLARE_HASHMAP(URLSessionTaskMap, ident, URLSessionTask *, HashMapHashPointer, HashMapEqualPointers);
+
 #pragma mark - Object
 
 /**
@@ -63,7 +69,7 @@ static URLSessionDataTask *dataTaskWithRequest(URLSession *self, URLRequest *req
 	task = $(task, initWithRequestInSession, request, self, completion);
 
 	WithLock(self->locals.lock, {
-		$(self->locals.tasks, addObject, task);
+		$(self->locals.tasks, pushLastObject, task);
 	});
 
 	return (URLSessionDataTask *) task;
@@ -98,7 +104,7 @@ static URLSessionDownloadTask *downloadTaskWithRequest(URLSession *self, URLRequ
 	task = $(task, initWithRequestInSession, request, self, completion);
 
 	WithLock(self->locals.lock, {
-		$(self->locals.tasks, addObject, task);
+		$(self->locals.tasks, pushLastObject, task);
 	})
 
 	return (URLSessionDownloadTask *) task;
@@ -147,6 +153,8 @@ static ident run(Thread *thread) {
 	self->locals.handle = curl_multi_init();
 	assert(self->locals.handle);
 
+	URLSessionTaskMap tasksByHandle = { 0 };
+
 	while (true) {
 		int ret;
 
@@ -177,6 +185,8 @@ static ident run(Thread *thread) {
 
 					const CURLMcode merr = curl_multi_add_handle(self->locals.handle, task->locals.handle);
 					assert(merr == CURLM_OK);
+
+					URLSessionTaskMapSet(&tasksByHandle, task->locals.handle, task);
 				} else {
 					const CURLcode err = curl_easy_pause(task->locals.handle, CURLPAUSE_CONT);
 					assert(err == CURLE_OK);
@@ -189,6 +199,8 @@ static ident run(Thread *thread) {
 				if (task->locals.handle) {
 					const CURLMcode merr = curl_multi_remove_handle(self->locals.handle, task->locals.handle);
 					assert(merr == CURLM_OK);
+
+					URLSessionTaskMapRemove(&tasksByHandle, task->locals.handle);
 				}
 
 				task->state = URLSESSIONTASK_CANCELED;
@@ -214,23 +226,18 @@ static ident run(Thread *thread) {
 		CURLMsg *message;
 		while ((message = curl_multi_info_read(self->locals.handle, &ret))) {
 
-			URLSessionTask *task = NULL;
-			for (size_t i = 0; i < tasks->count; i++) {
+			URLSessionTask **value = URLSessionTaskMapGet(&tasksByHandle, message->easy_handle);
+			assert(value);
 
-				URLSessionTask *t = $(tasks, objectAtIndex, i);
-				if (t->locals.handle == message->easy_handle) {
-					task = t;
-					break;
-				}
-			}
-
-			assert(task);
+			URLSessionTask *task = *value;
 
 			if (message->msg == CURLMSG_DONE) {
 
 				merr = curl_multi_remove_handle(self->locals.handle, task->locals.handle);
 				assert(merr == CURLM_OK);
 
+				URLSessionTaskMapRemove(&tasksByHandle, task->locals.handle);
+
 				task->state = URLSESSIONTASK_COMPLETED;
 
 				if (task->completion) {
@@ -248,6 +255,8 @@ static ident run(Thread *thread) {
 		release(tasks);
 	}
 
+	URLSessionTaskMapFree(&tasksByHandle);
+
 	curl_multi_cleanup(self->locals.handle);
 
 	return NULL;
@@ -267,7 +276,7 @@ static URLSession *initWithConfiguration(URLSession *self, URLSessionConfigurati
 		self->configuration = retain(configuration);
 
 		self->locals.lock = alloc(Lock, init);
-		self->locals.tasks = alloc(MutableArray, init);
+		self->locals.tasks = alloc(MutableDeque, init);
 		self->locals.thread = alloc(Thread, initWithFunction, run, self);
 
 		$(self->locals.thread, start);
@@ -323,7 +332,7 @@ static Array *tasks(const URLSession *self) {
 	Array *array;
 
 	WithLock(self->locals.lock, {
-		array = $$(Array, arrayWithArray, (Array *) self->locals.tasks);
+		array = $((Deque *) self->locals.tasks, allObjects);
 	});
 
 	return array;
@@ -341,7 +350,7 @@ static URLSessionUploadTask *uploadTaskWithRequest(URLSession *self, URLRequest
 	task = $(task, initWithRequestInSession, request, self, completion);
 
 	WithLock(self->locals.lock, {
-		$(self->locals.tasks, addObject, task);
+		$(self->locals.tasks, pushLastObject, task);
 	})
 
 	return (URLSessionUploadTask *) task;
@@ -39,7 +39,7 @@ typedef struct URLSession URLSession;
 typedef struct URLSessionInterface URLSessionInterface;
 
 #include <Objectively/Lock.h>
-#include <Objectively/MutableArray.h>
+#include <Objectively/MutableDeque.h>
 #include <Objectively/Object.h>
 #include <Objectively/URLRequest.h>
 #include <Objectively/URLSessionConfiguration.h>
@@ -89,7 +89,7 @@ struct URLSession {
 		/**
 		 * @brief The URLSessionTasks.
 		 */
-		MutableArray *tasks;
+		MutableDeque *tasks;
 
 		/**
 		 * @brief The backing Thread.
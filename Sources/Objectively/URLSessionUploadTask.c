@@ -39,7 +39,14 @@ static size_t readFunction(char *data, size_t size, size_t count, ident self) {
 
 	URLSessionUploadTask *this = (URLSessionUploadTask *) self;
 
-	const size_t bytesRead = fread(data, size, count, this->file);
+	size_t bytesRead;
+	if (this->file) {
+		bytesRead = fread(data, size, count, this->file);
+	} else {
+		const size_t offset = this->urlSessionTask.bytesSent;
+		bytesRead = $(this->stringBuilder, getBytes, (uint8_t *) data, offset, size * count);
+	}
+
 	this->urlSessionTask.bytesSent += bytesRead;
 
 	return bytesRead;
@@ -54,15 +61,20 @@ static void setup(URLSessionTask *self) {
 
 	URLSessionUploadTask *this = (URLSessionUploadTask *) self;
 
-	assert(this->file);
+	if (this->file) {
+
+		int err = fseek(this->file, 0, SEEK_END);
+		assert(err == 0);
 
-	int err = fseek(this->file, 0, SEEK_END);
-	assert(err == 0);
+		self->bytesExpectedToSend = ftell(this->file);
 
-	self->bytesExpectedToSend = ftell(this->file);
+		err = fseek(this->file, 0, SEEK_SET);
+		assert(err == 0);
+	} else {
+		assert(this->stringBuilder);
 
-	err = fseek(this->file, 0, SEEK_SET);
-	assert(err == 0);
+		self->bytesExpectedToSend = this->stringBuilder->length;
+	}
 
 	curl_easy_setopt(self->locals.handle, CURLOPT_INFILESIZE_LARGE, self->bytesExpectedToSend);
 
@@ -26,6 +26,7 @@
 #include <stdio.h>
 
 #include <Objectively/Data.h>
+#include <Objectively/StringBuilder.h>
 #include <Objectively/URLSessionTask.h>
 
 /**
@@ -63,6 +64,14 @@ struct URLSessionUploadTask {
 	 * @brief The FILE to upload.
 	 */
 	FILE *file;
+
+	/**
+	 * @brief The StringBuilder to upload, if `file` is `NULL`.
+	 *
+	 * @remarks The StringBuilder is uploaded chunk by chunk, without being flattened. Like
+	 * `file`, it must remain valid and unmodified until the task completes.
+	 */
+	StringBuilder *stringBuilder;
 };
 
 /**
@@ -0,0 +1,106 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#pragma once
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <Objectively/Types.h>
+
+/**
+ * @file
+ *
+ * @brief Unboxed, type-specialized vectors.
+ *
+ * @details `DECLARE_VECTOR(name, T)` declares the struct `name`, a growable array of `T`, and
+ * inline functions prefixed with `name` to operate on it. Values are stored by value; there is
+ * no dynamic dispatch and no reference counting.
+ *
+ * @code
+ * DECLARE_VECTOR(IntVector, int);
+ *
+ * IntVector v = { 0 };
+ * IntVectorPush(&v, 1);
+ * IntVectorFree(&v);
+ * @endcode
+ */
+
+/**
+ * @brief Declares the vector type `name` of elements of type `T`.
+ *
+ * @param name The type name, also the prefix of the generated functions.
+ * @param T The element type.
+ */
+#define DECLARE_VECTOR(name, T) \
+	\
+	typedef struct { \
+		T *elements; \
+		size_t count; \
+		size_t capacity; \
+	} name; \
+	\
+	/** @brief Releases the storage of `vector`, leaving it empty and reusable. */ \
+	static inline __attribute__((unused)) void name##Free(name *vector) { \
+		free(vector->elements); \
+		memset(vector, 0, sizeof(*vector)); \
+	} \
+	\
+	/** @brief Ensures that `vector` can hold `capacity` elements without reallocating. */ \
+	static inline __attribute__((unused)) void name##Reserve(name *vector, size_t capacity) { \
+		if (capacity > vector->capacity) { \
+			size_t newCapacity = vector->capacity ? vector->capacity : 8; \
+			while (newCapacity < capacity) { \
+				newCapacity *= 2; \
+			} \
+			vector->elements = (T *) realloc(vector->elements, newCapacity * sizeof(T)); \
+			assert(vector->elements); \
+			vector->capacity = newCapacity; \
+		} \
+	} \
+	\
+	/** @brief Appends `element` to `vector`. */ \
+	static inline __attribute__((unused)) void name##Push(name *vector, T element) { \
+		if (vector->count == vector->capacity) { \
+			name##Reserve(vector, vector->count + 1); \
+		} \
+		vector->elements[vector->count++] = element; \
+	} \
+	\
+	/** @brief Removes and returns the last element of `vector`, which must not be empty. */ \
+	static inline __attribute__((unused)) T name##Pop(name *vector) { \
+		assert(vector->count); \
+		return vector->elements[--vector->count]; \
+	} \
+	\
+	/** @brief Removes the element at `index` by moving the last element into its place. */ \
+	static inline __attribute__((unused)) void name##SwapRemove(name *vector, size_t index) { \
+		assert(index < vector->count); \
+		vector->elements[index] = vector->elements[--vector->count]; \
+	} \
+	\
+	/** @brief Removes all elements from `vector`, retaining its capacity. */ \
+	static inline __attribute__((unused)) void name##Clear(name *vector) { \
+		vector->count = 0; \
+	}
@@ -79,10 +79,37 @@ START_TEST(array)
 
 	}END_TEST
 
+START_TEST(iterator)
+	{
+		Array *array = $$(Array, arrayWithObjects, $$(String, stringWithCharacters, "a"),
+				$$(String, stringWithCharacters, "b"), $$(String, stringWithCharacters, "c"), NULL);
+
+		MutableString *joined = $$(MutableString, string);
+
+		String *string;
+		ArrayForEach(string, array) {
+			$(joined, appendString, string);
+			release(string);
+		}
+
+		ck_assert_str_eq("abc", joined->string.chars);
+
+		ArrayIterator iterator = MakeArrayIterator(array);
+		ident obj;
+
+		ck_assert(ArrayIteratorNext(&iterator, &obj));
+		ck_assert_ptr_eq($(array, firstObject), obj);
+
+		release(joined);
+		release(array);
+
+	}END_TEST
+
 int main(int argc, char **argv) {
 
 	TCase *tcase = tcase_create("array");
 	tcase_add_test(tcase, array);
+	tcase_add_test(tcase, iterator);
 
 	Suite *suite = suite_create("array");
 	suite_add_tcase(suite, tcase);
@@ -0,0 +1,101 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <check.h>
+#include <stdio.h>
+
+#include <Objectively.h>
+
+#define CAPACITY 10000
+
+START_TEST(bloomFilter)
+	{
+		BloomFilter *filter = alloc(BloomFilter, initWithCapacity, CAPACITY, 0.01);
+		ck_assert(filter != NULL);
+		ck_assert_int_gt(filter->blockCount, 0);
+
+		char bytes[32];
+		for (int i = 0; i < CAPACITY; i++) {
+			const int length = snprintf(bytes, sizeof(bytes), "member-%d", i);
+			$(filter, addBytes, (uint8_t *) bytes, length);
+		}
+
+		ck_assert_int_eq(CAPACITY, filter->count);
+
+		for (int i = 0; i < CAPACITY; i++) {
+			const int length = snprintf(bytes, sizeof(bytes), "member-%d", i);
+			ck_assert($(filter, containsBytes, (uint8_t *) bytes, length));
+		}
+
+		int falsePositives = 0;
+		for (int i = 0; i < CAPACITY; i++) {
+			const int length = snprintf(bytes, sizeof(bytes), "stranger-%d", i);
+			falsePositives += $(filter, containsBytes, (uint8_t *) bytes, length);
+		}
+
+		ck_assert_int_lt(falsePositives, CAPACITY * 0.02);
+
+		String *string = $$(String, stringWithCharacters, "object");
+		ck_assert(!$(filter, containsObject, string));
+		$(filter, addObject, string);
+		ck_assert($(filter, containsObject, string));
+
+		Data *data = $(filter, data);
+		BloomFilter *copy = alloc(BloomFilter, initWithData, data);
+		ck_assert(copy != NULL);
+		ck_assert($((Object *) filter, isEqual, (Object *) copy));
+		ck_assert_int_eq(filter->count, copy->count);
+		ck_assert($(copy, containsObject, string));
+
+		Data *garbage = $$(Data, dataWithBytes, (uint8_t *) "garbage", 7);
+		ck_assert_ptr_eq(NULL, alloc(BloomFilter, initWithData, garbage));
+
+		$(filter, removeAllObjects);
+		ck_assert(!$(filter, containsObject, string));
+		ck_assert(!$((Object *) filter, isEqual, (Object *) copy));
+
+		release(garbage);
+		release(copy);
+		release(data);
+		release(string);
+		release(filter);
+
+	}END_TEST
+
+int main(int argc, char **argv) {
+
+	TCase *tcase = tcase_create("bloomFilter");
+	tcase_add_test(tcase, bloomFilter);
+
+	Suite *suite = suite_create("bloomFilter");
+	suite_add_tcase(suite, tcase);
+
+	SRunner *runner = srunner_create(suite);
+
+	srunner_run_all(runner, CK_VERBOSE);
+	int failed = srunner_ntests_failed(runner);
+
+	srunner_free(runner);
+
+	return failed;
+}
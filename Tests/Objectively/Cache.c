@@ -0,0 +1,278 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <check.h>
+
+#include <Objectively.h>
+
+#define KEYS 2000
+#define THREADS 4
+
+static Number *keys[KEYS];
+
+/**
+ * @return True if `cache` contains `key`.
+ */
+static _Bool containsKey(Cache *cache, ident key) {
+
+	ident obj = $(cache, objectForKey, key);
+	release(obj);
+
+	return obj != NULL;
+}
+
+START_TEST(lru)
+	{
+		Cache *cache = alloc(Cache, initWithCostLimit, 3, CacheEvictionPolicyLRU);
+		ck_assert(cache != NULL);
+
+		$(cache, setObjectForKey, keys[0], keys[0]);
+		$(cache, setObjectForKey, keys[1], keys[1]);
+		$(cache, setObjectForKey, keys[2], keys[2]);
+
+		ck_assert(containsKey(cache, keys[0]));
+
+		$(cache, setObjectForKey, keys[3], keys[3]);
+
+		ck_assert(containsKey(cache, keys[0]));
+		ck_assert(!containsKey(cache, keys[1]));
+		ck_assert(containsKey(cache, keys[2]));
+		ck_assert(containsKey(cache, keys[3]));
+
+		CacheStatistics statistics = $(cache, statistics);
+		ck_assert_int_eq(3, statistics.count);
+		ck_assert_int_eq(3, statistics.cost);
+		ck_assert_int_eq(4, statistics.hits);
+		ck_assert_int_eq(1, statistics.misses);
+		ck_assert_int_eq(1, statistics.evictions);
+
+		const size_t size = $((Object *) cache, sizeInBytes);
+		ck_assert(size > _Cache.instanceSize);
+		ck_assert($((Object *) cache, deepSizeInBytes) > size);
+
+		$(cache, setObjectForKey, keys[4], keys[0]);
+		ck_assert_ptr_eq(keys[4], $(cache, objectForKey, keys[0]));
+		release(keys[4]);
+
+		$(cache, removeObjectForKey, keys[0]);
+		ck_assert(!containsKey(cache, keys[0]));
+
+		$(cache, removeAllObjects);
+		ck_assert_int_eq(0, $(cache, statistics).count);
+		ck_assert($((Object *) cache, sizeInBytes) < size);
+
+		release(cache);
+
+	}END_TEST
+
+START_TEST(clockPolicy)
+	{
+		Cache *cache = alloc(Cache, initWithCostLimit, 3, CacheEvictionPolicyCLOCK);
+
+		$(cache, setObjectForKey, keys[0], keys[0]);
+		$(cache, setObjectForKey, keys[1], keys[1]);
+		$(cache, setObjectForKey, keys[2], keys[2]);
+
+		ck_assert(containsKey(cache, keys[0]));
+
+		$(cache, setObjectForKey, keys[3], keys[3]);
+		$(cache, setObjectForKey, keys[4], keys[4]);
+
+		ck_assert(containsKey(cache, keys[0]));
+		ck_assert(!containsKey(cache, keys[1]));
+		ck_assert(!containsKey(cache, keys[2]));
+		ck_assert(containsKey(cache, keys[3]));
+		ck_assert(containsKey(cache, keys[4]));
+
+		ck_assert_int_eq(2, $(cache, statistics).evictions);
+
+		release(cache);
+
+	}END_TEST
+
+START_TEST(tinyLFU)
+	{
+		Cache *cache = alloc(Cache, initWithCostLimit, 100, CacheEvictionPolicyTinyLFU);
+
+		for (int i = 0; i < 5; i++) {
+			for (int j = 0; j < 50; j++) {
+				if (!containsKey(cache, keys[j])) {
+					$(cache, setObjectForKey, keys[j], keys[j]);
+				}
+			}
+		}
+
+		for (int i = 50; i < KEYS; i++) {
+			$(cache, setObjectForKey, keys[i], keys[i]);
+		}
+
+		int retained = 0;
+		for (int i = 0; i < 50; i++) {
+			retained += containsKey(cache, keys[i]);
+		}
+
+		ck_assert_int_ge(retained, 45);
+
+		CacheStatistics statistics = $(cache, statistics);
+		ck_assert_int_le(statistics.cost, 100);
+		ck_assert_int_eq(statistics.count, statistics.cost);
+
+		release(cache);
+
+	}END_TEST
+
+START_TEST(cost)
+	{
+		Cache *cache = alloc(Cache, initWithCostLimit, 100, CacheEvictionPolicyLRU);
+
+		Data *data[3];
+		for (int i = 0; i < 3; i++) {
+			uint8_t bytes[60] = { 0 };
+			data[i] = $$(Data, dataWithBytes, bytes, 30 + i * 10);
+		}
+
+		$(cache, setObjectForKeyWithCost, data[0], keys[0], data[0]->length, NULL);
+		$(cache, setObjectForKeyWithCost, data[1], keys[1], data[1]->length, NULL);
+
+		ck_assert_int_eq(70, $(cache, statistics).cost);
+
+		$(cache, setObjectForKeyWithCost, data[2], keys[2], data[2]->length, NULL);
+
+		ck_assert(!containsKey(cache, keys[0]));
+		ck_assert(containsKey(cache, keys[1]));
+		ck_assert_int_eq(90, $(cache, statistics).cost);
+
+		$(cache, setObjectForKeyWithCost, data[0], keys[3], 101, NULL);
+		ck_assert(!containsKey(cache, keys[3]));
+
+		const Time past = { .tv_sec = -60 };
+		Date *expiration = $$(Date, dateWithTimeSinceNow, &past);
+
+		$(cache, setObjectForKeyWithCost, data[0], keys[4], data[0]->length, expiration);
+		ck_assert(!containsKey(cache, keys[4]));
+		ck_assert_int_eq(1, $(cache, statistics).expirations);
+
+		release(expiration);
+
+		const Time future = { .tv_sec = 60 };
+		expiration = $$(Date, dateWithTimeSinceNow, &future);
+
+		$(cache, setObjectForKeyWithCost, data[0], keys[5], data[0]->length, expiration);
+		ck_assert(containsKey(cache, keys[5]));
+
+		release(expiration);
+		release(cache);
+
+		for (int i = 0; i < 3; i++) {
+			ck_assert_int_eq(1, ((Object *) data[i])->referenceCount);
+			release(data[i]);
+		}
+
+	}END_TEST
+
+static ident readAndWrite(Thread *thread) {
+
+	Cache *cache = thread->data;
+
+	unsigned int seed = (unsigned int) (uintptr_t) thread;
+
+	for (int i = 0; i < KEYS * 10; i++) {
+
+		Number *key = keys[rand_r(&seed) % (KEYS / 4) + (rand_r(&seed) % 4 == 0 ? KEYS / 2 : 0)];
+
+		Number *number = $(cache, objectForKey, key);
+		if (number) {
+			ck_assert_ptr_eq(key, number);
+			release(number);
+		} else {
+			$(cache, setObjectForKey, key, key);
+		}
+
+		if (i % 101 == 0) {
+			$(cache, removeObjectForKey, key);
+		}
+	}
+
+	return NULL;
+}
+
+START_TEST(concurrency)
+	{
+		const CacheEvictionPolicy policies[] = {
+			CacheEvictionPolicyLRU, CacheEvictionPolicyCLOCK, CacheEvictionPolicyTinyLFU
+		};
+
+		for (size_t i = 0; i < lengthof(policies); i++) {
+
+			Cache *cache = alloc(Cache, initWithCostLimit, 1024, policies[i]);
+
+			Thread *threads[THREADS];
+			for (int j = 0; j < THREADS; j++) {
+				threads[j] = alloc(Thread, initWithFunction, readAndWrite, cache);
+				$(threads[j], start);
+			}
+
+			for (int j = 0; j < THREADS; j++) {
+				$(threads[j], join, NULL);
+				release(threads[j]);
+			}
+
+			const CacheStatistics statistics = $(cache, statistics);
+			ck_assert_int_le(statistics.cost, 1024);
+			ck_assert_int_eq(THREADS * KEYS * 10, statistics.hits + statistics.misses);
+			ck_assert_int_gt(statistics.evictions, 0);
+
+			release(cache);
+		}
+
+	}END_TEST
+
+int main(int argc, char **argv) {
+
+	for (int i = 0; i < KEYS; i++) {
+		keys[i] = $$(Number, numberWithValue, i);
+	}
+
+	TCase *tcase = tcase_create("cache");
+	tcase_add_test(tcase, lru);
+	tcase_add_test(tcase, clockPolicy);
+	tcase_add_test(tcase, tinyLFU);
+	tcase_add_test(tcase, cost);
+	tcase_add_test(tcase, concurrency);
+
+	Suite *suite = suite_create("cache");
+	suite_add_tcase(suite, tcase);
+
+	SRunner *runner = srunner_create(suite);
+
+	srunner_run_all(runner, CK_VERBOSE);
+	int failed = srunner_ntests_failed(runner);
+
+	srunner_free(runner);
+
+	for (int i = 0; i < KEYS; i++) {
+		release(keys[i]);
+	}
+
+	return failed;
+}
@@ -0,0 +1,171 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <check.h>
+
+#include <Objectively.h>
+
+#define THREADS 4
+#define KEYS 2000
+
+static Number *keys[KEYS];
+
+static volatile int insertions;
+
+static ident insert(ident obj, ident data) {
+
+	__sync_add_and_fetch(&insertions, 1);
+
+	return $$(String, stringWithFormat, "%d", $((Number *) obj, intValue));
+}
+
+static ident readAndWrite(Thread *thread) {
+
+	ConcurrentDictionary *dictionary = thread->data;
+
+	for (int i = 0; i < KEYS; i++) {
+
+		$(dictionary, setObjectForKey, keys[i], keys[i]);
+
+		String *string = $(dictionary, objectForKeyOrInsert, keys[(i * 7) % KEYS], insert, NULL);
+		ck_assert(string != NULL);
+		release(string);
+
+		Number *number = $(dictionary, objectForKey, keys[i]);
+		if (number) {
+			ck_assert($((Object *) number, isKindOfClass, &_Number) || $((Object *) number, isKindOfClass, &_String));
+			release(number);
+		}
+
+		if (i % 3 == 0) {
+			$(dictionary, removeObjectForKey, keys[i]);
+		}
+	}
+
+	return NULL;
+}
+
+START_TEST(concurrentDictionary)
+	{
+		ConcurrentDictionary *dictionary = alloc(ConcurrentDictionary, init);
+
+		ck_assert(dictionary != NULL);
+		ck_assert_ptr_eq(&_ConcurrentDictionary, classof(dictionary));
+		ck_assert_int_eq(0, dictionary->count);
+
+		for (int i = 0; i < KEYS; i++) {
+			keys[i] = $$(Number, numberWithValue, i);
+		}
+
+		for (int i = 0; i < KEYS; i++) {
+			$(dictionary, setObjectForKey, keys[i], keys[i]);
+		}
+
+		ck_assert_int_eq(KEYS, dictionary->count);
+
+		const size_t size = $((Object *) dictionary, sizeInBytes);
+		ck_assert(size > _ConcurrentDictionary.instanceSize + KEYS * sizeof(ident));
+		ck_assert($((Object *) dictionary, deepSizeInBytes) > size);
+
+		for (int i = 0; i < KEYS; i++) {
+			Number *number = $(dictionary, objectForKey, keys[i]);
+			ck_assert_ptr_eq(keys[i], number);
+			release(number);
+		}
+
+		String *string = $$(String, stringWithCharacters, "replaced");
+		$(dictionary, setObjectForKey, string, keys[0]);
+
+		ident obj = $(dictionary, objectForKey, keys[0]);
+		ck_assert_ptr_eq(string, obj);
+		release(obj);
+		release(string);
+
+		obj = $(dictionary, objectForKeyOrInsert, keys[1], insert, NULL);
+		ck_assert_ptr_eq(keys[1], obj);
+		ck_assert_int_eq(0, insertions);
+		release(obj);
+
+		$(dictionary, removeObjectForKey, keys[1]);
+		ck_assert_int_eq(KEYS - 1, dictionary->count);
+
+		obj = $(dictionary, objectForKeyOrInsert, keys[1], insert, NULL);
+		ck_assert_str_eq("1", ((String *) obj)->chars);
+		ck_assert_int_eq(1, insertions);
+		release(obj);
+
+		Dictionary *snapshot = $(dictionary, dictionary);
+		ck_assert_int_eq(KEYS, snapshot->count);
+		ck_assert_ptr_eq(keys[2], $(snapshot, objectForKey, keys[2]));
+		release(snapshot);
+
+		$(dictionary, removeAllObjects);
+		ck_assert_int_eq(0, dictionary->count);
+		ck_assert_ptr_eq(NULL, $(dictionary, objectForKey, keys[2]));
+		ck_assert($((Object *) dictionary, sizeInBytes) < size);
+
+		Thread *threads[THREADS];
+		for (int i = 0; i < THREADS; i++) {
+			threads[i] = alloc(Thread, initWithFunction, readAndWrite, dictionary);
+			$(threads[i], start);
+		}
+
+		for (int i = 0; i < THREADS; i++) {
+			$(threads[i], join, NULL);
+			release(threads[i]);
+		}
+
+		for (int i = 0; i < KEYS; i++) {
+			obj = $(dictionary, objectForKey, keys[i]);
+			if (i % 3) {
+				ck_assert(obj != NULL);
+			}
+			release(obj);
+		}
+
+		release(dictionary);
+
+		for (int i = 0; i < KEYS; i++) {
+			ck_assert_int_eq(1, ((Object *) keys[i])->referenceCount);
+			release(keys[i]);
+		}
+
+	}END_TEST
+
+int main(int argc, char **argv) {
+
+	TCase *tcase = tcase_create("concurrentDictionary");
+	tcase_add_test(tcase, concurrentDictionary);
+
+	Suite *suite = suite_create("concurrentDictionary");
+	suite_add_tcase(suite, tcase);
+
+	SRunner *runner = srunner_create(suite);
+
+	srunner_run_all(runner, CK_VERBOSE);
+	int failed = srunner_ntests_failed(runner);
+
+	srunner_free(runner);
+
+	return failed;
+}
@@ -0,0 +1,111 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+/**
+ * @file
+ *
+ * @brief Verifies that the headers, including their inline functions and templates, compile as
+ * C++.
+ */
+
+#include <check.h>
+
+extern "C" {
+#include <Objectively.h>
+}
+
+DECLARE_HASHMAP(Counts, int64_t, int, HashMapHashInteger, HashMapEqualIntegers);
+DECLARE_VECTOR(Integers, int);
+
+START_TEST(cpp)
+	{
+		String *a = str("a"), *b = str("b");
+
+		Array *array = $$(Array, arrayWithObjects, a, b, NULL);
+
+		String *string;
+		size_t count = 0;
+		ArrayForEach(string, array) {
+			count++;
+		}
+		ck_assert_int_eq(2, count);
+
+		Dictionary *dictionary = $$(Dictionary, dictionaryWithObjectsAndKeys, a, b, NULL);
+
+		ident key, obj;
+		count = 0;
+		DictionaryForEach(key, obj, dictionary) {
+			count++;
+		}
+		ck_assert_int_eq(1, count);
+
+		Set *set = $$(Set, setWithArray, array);
+
+		count = 0;
+		SetForEach(obj, set) {
+			count++;
+		}
+		ck_assert_int_eq(2, count);
+
+		Unicode c;
+		count = 0;
+		StringForEachCodePoint(c, a) {
+			count++;
+		}
+		ck_assert_int_eq(1, count);
+
+		Counts counts = { 0 };
+		CountsSet(&counts, 42, 1);
+		ck_assert_int_eq(1, *CountsGet(&counts, 42));
+		CountsFree(&counts);
+
+		Integers integers = { 0 };
+		IntegersPush(&integers, 7);
+		ck_assert_int_eq(7, integers.elements[0]);
+		IntegersFree(&integers);
+
+		release(set);
+		release(dictionary);
+		release(array);
+		release(b);
+		release(a);
+
+	}END_TEST
+
+int main(int argc, char **argv) {
+
+	TCase *tcase = tcase_create("cpp");
+	tcase_add_test(tcase, cpp);
+
+	Suite *suite = suite_create("cpp");
+	suite_add_tcase(suite, tcase);
+
+	SRunner *runner = srunner_create(suite);
+
+	srunner_run_all(runner, CK_VERBOSE);
+	int failed = srunner_ntests_failed(runner);
+
+	srunner_free(runner);
+
+	return failed;
+}
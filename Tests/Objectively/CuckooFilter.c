@@ -0,0 +1,132 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <check.h>
+#include <stdio.h>
+
+#include <Objectively.h>
+
+#define CAPACITY 10000
+
+START_TEST(cuckooFilter)
+	{
+		CuckooFilter *filter = alloc(CuckooFilter, initWithCapacity, CAPACITY);
+		ck_assert(filter != NULL);
+
+		char bytes[32];
+		for (int i = 0; i < CAPACITY; i++) {
+			const int length = snprintf(bytes, sizeof(bytes), "member-%d", i);
+			ck_assert($(filter, addBytes, (uint8_t *) bytes, length));
+		}
+
+		ck_assert_int_eq(CAPACITY, filter->count);
+
+		for (int i = 0; i < CAPACITY; i++) {
+			const int length = snprintf(bytes, sizeof(bytes), "member-%d", i);
+			ck_assert($(filter, containsBytes, (uint8_t *) bytes, length));
+		}
+
+		int falsePositives = 0;
+		for (int i = 0; i < CAPACITY; i++) {
+			const int length = snprintf(bytes, sizeof(bytes), "stranger-%d", i);
+			falsePositives += $(filter, containsBytes, (uint8_t *) bytes, length);
+		}
+
+		ck_assert_int_lt(falsePositives, CAPACITY * 0.01);
+
+		for (int i = 0; i < CAPACITY; i += 2) {
+			const int length = snprintf(bytes, sizeof(bytes), "member-%d", i);
+			ck_assert($(filter, removeBytes, (uint8_t *) bytes, length));
+		}
+
+		ck_assert_int_eq(CAPACITY / 2, filter->count);
+
+		for (int i = 1; i < CAPACITY; i += 2) {
+			const int length = snprintf(bytes, sizeof(bytes), "member-%d", i);
+			ck_assert($(filter, containsBytes, (uint8_t *) bytes, length));
+		}
+
+		String *string = $$(String, stringWithCharacters, "object");
+		ck_assert($(filter, addObject, string));
+		ck_assert($(filter, containsObject, string));
+
+		Data *data = $(filter, data);
+		CuckooFilter *copy = alloc(CuckooFilter, initWithData, data);
+		ck_assert(copy != NULL);
+		ck_assert_int_eq(filter->count, copy->count);
+		ck_assert($(copy, containsObject, string));
+
+		ck_assert($(filter, removeObject, string));
+		ck_assert(!$(filter, containsObject, string));
+		ck_assert($(copy, containsObject, string));
+
+		release(copy);
+		release(data);
+
+		CuckooFilter *small = alloc(CuckooFilter, initWithCapacity, 16);
+
+		int added = 0;
+		for (int i = 0; i < 1000; i++) {
+			const int length = snprintf(bytes, sizeof(bytes), "member-%d", i);
+			if ($(small, addBytes, (uint8_t *) bytes, length)) {
+				added++;
+			} else {
+				break;
+			}
+		}
+
+		ck_assert_int_lt(added, 1000);
+		ck_assert_int_eq(added, small->count);
+
+		for (int i = 0; i < added; i++) {
+			const int length = snprintf(bytes, sizeof(bytes), "member-%d", i);
+			ck_assert($(small, containsBytes, (uint8_t *) bytes, length));
+		}
+
+		$(small, removeAllObjects);
+		ck_assert_int_eq(0, small->count);
+		ck_assert($(small, addObject, string));
+
+		release(small);
+		release(string);
+		release(filter);
+
+	}END_TEST
+
+int main(int argc, char **argv) {
+
+	TCase *tcase = tcase_create("cuckooFilter");
+	tcase_add_test(tcase, cuckooFilter);
+
+	Suite *suite = suite_create("cuckooFilter");
+	suite_add_tcase(suite, tcase);
+
+	SRunner *runner = srunner_create(suite);
+
+	srunner_run_all(runner, CK_VERBOSE);
+	int failed = srunner_ntests_failed(runner);
+
+	srunner_free(runner);
+
+	return failed;
+}
@@ -0,0 +1,131 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <check.h>
+
+#include <Objectively.h>
+
+START_TEST(deque)
+	{
+		MutableDeque *deque = $$(MutableDeque, deque);
+
+		ck_assert(deque != NULL);
+		ck_assert_ptr_eq(&_MutableDeque, classof(deque));
+		ck_assert_ptr_eq(NULL, $(deque, popFirstObject));
+		ck_assert_ptr_eq(NULL, $(deque, popLastObject));
+
+		Number *numbers[100];
+		for (int i = 0; i < 100; i++) {
+			numbers[i] = $$(Number, numberWithValue, i);
+		}
+
+		for (int i = 0; i < 50; i++) {
+			$(deque, pushLastObject, numbers[50 + i]);
+			$(deque, pushFirstObject, numbers[49 - i]);
+		}
+
+		const Deque *d = (Deque *) deque;
+
+		ck_assert_int_eq(100, d->count);
+		ck_assert_int_eq(2, ((Object *) numbers[0])->referenceCount);
+
+		for (int i = 0; i < 100; i++) {
+			ck_assert_ptr_eq(numbers[i], $(d, objectAtIndex, i));
+		}
+
+		ck_assert_ptr_eq(numbers[0], $(d, firstObject));
+		ck_assert_ptr_eq(numbers[99], $(d, lastObject));
+		ck_assert_int_eq(42, $(d, indexOfObject, numbers[42]));
+
+		Number *first = $(deque, popFirstObject);
+		Number *last = $(deque, popLastObject);
+
+		ck_assert_ptr_eq(numbers[0], first);
+		ck_assert_ptr_eq(numbers[99], last);
+
+		release(first);
+		release(last);
+
+		$(deque, removeObjectAtIndex, 2);
+		$(deque, removeObjectAtIndex, 90);
+		$(deque, removeObject, numbers[50]);
+
+		ck_assert_int_eq(95, d->count);
+		ck_assert(!$(d, containsObject, numbers[3]));
+		ck_assert(!$(d, containsObject, numbers[92]));
+		ck_assert(!$(d, containsObject, numbers[50]));
+		ck_assert_int_eq(1, ((Object *) numbers[3])->referenceCount);
+		ck_assert_ptr_eq(numbers[4], $(d, objectAtIndex, 2));
+		ck_assert_ptr_eq(numbers[93], $(d, objectAtIndex, 89));
+
+		Deque *copy = (Deque *) $((Object *) deque, copy);
+		ck_assert($((Object *) deque, isEqual, (Object *) copy));
+
+		Array *array = $(deque, drainObjects, 10);
+
+		ck_assert_int_eq(10, array->count);
+		ck_assert_int_eq(85, d->count);
+		ck_assert_ptr_eq(numbers[1], $(array, objectAtIndex, 0));
+		ck_assert_ptr_eq(numbers[12], $(d, firstObject));
+
+		release(array);
+
+		Array *all = $(d, allObjects);
+		Deque *fromArray = $$(Deque, dequeWithArray, all);
+
+		ck_assert($((Object *) deque, isEqual, (Object *) fromArray));
+		ck_assert(!$((Object *) deque, isEqual, (Object *) copy));
+
+		release(fromArray);
+		release(all);
+		release(copy);
+
+		$(deque, removeAllObjects);
+		ck_assert_int_eq(0, d->count);
+
+		for (int i = 0; i < 100; i++) {
+			ck_assert_int_eq(1, ((Object *) numbers[i])->referenceCount);
+			release(numbers[i]);
+		}
+
+		release(deque);
+
+	}END_TEST
+
+int main(int argc, char **argv) {
+
+	TCase *tcase = tcase_create("deque");
+	tcase_add_test(tcase, deque);
+
+	Suite *suite = suite_create("deque");
+	suite_add_tcase(suite, tcase);
+
+	SRunner *runner = srunner_create(suite);
+
+	srunner_run_all(runner, CK_VERBOSE);
+	int failed = srunner_ntests_failed(runner);
+
+	srunner_free(runner);
+
+	return failed;
+}
@@ -85,10 +85,46 @@ START_TEST(dictionary)
 
 	}END_TEST
 
+START_TEST(iterator)
+	{
+		Dictionary *dictionary = $$(Dictionary, dictionaryWithObjectsAndKeys,
+				$$(Number, numberWithValue, 1), $$(String, stringWithCharacters, "one"),
+				$$(Number, numberWithValue, 2), $$(String, stringWithCharacters, "two"),
+				$$(Number, numberWithValue, 3), $$(String, stringWithCharacters, "three"), NULL);
+
+		String *key;
+		Number *number;
+		double sum = 0;
+		size_t count = 0;
+
+		DictionaryForEach(key, number, dictionary) {
+			ck_assert_ptr_eq(number, $(dictionary, objectForKey, key));
+			sum += number->value;
+			count++;
+		}
+
+		ck_assert_int_eq(3, count);
+		ck_assert_int_eq(6, (int) sum);
+
+		DictionaryIterator iterator = MakeDictionaryIterator(dictionary);
+		while (DictionaryIteratorNext(&iterator, NULL, (ident *) &number)) {
+			release(number);
+		}
+
+		iterator = MakeDictionaryIterator(dictionary);
+		while (DictionaryIteratorNext(&iterator, (ident *) &key, NULL)) {
+			release(key);
+		}
+
+		release(dictionary);
+
+	}END_TEST
+
 int main(int argc, char **argv) {
 
 	TCase *tcase = tcase_create("dictionary");
 	tcase_add_test(tcase, dictionary);
+	tcase_add_test(tcase, iterator);
 
 	Suite *suite = suite_create("dictionary");
 	suite_add_tcase(suite, tcase);
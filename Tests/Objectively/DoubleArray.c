@@ -0,0 +1,120 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <check.h>
+
+#include <Objectively.h>
+
+START_TEST(doubleArray)
+	{
+		double values[37];
+		for (size_t i = 0; i < lengthof(values); i++) {
+			values[i] = i * 0.5;
+		}
+
+		values[29] = -3.0;
+
+		DoubleArray *array = $$(DoubleArray, arrayWithValues, values, lengthof(values));
+		ck_assert(array != NULL);
+		ck_assert_ptr_eq(&_DoubleArray, classof(array));
+		ck_assert_str_eq("DoubleArray", classof(array)->name);
+		ck_assert_int_eq(lengthof(values), array->count);
+
+		double sum = 0.0, dot = 0.0;
+		for (size_t i = 0; i < lengthof(values); i++) {
+			sum += values[i];
+			dot += values[i] * values[i];
+		}
+
+		ck_assert($(array, sum) == sum);
+		ck_assert($(array, dot, array) == dot);
+		ck_assert($(array, minValue) == -3.0);
+		ck_assert($(array, maxValue) == 18.0);
+
+		ck_assert_int_eq(0, $(array, indexOfValue, 0.0));
+		ck_assert_int_eq(29, $(array, indexOfValue, -3.0));
+		ck_assert_int_eq(36, $(array, indexOfValue, 18.0));
+		ck_assert_int_eq(-1, $(array, indexOfValue, 0.25));
+
+		DoubleArray *scaled = $(array, scaledArray, 2.0);
+		for (size_t i = 0; i < lengthof(values); i++) {
+			ck_assert($(scaled, valueAtIndex, (int) i) == values[i] * 2.0);
+		}
+
+		ck_assert($(scaled, sum) == sum * 2.0);
+		release(scaled);
+
+		Array *numbers = $(array, numbers);
+		ck_assert_int_eq(lengthof(values), numbers->count);
+		ck_assert(((Number *) $(numbers, objectAtIndex, 29))->value == -3.0);
+
+		DoubleArray *copy = $$(DoubleArray, arrayWithArray, numbers);
+		ck_assert($((Object *) array, isEqual, (Object *) copy));
+		ck_assert_int_eq($((Object *) array, hash), $((Object *) copy, hash));
+
+		release(copy);
+		release(numbers);
+
+		MutableDoubleArray *mutableArray = $(array, mutableCopy);
+		ck_assert_ptr_eq(&_MutableDoubleArray, classof(mutableArray));
+		ck_assert_str_eq("MutableDoubleArray", classof(mutableArray)->name);
+		ck_assert($((Object *) array, isEqual, (Object *) mutableArray));
+
+		$(mutableArray, addValue, 100.0);
+		ck_assert($((DoubleArray *) mutableArray, maxValue) == 100.0);
+
+		$(mutableArray, removeValueAtIndex, 29);
+		ck_assert($((DoubleArray *) mutableArray, minValue) == 0.0);
+		ck_assert_int_eq(-1, $((DoubleArray *) mutableArray, indexOfValue, -3.0));
+
+		$(mutableArray, setValueAtIndex, -1.0, 0);
+		$(mutableArray, scale, -1.0);
+		ck_assert($((DoubleArray *) mutableArray, valueAtIndex, 0) == 1.0);
+		ck_assert($((DoubleArray *) mutableArray, minValue) == -100.0);
+
+		$(mutableArray, removeAllValues);
+		ck_assert_int_eq(0, ((DoubleArray *) mutableArray)->count);
+		ck_assert($((DoubleArray *) mutableArray, sum) == 0.0);
+
+		release(mutableArray);
+		release(array);
+
+	}END_TEST
+
+int main(int argc, char **argv) {
+
+	TCase *tcase = tcase_create("doubleArray");
+	tcase_add_test(tcase, doubleArray);
+
+	Suite *suite = suite_create("doubleArray");
+	suite_add_tcase(suite, tcase);
+
+	SRunner *runner = srunner_create(suite);
+
+	srunner_run_all(runner, CK_VERBOSE);
+	int failed = srunner_ntests_failed(runner);
+
+	srunner_free(runner);
+
+	return failed;
+}
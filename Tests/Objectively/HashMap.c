@@ -0,0 +1,146 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <check.h>
+
+#include <Objectively.h>
+
+DECLARE_HASHMAP(Counts, int64_t, int, HashMapHashInteger, HashMapEqualIntegers);
+
+/**
+ * @brief A deliberately poor hash, to exercise long probe sequences and backward shifting.
+ */
+static size_t collide(int64_t key) {
+	return (size_t) (key % 7);
+}
+
+DECLARE_HASHMAP(Collisions, int64_t, int64_t, collide, HashMapEqualIntegers);
+
+START_TEST(hashMap)
+	{
+		Counts counts = { 0 };
+
+		ck_assert_ptr_eq(NULL, CountsGet(&counts, 1));
+		ck_assert(!CountsRemove(&counts, 1));
+
+		for (int64_t i = 0; i < 10000; i++) {
+			const int64_t key = i % 1000;
+			int *count = CountsGet(&counts, key);
+			CountsSet(&counts, key, count ? *count + 1 : 1);
+		}
+
+		ck_assert_int_eq(1000, counts.count);
+
+		for (int64_t i = 0; i < 1000; i++) {
+			ck_assert_int_eq(10, *CountsGet(&counts, i));
+		}
+
+		for (int64_t i = 0; i < 1000; i += 2) {
+			ck_assert(CountsRemove(&counts, i));
+		}
+
+		ck_assert_int_eq(500, counts.count);
+
+		size_t index = 0, found = 0;
+		for (CountsEntry *entry; (entry = CountsNext(&counts, &index)); found++) {
+			ck_assert(entry->key & 1);
+		}
+
+		ck_assert_int_eq(500, found);
+
+		CountsClear(&counts);
+		ck_assert_int_eq(0, counts.count);
+		ck_assert_ptr_eq(NULL, CountsGet(&counts, 1));
+
+		CountsFree(&counts);
+
+		Collisions collisions = { 0 };
+
+		for (int64_t i = 0; i < 200; i++) {
+			CollisionsSet(&collisions, i, i * i);
+		}
+
+		for (int64_t i = 0; i < 200; i += 3) {
+			ck_assert(CollisionsRemove(&collisions, i));
+		}
+
+		for (int64_t i = 0; i < 200; i++) {
+			int64_t *value = CollisionsGet(&collisions, i);
+			if (i % 3) {
+				ck_assert(value != NULL);
+				ck_assert(*value == i * i);
+			} else {
+				ck_assert_ptr_eq(NULL, value);
+			}
+		}
+
+		CollisionsFree(&collisions);
+
+	}END_TEST
+
+DECLARE_VECTOR(IntVector, int);
+
+START_TEST(vector)
+	{
+		IntVector vector = { 0 };
+
+		for (int i = 0; i < 100; i++) {
+			IntVectorPush(&vector, i);
+		}
+
+		ck_assert_int_eq(100, vector.count);
+		ck_assert_int_eq(99, IntVectorPop(&vector));
+
+		IntVectorSwapRemove(&vector, 0);
+		ck_assert_int_eq(98, vector.count);
+		ck_assert_int_eq(98, vector.elements[0]);
+
+		IntVectorClear(&vector);
+		ck_assert_int_eq(0, vector.count);
+
+		IntVectorReserve(&vector, 1000);
+		ck_assert(vector.capacity >= 1000);
+
+		IntVectorFree(&vector);
+		ck_assert_ptr_eq(NULL, vector.elements);
+
+	}END_TEST
+
+int main(int argc, char **argv) {
+
+	TCase *tcase = tcase_create("hashMap");
+	tcase_add_test(tcase, hashMap);
+	tcase_add_test(tcase, vector);
+
+	Suite *suite = suite_create("hashMap");
+	suite_add_tcase(suite, tcase);
+
+	SRunner *runner = srunner_create(suite);
+
+	srunner_run_all(runner, CK_VERBOSE);
+	int failed = srunner_ntests_failed(runner);
+
+	srunner_free(runner);
+
+	return failed;
+}
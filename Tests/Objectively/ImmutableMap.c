@@ -0,0 +1,234 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <check.h>
+
+#include <Objectively.h>
+
+START_TEST(immutableMap)
+	{
+		ImmutableMap *empty = alloc(ImmutableMap, init);
+
+		ck_assert(empty != NULL);
+		ck_assert_ptr_eq(&_ImmutableMap, classof(empty));
+		ck_assert_int_eq(0, empty->count);
+
+		String *keys[1000];
+		Number *objects[1000];
+
+		for (int i = 0; i < 1000; i++) {
+			keys[i] = $$(String, stringWithFormat, "%d", i);
+			objects[i] = $$(Number, numberWithValue, i);
+		}
+
+		ImmutableMap *versions[1001];
+		versions[0] = empty;
+
+		for (int i = 0; i < 1000; i++) {
+			versions[i + 1] = $(versions[i], setObjectForKey, objects[i], keys[i]);
+		}
+
+		for (int i = 0; i <= 1000; i += 100) {
+
+			ck_assert_int_eq(i, versions[i]->count);
+
+			for (int j = 0; j < 1000; j++) {
+				const ident obj = $(versions[i], objectForKey, keys[j]);
+				ck_assert_ptr_eq(j < i ? objects[j] : NULL, obj);
+			}
+		}
+
+		ImmutableMap *map = versions[1000];
+
+		ck_assert_int_eq(_ImmutableMap.instanceSize, $((Object *) empty, sizeInBytes));
+		ck_assert($((Object *) map, sizeInBytes) > $((Object *) versions[100], sizeInBytes));
+		ck_assert($((Object *) map, deepSizeInBytes) > $((Object *) map, sizeInBytes));
+
+		ImmutableMap *replaced = $(map, setObjectForKey, objects[1], keys[0]);
+		ck_assert_int_eq(1000, replaced->count);
+		ck_assert_ptr_eq(objects[1], $(replaced, objectForKey, keys[0]));
+		ck_assert_ptr_eq(objects[0], $(map, objectForKey, keys[0]));
+
+		ImmutableMap *removed = $(map, removeObjectForKey, keys[500]);
+		ck_assert_int_eq(999, removed->count);
+		ck_assert_ptr_eq(NULL, $(removed, objectForKey, keys[500]));
+		ck_assert_ptr_eq(objects[500], $(map, objectForKey, keys[500]));
+		ck_assert_ptr_eq(objects[501], $(removed, objectForKey, keys[501]));
+
+		ImmutableMap *restored = $(removed, setObjectForKey, objects[500], keys[500]);
+		ck_assert($((Object *) restored, isEqual, (Object *) map));
+		ck_assert_int_eq($((Object *) restored, hash), $((Object *) map, hash));
+		ck_assert(!$((Object *) replaced, isEqual, (Object *) map));
+
+		ImmutableMap *drained = retain(map);
+		for (int i = 0; i < 1000; i++) {
+			ImmutableMap *next = $(drained, removeObjectForKey, keys[i]);
+			release(drained);
+			drained = next;
+		}
+
+		ck_assert_int_eq(0, drained->count);
+		ck_assert($((Object *) drained, isEqual, (Object *) empty));
+
+		release(drained);
+		release(restored);
+		release(removed);
+		release(replaced);
+
+		for (int i = 0; i <= 1000; i++) {
+			release(versions[i]);
+		}
+
+		for (int i = 0; i < 1000; i++) {
+			ck_assert_int_eq(1, ((Object *) keys[i])->referenceCount);
+			ck_assert_int_eq(1, ((Object *) objects[i])->referenceCount);
+			release(keys[i]);
+			release(objects[i]);
+		}
+
+	}END_TEST
+
+START_TEST(transient)
+	{
+		ImmutableMap *map = alloc(ImmutableMap, init);
+		ImmutableMap *transient = $(map, transientCopy);
+
+		ck_assert(transient->isTransient);
+
+		Number *numbers[500];
+		for (int i = 0; i < 500; i++) {
+			numbers[i] = $$(Number, numberWithValue, i);
+			$(transient, transientSetObjectForKey, numbers[i], numbers[i]);
+		}
+
+		ck_assert_int_eq(500, transient->count);
+		ck_assert_int_eq(0, map->count);
+
+		ImmutableMap *snapshot = $(transient, persistentCopy);
+		ck_assert(!snapshot->isTransient);
+
+		for (int i = 0; i < 250; i++) {
+			$(transient, transientRemoveObjectForKey, numbers[i]);
+		}
+
+		ck_assert_int_eq(250, transient->count);
+		ck_assert_int_eq(500, snapshot->count);
+
+		for (int i = 0; i < 500; i++) {
+			ck_assert_ptr_eq(numbers[i], $(snapshot, objectForKey, numbers[i]));
+			ck_assert_ptr_eq(i < 250 ? NULL : numbers[i], $(transient, objectForKey, numbers[i]));
+		}
+
+		release(snapshot);
+		release(transient);
+		release(map);
+
+		for (int i = 0; i < 500; i++) {
+			ck_assert_int_eq(1, ((Object *) numbers[i])->referenceCount);
+			release(numbers[i]);
+		}
+
+	}END_TEST
+
+START_TEST(collisions)
+	{
+		ImmutableMap *map = alloc(ImmutableMap, init);
+
+		Number *keys[10];
+		for (int i = 0; i < 10; i++) {
+			keys[i] = $$(Number, numberWithValue, 1.0 + i * 0.05);
+			ck_assert_int_eq($((Object *) keys[0], hash), $((Object *) keys[i], hash));
+		}
+
+		for (int i = 0; i < 10; i++) {
+			ImmutableMap *next = $(map, setObjectForKey, keys[i], keys[i]);
+			release(map);
+			map = next;
+		}
+
+		ck_assert_int_eq(10, map->count);
+
+		for (int i = 0; i < 10; i += 2) {
+			ImmutableMap *next = $(map, removeObjectForKey, keys[i]);
+			release(map);
+			map = next;
+		}
+
+		ck_assert_int_eq(5, map->count);
+
+		for (int i = 0; i < 10; i++) {
+			ck_assert_ptr_eq(i & 1 ? keys[i] : NULL, $(map, objectForKey, keys[i]));
+		}
+
+		release(map);
+
+		for (int i = 0; i < 10; i++) {
+			ck_assert_int_eq(1, ((Object *) keys[i])->referenceCount);
+			release(keys[i]);
+		}
+
+	}END_TEST
+
+START_TEST(dictionary)
+	{
+		Dictionary *dictionary = $$(Dictionary, dictionaryWithObjectsAndKeys,
+									$$(Number, numberWithValue, 1), $$(String, stringWithCharacters, "one"),
+									$$(Number, numberWithValue, 2), $$(String, stringWithCharacters, "two"),
+									NULL);
+
+		ImmutableMap *map = $$(ImmutableMap, mapWithDictionary, dictionary);
+		ck_assert_int_eq(2, map->count);
+
+		Dictionary *converted = $(map, dictionary);
+		ck_assert($((Object *) converted, isEqual, (Object *) dictionary));
+
+		String *description = $((Object *) map, description);
+		ck_assert(strstr(description->chars, "one: 1") != NULL);
+
+		release(description);
+		release(converted);
+		release(map);
+		release(dictionary);
+
+	}END_TEST
+
+int main(int argc, char **argv) {
+
+	TCase *tcase = tcase_create("immutableMap");
+	tcase_add_test(tcase, immutableMap);
+	tcase_add_test(tcase, transient);
+	tcase_add_test(tcase, collisions);
+	tcase_add_test(tcase, dictionary);
+
+	Suite *suite = suite_create("immutableMap");
+	suite_add_tcase(suite, tcase);
+
+	SRunner *runner = srunner_create(suite);
+
+	srunner_run_all(runner, CK_VERBOSE);
+	int failed = srunner_ntests_failed(runner);
+
+	srunner_free(runner);
+
+	return failed;
+}
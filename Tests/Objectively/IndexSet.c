@@ -22,6 +22,7 @@
  */
 
 #include <check.h>
+#include <stdlib.h>
 
 #include <Objectively.h>
 
@@ -52,10 +53,252 @@ START_TEST(indexSet)
 
 	}END_TEST
 
+/**
+ * @brief The domain of indexes exercised by the algebra test, which spans several containers.
+ */
+#define DOMAIN_MIN -100000
+#define DOMAIN_MAX 200000
+
+/**
+ * @return A new IndexSet containing `members`, which span `[DOMAIN_MIN, DOMAIN_MAX)`.
+ */
+static IndexSet *indexSetWithMembers(const _Bool *members) {
+
+	MutableIndexSet *indexSet = alloc(MutableIndexSet, init);
+
+	for (int i = DOMAIN_MIN; i < DOMAIN_MAX; i++) {
+		if (members[i - DOMAIN_MIN]) {
+			$(indexSet, addIndex, i);
+		}
+	}
+
+	return (IndexSet *) indexSet;
+}
+
+/**
+ * @brief Asserts that `indexSet` contains exactly `members`.
+ */
+static void assertMembers(const IndexSet *indexSet, const _Bool *members) {
+
+	size_t count = 0;
+	for (int i = DOMAIN_MIN; i < DOMAIN_MAX; i++) {
+		ck_assert_int_eq(members[i - DOMAIN_MIN], $(indexSet, containsIndex, i));
+		count += members[i - DOMAIN_MIN];
+	}
+
+	ck_assert_int_eq(count, indexSet->count);
+}
+
+START_TEST(algebra)
+	{
+		const size_t size = DOMAIN_MAX - DOMAIN_MIN;
+
+		_Bool *a = calloc(size, sizeof(_Bool));
+		_Bool *b = calloc(size, sizeof(_Bool));
+		_Bool *c = calloc(size, sizeof(_Bool));
+
+		srand(1);
+
+		for (size_t i = 0; i < size; i++) {
+			if (i < 70000) {
+				a[i] = rand() % 2;
+				b[i] = rand() % 3 == 0;
+			} else if (i < 140000) {
+				a[i] = rand() % 100 == 0;
+				b[i] = i % 1000 < 500;
+			} else {
+				a[i] = i % 5000 < 4000;
+				b[i] = rand() % 50 == 0;
+			}
+		}
+
+		IndexSet *x = indexSetWithMembers(a);
+		IndexSet *y = indexSetWithMembers(b);
+
+		assertMembers(x, a);
+		assertMembers(y, b);
+
+		IndexSet *intersection = $(x, indexSetByIntersectingIndexSet, y);
+		for (size_t i = 0; i < size; i++) {
+			c[i] = a[i] && b[i];
+		}
+		assertMembers(intersection, c);
+
+		IndexSet *difference = $(x, indexSetBySubtractingIndexSet, y);
+		for (size_t i = 0; i < size; i++) {
+			c[i] = a[i] && !b[i];
+		}
+		assertMembers(difference, c);
+
+		IndexSet *union_ = $(x, indexSetByUnioningIndexSet, y);
+		for (size_t i = 0; i < size; i++) {
+			c[i] = a[i] || b[i];
+		}
+		assertMembers(union_, c);
+
+		IndexSet *copy = (IndexSet *) $((Object *) union_, copy);
+		ck_assert($((Object *) union_, isEqual, (Object *) copy));
+		ck_assert_int_eq($((Object *) union_, hash), $((Object *) copy, hash));
+
+		MutableIndexSet *mutable = $(x, mutableCopy);
+		$(mutable, unionWithIndexSet, y);
+		ck_assert($((Object *) union_, isEqual, (Object *) mutable));
+
+		$(mutable, minusIndexSet, y);
+		ck_assert($((Object *) difference, isEqual, (Object *) mutable));
+
+		release(mutable);
+		release(copy);
+		release(union_);
+		release(difference);
+		release(intersection);
+		release(y);
+		release(x);
+
+		free(c);
+		free(b);
+		free(a);
+
+	}END_TEST
+
+/**
+ * @brief IndexSetRangeEnumerator for ranges.
+ */
+static _Bool ranges_enumerator(const IndexSet *indexSet, const Range range, ident data) {
+
+	MutableString *string = data;
+
+	$(string, appendFormat, "(%d,%d)", range.location, range.length);
+	return false;
+}
+
+START_TEST(ranges)
+	{
+		int indexes[] = { -2, -1, 0, 1, 5, 65534, 65535, 65536, 65537 };
+		IndexSet *indexSet = alloc(IndexSet, initWithIndexes, indexes, lengthof(indexes));
+
+		MutableString *string = $$(MutableString, string);
+		$(indexSet, enumerateRanges, ranges_enumerator, string);
+		ck_assert_str_eq("(-2,4)(5,1)(65534,4)", string->string.chars);
+
+		ck_assert_int_eq(-2, $(indexSet, firstIndex));
+		ck_assert_int_eq(65537, $(indexSet, lastIndex));
+
+		ck_assert_int_eq(9, $(indexSet, countOfIndexesInRange, (const Range) { -10, 100000 }));
+		ck_assert_int_eq(3, $(indexSet, countOfIndexesInRange, (const Range) { -1, 3 }));
+		ck_assert_int_eq(2, $(indexSet, countOfIndexesInRange, (const Range) { 65535, 2 }));
+		ck_assert_int_eq(0, $(indexSet, countOfIndexesInRange, (const Range) { 2, 3 }));
+
+		IndexSet *range = alloc(IndexSet, initWithIndexesInRange, (const Range) { -70000, 200000 });
+		ck_assert_int_eq(200000, range->count);
+		ck_assert($(range, containsIndex, -70000));
+		ck_assert($(range, containsIndex, 129999));
+		ck_assert(!$(range, containsIndex, 130000));
+		ck_assert_int_eq(100, $(range, countOfIndexesInRange, (const Range) { -50, 100 }));
+
+		release(string);
+		string = $$(MutableString, string);
+
+		$(range, enumerateRanges, ranges_enumerator, string);
+		ck_assert_str_eq("(-70000,200000)", string->string.chars);
+
+		IndexSet *intersection = $(range, indexSetByIntersectingIndexSet, indexSet);
+		ck_assert($((Object *) intersection, isEqual, (Object *) indexSet));
+
+		release(intersection);
+		release(range);
+		release(string);
+		release(indexSet);
+
+	}END_TEST
+
+START_TEST(mutableIndexSet)
+	{
+		MutableIndexSet *indexSet = alloc(MutableIndexSet, init);
+
+		for (int i = 0; i < 10000; i += 2) {
+			$(indexSet, addIndex, i);
+		}
+
+		ck_assert_int_eq(5000, indexSet->indexSet.count);
+		ck_assert($((IndexSet *) indexSet, containsIndex, 9998));
+		ck_assert(!$((IndexSet *) indexSet, containsIndex, 9999));
+
+		for (int i = 0; i < 10000; i += 4) {
+			$(indexSet, removeIndex, i);
+		}
+
+		ck_assert_int_eq(2500, indexSet->indexSet.count);
+		ck_assert(!$((IndexSet *) indexSet, containsIndex, 0));
+		ck_assert($((IndexSet *) indexSet, containsIndex, 2));
+
+		$(indexSet, addIndexesInRange, (const Range) { 0, 10000 });
+		ck_assert_int_eq(10000, indexSet->indexSet.count);
+
+		$(indexSet, removeIndex, 5000);
+		ck_assert_int_eq(9999, indexSet->indexSet.count);
+		ck_assert(!$((IndexSet *) indexSet, containsIndex, 5000));
+
+		$(indexSet, removeIndexesInRange, (const Range) { 100, 9900 });
+		ck_assert_int_eq(100, indexSet->indexSet.count);
+
+		const int indexes[] = { -5, 7, 100000 };
+		$(indexSet, addIndexes, indexes, lengthof(indexes));
+		ck_assert_int_eq(102, indexSet->indexSet.count);
+		ck_assert_int_eq(-5, $((IndexSet *) indexSet, firstIndex));
+		ck_assert_int_eq(100000, $((IndexSet *) indexSet, lastIndex));
+
+		$(indexSet, removeAllIndexes);
+		ck_assert_int_eq(0, indexSet->indexSet.count);
+
+		$(indexSet, addIndex, 1);
+		ck_assert_int_eq(1, indexSet->indexSet.count);
+
+		release(indexSet);
+
+	}END_TEST
+
+START_TEST(trimToSize)
+	{
+		MutableIndexSet *indexSet = alloc(MutableIndexSet, initWithCapacity, 16);
+
+		for (int i = 0; i < 10000; i += 2) {
+			$(indexSet, addIndex, i);
+		}
+
+		for (int i = 0; i < 8000; i += 2) {
+			$(indexSet, removeIndex, i);
+		}
+
+		ck_assert_int_eq(IndexSetContainerBitmap, indexSet->indexSet.containers[0].type);
+
+		const size_t size = $((Object *) indexSet, sizeInBytes);
+
+		$(indexSet, trimToSize);
+		ck_assert_int_lt($((Object *) indexSet, sizeInBytes), size);
+		ck_assert_int_eq(IndexSetContainerArray, indexSet->indexSet.containers[0].type);
+		ck_assert_int_eq(indexSet->indexSet.containerCount, indexSet->capacity);
+
+		ck_assert_int_eq(1000, indexSet->indexSet.count);
+		ck_assert(!$((IndexSet *) indexSet, containsIndex, 7998));
+		ck_assert($((IndexSet *) indexSet, containsIndex, 8000));
+		ck_assert(!$((IndexSet *) indexSet, containsIndex, 8001));
+		ck_assert($((IndexSet *) indexSet, containsIndex, 9998));
+
+		$(indexSet, addIndex, 0);
+		ck_assert_int_eq(1001, indexSet->indexSet.count);
+
+		release(indexSet);
+	}END_TEST
+
 int main(int argc, char **argv) {
 
 	TCase *tcase = tcase_create("indexSet");
 	tcase_add_test(tcase, indexSet);
+	tcase_add_test(tcase, algebra);
+	tcase_add_test(tcase, ranges);
+	tcase_add_test(tcase, mutableIndexSet);
+	tcase_add_test(tcase, trimToSize);
 
 	Suite *suite = suite_create("indexSet");
 	suite_add_tcase(suite, tcase);
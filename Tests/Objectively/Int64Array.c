@@ -0,0 +1,85 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <check.h>
+#include <string.h>
+
+#include <Objectively.h>
+
+START_TEST(int64Array)
+	{
+		int64_t values[19];
+		for (size_t i = 0; i < lengthof(values); i++) {
+			values[i] = ((int64_t) 1 << 40) + i;
+		}
+
+		Int64Array *array = $$(Int64Array, arrayWithValues, values, lengthof(values));
+		ck_assert(array != NULL);
+		ck_assert_ptr_eq(&_Int64Array, classof(array));
+		ck_assert_str_eq("Int64Array", classof(array)->name);
+
+		ck_assert($(array, sum) == 19 * ((int64_t) 1 << 40) + 171);
+		ck_assert($(array, minValue) == values[0]);
+		ck_assert($(array, maxValue) == values[18]);
+		ck_assert_int_eq(17, $(array, indexOfValue, values[17]));
+		ck_assert_int_eq(-1, $(array, indexOfValue, 0));
+
+		MutableInt64Array *mutableArray = $(array, mutableCopy);
+		$(mutableArray, scale, -1);
+
+		ck_assert($((Int64Array *) mutableArray, maxValue) == -values[0]);
+		int64_t signs[lengthof(values)];
+		for (size_t i = 0; i < lengthof(signs); i++) {
+			signs[i] = i & 1 ? -1 : 1;
+		}
+
+		Int64Array *signArray = $$(Int64Array, arrayWithValues, signs, lengthof(signs));
+		ck_assert($(array, dot, signArray) == ((int64_t) 1 << 40) + 9);
+		release(signArray);
+
+		String *desc = $((Object *) mutableArray, description);
+		ck_assert(strncmp("[-1099511627776, -1099511627777, ", desc->chars, 33) == 0);
+
+		release(desc);
+		release(mutableArray);
+		release(array);
+
+	}END_TEST
+
+int main(int argc, char **argv) {
+
+	TCase *tcase = tcase_create("int64Array");
+	tcase_add_test(tcase, int64Array);
+
+	Suite *suite = suite_create("int64Array");
+	suite_add_tcase(suite, tcase);
+
+	SRunner *runner = srunner_create(suite);
+
+	srunner_run_all(runner, CK_VERBOSE);
+	int failed = srunner_ntests_failed(runner);
+
+	srunner_free(runner);
+
+	return failed;
+}
@@ -0,0 +1,92 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <check.h>
+
+#include <Objectively.h>
+
+START_TEST(intArray)
+	{
+		MutableIntArray *mutableArray = $$(MutableIntArray, arrayWithCapacity, 0);
+		ck_assert(mutableArray != NULL);
+		ck_assert_ptr_eq(&_MutableIntArray, classof(mutableArray));
+		ck_assert_str_eq("MutableIntArray", classof(mutableArray)->name);
+		ck_assert_str_eq("IntArray", classof(mutableArray)->superclass->name);
+
+		int64_t sum = 0;
+		for (int i = 0; i < 1000; i++) {
+			$(mutableArray, addValue, i - 500);
+			sum += i - 500;
+		}
+
+		const IntArray *array = (IntArray *) mutableArray;
+
+		ck_assert_int_eq(1000, array->count);
+		ck_assert_int_eq(sum, $(array, sum));
+		ck_assert_int_eq(-500, $(array, minValue));
+		ck_assert_int_eq(499, $(array, maxValue));
+		ck_assert_int_eq(500, $(array, indexOfValue, 0));
+		ck_assert_int_eq(-1, $(array, indexOfValue, 500));
+
+		const int big[] = { 1 << 30, 1 << 30, 1 << 30, 1 << 30, 1 << 30 };
+		IntArray *bigs = $$(IntArray, arrayWithValues, big, lengthof(big));
+
+		ck_assert($(bigs, sum) == 5 * (int64_t) (1 << 30));
+		ck_assert($(bigs, dot, bigs) == 5 * (int64_t) (1 << 30) * (1 << 30));
+
+		release(bigs);
+
+		IntArray *scaled = $(array, scaledArray, 3);
+		ck_assert_int_eq(sum * 3, $(scaled, sum));
+		ck_assert_int_eq(-1500, $(scaled, valueAtIndex, 0));
+
+		Array *numbers = $(scaled, numbers);
+		IntArray *copy = $$(IntArray, arrayWithArray, numbers);
+
+		ck_assert($((Object *) scaled, isEqual, (Object *) copy));
+		ck_assert(!$((Object *) array, isEqual, (Object *) copy));
+
+		release(copy);
+		release(numbers);
+		release(scaled);
+		release(mutableArray);
+
+	}END_TEST
+
+int main(int argc, char **argv) {
+
+	TCase *tcase = tcase_create("intArray");
+	tcase_add_test(tcase, intArray);
+
+	Suite *suite = suite_create("intArray");
+	suite_add_tcase(suite, tcase);
+
+	SRunner *runner = srunner_create(suite);
+
+	srunner_run_all(runner, CK_VERBOSE);
+	int failed = srunner_ntests_failed(runner);
+
+	srunner_free(runner);
+
+	return failed;
+}
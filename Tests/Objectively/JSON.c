@@ -22,6 +22,7 @@
  */
 
 #include <check.h>
+#include <string.h>
 
 #include <Objectively.h>
 
@@ -59,6 +60,94 @@ START_TEST(json)
 
 	}END_TEST
 
+START_TEST(primitiveArrays)
+	{
+		const char *json = "{\"integers\": [1, -2, 3], \"decimals\": [1, 2.5, -3e2], \"mixed\": [1, \"two\"], \"empty\": []}";
+		Data *data = $$(Data, dataWithBytes, (uint8_t *) json, strlen(json));
+
+		Dictionary *dict = $$(JSONSerialization, objectFromData, data, JSON_READ_PRIMITIVE_ARRAYS);
+		ck_assert_int_eq(4, dict->count);
+
+		const Int64Array *integers = $(dict, objectForKeyPath, "integers");
+		ck_assert($((Object *) integers, isKindOfClass, &_Int64Array));
+		ck_assert_int_eq(3, integers->count);
+		ck_assert(2 == $(integers, sum));
+
+		const DoubleArray *decimals = $(dict, objectForKeyPath, "decimals");
+		ck_assert($((Object *) decimals, isKindOfClass, &_DoubleArray));
+		ck_assert_int_eq(3, decimals->count);
+		ck_assert(-296.5 == $(decimals, sum));
+
+		const Array *mixed = $(dict, objectForKeyPath, "mixed");
+		ck_assert($((Object *) mixed, isKindOfClass, &_Array));
+		ck_assert_int_eq(2, mixed->count);
+
+		const Array *empty = $(dict, objectForKeyPath, "empty");
+		ck_assert($((Object *) empty, isKindOfClass, &_Array));
+		ck_assert_int_eq(0, empty->count);
+
+		release(data);
+		data = $$(JSONSerialization, dataFromObject, dict, 0);
+
+		Dictionary *copy = $$(JSONSerialization, objectFromData, data, JSON_READ_PRIMITIVE_ARRAYS);
+		ck_assert($((Object *) dict, isEqual, (Object *) copy));
+
+		release(copy);
+		release(data);
+		release(dict);
+
+	}END_TEST
+
+START_TEST(internKeys)
+	{
+		const char *json = "[{\"name\": \"a\", \"value\": 1}, {\"name\": \"b\", \"value\": 2}]";
+		Data *data = $$(Data, dataWithBytes, (uint8_t *) json, strlen(json));
+
+		Array *array = $$(JSONSerialization, objectFromData, data, JSON_READ_INTERN_KEYS);
+		ck_assert_int_eq(2, array->count);
+
+		const Dictionary *first = $(array, objectAtIndex, 0);
+		const Dictionary *second = $(array, objectAtIndex, 1);
+
+		Array *firstKeys = $(first, allKeys);
+		Array *secondKeys = $(second, allKeys);
+
+		for (size_t i = 0; i < firstKeys->count; i++) {
+			const String *key = $(firstKeys, objectAtIndex, i);
+			ck_assert(key->isInterned);
+			ck_assert($(secondKeys, containsObject, (ident) key));
+			ck_assert_ptr_eq(key, $$(String, internedStringWithCharacters, key->chars, key->length));
+		}
+
+		ck_assert_str_eq("b", ((String *) $(second, objectForKeyPath, "name"))->chars);
+
+		release(secondKeys);
+		release(firstKeys);
+		release(array);
+		release(data);
+
+	}END_TEST
+
+START_TEST(validateUTF8)
+	{
+		const char *valid = "{\"caf\xc3\xa9\": \"cr\xc3\xa8me\"}";
+		Data *data = $$(Data, dataWithBytes, (uint8_t *) valid, strlen(valid));
+
+		Dictionary *dict = $$(JSONSerialization, objectFromData, data, JSON_READ_VALIDATE_UTF8);
+		ck_assert_str_eq("crème", ((String *) $(dict, objectForKeyPath, "café"))->chars);
+
+		release(dict);
+		release(data);
+
+		const char *invalid = "{\"caf\xc3\": \"cr\xc3\xa8me\"}";
+		data = $$(Data, dataWithBytes, (uint8_t *) invalid, strlen(invalid));
+
+		ck_assert_ptr_eq(NULL, $$(JSONSerialization, objectFromData, data, JSON_READ_VALIDATE_UTF8));
+
+		release(data);
+
+	}END_TEST
+
 int main(int argc, char **argv) {
 
 	if (argc == 2) {
@@ -69,6 +158,9 @@ int main(int argc, char **argv) {
 
 	TCase *tcase = tcase_create("json");
 	tcase_add_test(tcase, json);
+	tcase_add_test(tcase, primitiveArrays);
+	tcase_add_test(tcase, internKeys);
+	tcase_add_test(tcase, validateUTF8);
 
 	Suite *suite = suite_create("json");
 	suite_add_tcase(suite, tcase);
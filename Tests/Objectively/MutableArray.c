@@ -34,6 +34,10 @@ Order comparator(const ident obj1, const ident obj2) {
 	return $((Number *) obj1, compareTo, (Number *) obj2);
 }
 
+_Bool even(ident obj, ident data) {
+	return ($((Number *) obj, intValue) & 1) == 0;
+}
+
 START_TEST(mutableArray)
 	{
 		MutableArray *array = $$(MutableArray, array);
@@ -119,14 +123,93 @@ START_TEST(mutableArray)
 			previous = $(number, intValue);
 		}
 
+		$(array, removeAllObjects);
+
+		for (int i = 0; i < 10; i++) {
+
+			Number *number = $$(Number, numberWithValue, i);
+
+			$(array, addObject, number);
+
+			release(number);
+		}
+
+		ck_assert_int_eq(5, $(array, partition, even, NULL));
+
+		for (int i = 0; i < 10; i++) {
+			Number *number = $((Array *) array, objectAtIndex, i);
+			ck_assert_int_eq(i < 5 ? i * 2 : (i - 5) * 2 + 1, $(number, intValue));
+		}
+
+		$(array, filter, even, NULL);
+
+		ck_assert_int_eq(5, ((Array *) array)->count);
+
+		for (int i = 0; i < 5; i++) {
+			Number *number = $((Array *) array, objectAtIndex, i);
+			ck_assert_int_eq(i * 2, $(number, intValue));
+		}
+
+		int indexes[] = { 0, 2, 4 };
+		IndexSet *indexSet = alloc(IndexSet, initWithIndexes, indexes, lengthof(indexes));
+
+		$(array, removeObjectsAtIndexes, indexSet);
+
+		ck_assert_int_eq(2, ((Array *) array)->count);
+		ck_assert_int_eq(2, $((Number *) $((Array *) array, objectAtIndex, 0), intValue));
+		ck_assert_int_eq(6, $((Number *) $((Array *) array, objectAtIndex, 1), intValue));
+
+		release(indexSet);
+
+		$(array, removeObjectsPassingTest, even, NULL);
+
+		ck_assert_int_eq(0, ((Array *) array)->count);
+
 		release(array);
 
 	}END_TEST
 
+START_TEST(trimToSize)
+	{
+		MutableArray *array = $$(MutableArray, arrayWithCapacity, 64);
+
+		for (int i = 0; i < 8; i++) {
+			Number *number = $$(Number, numberWithValue, i);
+			$(array, addObject, number);
+			release(number);
+		}
+
+		const size_t size = $((Object *) array, sizeInBytes);
+		ck_assert_int_eq(_MutableArray.instanceSize + 64 * sizeof(ident), size);
+
+		$(array, trimToSize);
+		ck_assert_int_eq(8, array->capacity);
+		ck_assert_int_eq(_MutableArray.instanceSize + 8 * sizeof(ident), $((Object *) array, sizeInBytes));
+
+		const size_t deepSize = $((Object *) array, deepSizeInBytes);
+		ck_assert_int_eq(_MutableArray.instanceSize + 8 * sizeof(ident) + 8 * _Number.instanceSize, deepSize);
+
+		for (int i = 0; i < 8; i++) {
+			ck_assert_int_eq(i, $((Number *) $((Array *) array, objectAtIndex, i), intValue));
+		}
+
+		$(array, removeAllObjects);
+		$(array, trimToSize);
+		ck_assert_int_eq(0, array->capacity);
+		ck_assert_ptr_eq(NULL, array->array.elements);
+
+		$(array, addObject, array);
+		ck_assert_int_eq(1, array->array.count);
+		$(array, removeAllObjects);
+
+		release(array);
+	}END_TEST
+
 int main(int argc, char **argv) {
 
 	TCase *tcase = tcase_create("mutableArray");
 	tcase_add_test(tcase, mutableArray);
+	tcase_add_test(tcase, trimToSize);
 
 	Suite *suite = suite_create("mutableArray");
 	suite_add_tcase(suite, tcase);
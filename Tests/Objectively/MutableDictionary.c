@@ -33,7 +33,7 @@ START_TEST(mutableDictionary)
 		ck_assert_ptr_eq(&_MutableDictionary, classof(dict));
 
 		ck_assert_int_eq(0, ((Dictionary *) dict)->count);
-		ck_assert_int_eq(4, ((Dictionary *) dict)->capacity);
+		ck_assert_int_eq(0, ((Dictionary *) dict)->capacity);
 
 		Object *objectOne = alloc(Object, init);
 		Object *objectTwo = alloc(Object, init);
@@ -102,10 +102,103 @@ START_TEST(mutableDictionary)
 
 	}END_TEST
 
+START_TEST(inlineStorage)
+	{
+		MutableDictionary *dict = $$(MutableDictionary, dictionary);
+
+		Number *numbers[DICTIONARY_INLINE_CAPACITY * 2];
+		for (size_t i = 0; i < lengthof(numbers); i++) {
+			numbers[i] = $$(Number, numberWithValue, i);
+		}
+
+		for (size_t i = 0; i < DICTIONARY_INLINE_CAPACITY; i++) {
+			$(dict, setObjectForKey, numbers[i], numbers[i]);
+		}
+
+		ck_assert_ptr_eq(NULL, ((Dictionary *) dict)->elements);
+		ck_assert_int_eq(DICTIONARY_INLINE_CAPACITY, ((Dictionary *) dict)->count);
+
+		for (size_t i = 0; i < DICTIONARY_INLINE_CAPACITY; i += 2) {
+			$(dict, removeObjectForKey, numbers[i]);
+		}
+
+		ck_assert_int_eq(DICTIONARY_INLINE_CAPACITY / 2, ((Dictionary *) dict)->count);
+
+		for (size_t i = 0; i < DICTIONARY_INLINE_CAPACITY; i++) {
+			const ident obj = $((Dictionary *) dict, objectForKey, numbers[i]);
+			ck_assert_ptr_eq(i & 1 ? numbers[i] : NULL, obj);
+		}
+
+		Dictionary *copy = $$(Dictionary, dictionaryWithDictionary, (Dictionary *) dict);
+		ck_assert($((Object *) copy, isEqual, (Object *) dict));
+		ck_assert_int_eq($((Object *) copy, hash), $((Object *) dict, hash));
+		release(copy);
+
+		for (size_t i = 0; i < lengthof(numbers); i++) {
+			$(dict, setObjectForKey, numbers[i], numbers[i]);
+		}
+
+		ck_assert_ptr_ne(NULL, ((Dictionary *) dict)->elements);
+		ck_assert_int_eq(lengthof(numbers), ((Dictionary *) dict)->count);
+
+		for (size_t i = 0; i < lengthof(numbers); i++) {
+			ck_assert_ptr_eq(numbers[i], $((Dictionary *) dict, objectForKey, numbers[i]));
+			ck_assert_int_eq(3, ((Object *) numbers[i])->referenceCount);
+		}
+
+		release(dict);
+
+		for (size_t i = 0; i < lengthof(numbers); i++) {
+			ck_assert_int_eq(1, ((Object *) numbers[i])->referenceCount);
+			release(numbers[i]);
+		}
+
+	}END_TEST
+
+START_TEST(trimToSize)
+	{
+		MutableDictionary *dict = $$(MutableDictionary, dictionary);
+
+		Number *numbers[256];
+		for (size_t i = 0; i < lengthof(numbers); i++) {
+			numbers[i] = $$(Number, numberWithValue, i);
+			$(dict, setObjectForKey, numbers[i], numbers[i]);
+		}
+
+		const size_t size = $((Object *) dict, sizeInBytes);
+
+		$(dict, trimToSize);
+		ck_assert_int_lt($((Object *) dict, sizeInBytes), size);
+		ck_assert_int_eq(lengthof(numbers), ((Dictionary *) dict)->count);
+
+		for (size_t i = DICTIONARY_INLINE_CAPACITY; i < lengthof(numbers); i++) {
+			$(dict, removeObjectForKey, numbers[i]);
+		}
+
+		$(dict, trimToSize);
+		ck_assert_ptr_eq(NULL, ((Dictionary *) dict)->elements);
+		ck_assert_int_eq(0, ((Dictionary *) dict)->capacity);
+		ck_assert_int_eq(_MutableDictionary.instanceSize, $((Object *) dict, sizeInBytes));
+
+		for (size_t i = 0; i < lengthof(numbers); i++) {
+			const ident obj = $((Dictionary *) dict, objectForKey, numbers[i]);
+			ck_assert_ptr_eq(i < DICTIONARY_INLINE_CAPACITY ? numbers[i] : NULL, obj);
+		}
+
+		release(dict);
+
+		for (size_t i = 0; i < lengthof(numbers); i++) {
+			ck_assert_int_eq(1, ((Object *) numbers[i])->referenceCount);
+			release(numbers[i]);
+		}
+	}END_TEST
+
 int main(int argc, char **argv) {
 
 	TCase *tcase = tcase_create("mutableDictionary");
 	tcase_add_test(tcase, mutableDictionary);
+	tcase_add_test(tcase, inlineStorage);
+	tcase_add_test(tcase, trimToSize);
 
 	Suite *suite = suite_create("mutableDictionary");
 	suite_add_tcase(suite, tcase);
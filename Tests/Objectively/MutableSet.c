@@ -102,10 +102,162 @@ START_TEST(mutableSet)
 
 	}END_TEST
 
+/**
+ * @return A new MutableSet of the Numbers from `0` to `count` that are multiples of `step`.
+ */
+static MutableSet *multiples(int step, int count, size_t capacity) {
+
+	MutableSet *set = $$(MutableSet, setWithCapacity, capacity);
+
+	for (int i = 0; i < count; i += step) {
+		Number *number = $$(Number, numberWithValue, i);
+		$(set, addObject, number);
+		release(number);
+	}
+
+	return set;
+}
+
+START_TEST(algebra)
+	{
+		MutableSet *set = multiples(2, 100, 64);
+		MutableSet *threes = multiples(3, 150, 1024);
+
+		$(set, unionWithSet, (Set *) threes);
+		ck_assert_int_eq(50 + 50 - 17, ((Set *) set)->count);
+		ck_assert($((Set *) threes, isSubsetOfSet, (Set *) set));
+
+		$(set, intersectSet, (Set *) threes);
+		ck_assert_int_eq(50, ((Set *) set)->count);
+		ck_assert($((Set *) set, isSubsetOfSet, (Set *) threes));
+
+		MutableSet *sixes = multiples(6, 150, 16);
+
+		$(set, minusSet, (Set *) sixes);
+		ck_assert_int_eq(25, ((Set *) set)->count);
+		ck_assert(!$((Set *) set, intersectsSet, (Set *) sixes));
+
+		$(set, intersectSet, (Set *) sixes);
+		ck_assert_int_eq(0, ((Set *) set)->count);
+
+		$(set, unionWithSet, (Set *) sixes);
+		$(set, minusSet, (Set *) threes);
+		ck_assert_int_eq(0, ((Set *) set)->count);
+
+		MutableSet *empty = $$(MutableSet, setWithCapacity, 0);
+		$(empty, unionWithSet, (Set *) sixes);
+		ck_assert_int_eq(((Set *) sixes)->count, ((Set *) empty)->count);
+
+		release(empty);
+		release(sixes);
+		release(threes);
+		release(set);
+
+	}END_TEST
+
+START_TEST(inlineStorage)
+	{
+		MutableSet *set = $$(MutableSet, set);
+
+		Number *numbers[SET_INLINE_CAPACITY * 2];
+		for (size_t i = 0; i < lengthof(numbers); i++) {
+			numbers[i] = $$(Number, numberWithValue, i);
+		}
+
+		for (size_t i = 0; i < SET_INLINE_CAPACITY; i++) {
+			$(set, addObject, numbers[i]);
+			$(set, addObject, numbers[i]);
+		}
+
+		ck_assert_ptr_eq(NULL, ((Set *) set)->elements);
+		ck_assert_int_eq(SET_INLINE_CAPACITY, ((Set *) set)->count);
+
+		for (size_t i = 0; i < SET_INLINE_CAPACITY; i += 2) {
+			$(set, removeObject, numbers[i]);
+		}
+
+		ck_assert_int_eq(SET_INLINE_CAPACITY / 2, ((Set *) set)->count);
+
+		for (size_t i = 0; i < SET_INLINE_CAPACITY; i++) {
+			ck_assert_int_eq(i & 1, $((Set *) set, containsObject, numbers[i]));
+		}
+
+		int counter = 0;
+		$((Set *) set, enumerateObjects, enumerator, &counter);
+		ck_assert_int_eq(SET_INLINE_CAPACITY / 2, counter);
+
+		MutableSet *copy = (MutableSet *) $((Object *) set, copy);
+		ck_assert($((Object *) copy, isEqual, (Object *) set));
+		ck_assert_int_eq($((Object *) copy, hash), $((Object *) set, hash));
+
+		for (size_t i = 0; i < lengthof(numbers); i++) {
+			$(set, addObject, numbers[i]);
+		}
+
+		ck_assert_ptr_ne(NULL, ((Set *) set)->elements);
+		ck_assert_int_eq(lengthof(numbers), ((Set *) set)->count);
+		ck_assert($((Set *) copy, isSubsetOfSet, (Set *) set));
+
+		$(set, minusSet, (Set *) copy);
+		ck_assert_int_eq(lengthof(numbers) - SET_INLINE_CAPACITY / 2, ((Set *) set)->count);
+
+		$(copy, unionWithSet, (Set *) set);
+		ck_assert_ptr_ne(NULL, ((Set *) copy)->elements);
+		ck_assert_int_eq(lengthof(numbers), ((Set *) copy)->count);
+
+		release(copy);
+		release(set);
+
+		for (size_t i = 0; i < lengthof(numbers); i++) {
+			ck_assert_int_eq(1, ((Object *) numbers[i])->referenceCount);
+			release(numbers[i]);
+		}
+
+	}END_TEST
+
+START_TEST(trimToSize)
+	{
+		MutableSet *set = $$(MutableSet, set);
+
+		Number *numbers[256];
+		for (size_t i = 0; i < lengthof(numbers); i++) {
+			numbers[i] = $$(Number, numberWithValue, i);
+			$(set, addObject, numbers[i]);
+		}
+
+		const size_t size = $((Object *) set, sizeInBytes);
+
+		$(set, trimToSize);
+		ck_assert_int_lt($((Object *) set, sizeInBytes), size);
+		ck_assert_int_eq(lengthof(numbers), ((Set *) set)->count);
+
+		for (size_t i = SET_INLINE_CAPACITY; i < lengthof(numbers); i++) {
+			$(set, removeObject, numbers[i]);
+		}
+
+		$(set, trimToSize);
+		ck_assert_ptr_eq(NULL, ((Set *) set)->elements);
+		ck_assert_int_eq(_MutableSet.instanceSize, $((Object *) set, sizeInBytes));
+
+		for (size_t i = 0; i < lengthof(numbers); i++) {
+			ck_assert_int_eq(i < SET_INLINE_CAPACITY, $((Set *) set, containsObject, numbers[i]));
+		}
+
+		release(set);
+
+		for (size_t i = 0; i < lengthof(numbers); i++) {
+			ck_assert_int_eq(1, ((Object *) numbers[i])->referenceCount);
+			release(numbers[i]);
+		}
+	}END_TEST
+
 int main(int argc, char **argv) {
 
 	TCase *tcase = tcase_create("mutableSet");
 	tcase_add_test(tcase, mutableSet);
+	tcase_add_test(tcase, algebra);
+	tcase_add_test(tcase, inlineStorage);
+	tcase_add_test(tcase, trimToSize);
 
 	Suite *suite = suite_create("mutableSet");
 	suite_add_tcase(suite, tcase);
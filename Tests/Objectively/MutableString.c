@@ -22,6 +22,7 @@
  */
 
 #include <check.h>
+#include <string.h>
 
 #include <Objectively.h>
 
@@ -46,6 +47,12 @@ START_TEST(string)
 		$(string, replaceStringInRange, range, goodbye);
 		ck_assert_str_eq("goodbye cruel world!", string->string.chars);
 
+		$(string, trimToSize);
+		ck_assert_int_eq(0, string->capacity);
+		ck_assert_ptr_eq(string->string.inlineChars, string->string.chars);
+		ck_assert_int_eq(_MutableString.instanceSize, $((Object *) string, sizeInBytes));
+		ck_assert_str_eq("goodbye cruel world!", string->string.chars);
+
 		String *copy = (String *) $((Object * ) string, copy);
 		ck_assert(classof(copy) == &_MutableString);
 		ck_assert($((Object *) string, isEqual, (Object *) copy));
@@ -57,10 +64,94 @@ START_TEST(string)
 
 	}END_TEST
 
+START_TEST(inlineStorage)
+	{
+		MutableString *string = $$(MutableString, string);
+
+		$(string, appendCharacters, "name");
+		ck_assert_ptr_eq(string->string.inlineChars, string->string.chars);
+		ck_assert_int_eq(0, string->capacity);
+
+		$(string, appendCharacters, " and a much longer suffix");
+		ck_assert_ptr_ne(string->string.inlineChars, string->string.chars);
+		ck_assert_str_eq("name and a much longer suffix", string->string.chars);
+		ck_assert_int_ge(string->capacity, string->string.length + 1);
+
+		const Range range = { 4, string->string.length - 5 };
+		$(string, deleteCharactersInRange, range);
+		ck_assert_str_eq("namex", string->string.chars);
+
+		$(string, trimToSize);
+		ck_assert_ptr_eq(string->string.inlineChars, string->string.chars);
+		ck_assert_str_eq("namex", string->string.chars);
+
+		release(string);
+	}END_TEST
+
+START_TEST(append)
+	{
+		MutableString *string = $$(MutableString, string);
+
+		$(string, appendBytes, (const uint8_t *) "abcdef", 3);
+		ck_assert_str_eq("abc", string->string.chars);
+		ck_assert_int_eq(3, string->string.length);
+
+		$(string, reserveCapacity, 1000);
+		ck_assert_int_ge(string->capacity, 1001);
+
+		char *chars = string->string.chars;
+
+		for (int i = 0; i < 100; i++) {
+			$(string, appendFormat, "%03d,", i);
+		}
+
+		ck_assert_ptr_eq(chars, string->string.chars);
+		ck_assert_int_eq(403, string->string.length);
+		ck_assert(strncmp(string->string.chars + 3, "000,001,", 8) == 0);
+		ck_assert_int_eq(strlen(string->string.chars), string->string.length);
+
+		$(string, appendString, (String *) string);
+		ck_assert_int_eq(806, string->string.length);
+		ck_assert(strncmp(string->string.chars + 403, "abc000,001,", 11) == 0);
+
+		$(string, appendFormat, "%0*d", 5000, 7);
+		ck_assert_int_eq(5806, string->string.length);
+		ck_assert_int_eq('7', string->string.chars[5805]);
+		ck_assert_int_eq(strlen(string->string.chars), string->string.length);
+
+		release(string);
+
+		string = $$(MutableString, string);
+		$(string, appendCharacters, "a formatted string, too long to be stored inline");
+		$(string, trimToSize);
+
+		const size_t length = string->string.length;
+
+		$(string, appendFormat, "%s|%s", string->string.chars, string->string.chars);
+		ck_assert_int_eq(length * 3 + 1, string->string.length);
+		ck_assert(strncmp(string->string.chars, string->string.chars + length, length) == 0);
+		ck_assert_int_eq('|', string->string.chars[length * 2]);
+		ck_assert(strncmp(string->string.chars, string->string.chars + length * 2 + 1, length) == 0);
+
+		release(string);
+
+		string = $$(MutableString, stringWithCapacity, 200);
+		$(string, appendCharacters, "thirty characters of spare cap");
+
+		$(string, appendFormat, "-%s-%s", string->string.chars, string->string.chars);
+		ck_assert_int_eq(92, string->string.length);
+		ck_assert_str_eq("thirty characters of spare cap-thirty characters of spare cap-thirty characters of spare cap",
+				string->string.chars);
+
+		release(string);
+	}END_TEST
+
 int main(int argc, char **argv) {
 
 	TCase *tcase = tcase_create("string");
 	tcase_add_test(tcase, string);
+	tcase_add_test(tcase, inlineStorage);
+	tcase_add_test(tcase, append);
 
 	Suite *suite = suite_create("string");
 	suite_add_tcase(suite, tcase);
@@ -0,0 +1,230 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <check.h>
+
+#include <Objectively.h>
+
+/**
+ * @brief ParallelFunction that marks each index of its chunk.
+ */
+static void parallelFor_function(size_t chunk, size_t begin, size_t end, ident data) {
+
+	int *marks = data;
+
+	for (size_t i = begin; i < end; i++) {
+		__sync_fetch_and_add(&marks[i], 1);
+	}
+}
+
+START_TEST(parallelFor)
+	{
+		int marks[1000] = { 0 };
+
+		ParallelFor(lengthof(marks), 0, parallelFor_function, marks);
+		ParallelFor(lengthof(marks), 7, parallelFor_function, marks);
+		ParallelFor(0, 0, parallelFor_function, marks);
+
+		for (size_t i = 0; i < lengthof(marks); i++) {
+			ck_assert_int_eq(2, marks[i]);
+		}
+
+		ck_assert(ParallelThreadCount() > 0);
+		ck_assert_int_eq(1, ParallelChunkSize(0, 0));
+		ck_assert_int_eq(16, ParallelChunkSize(1000, 16));
+
+	}END_TEST
+
+static _Bool isEven(ident obj, ident data) {
+	return ($((Number *) obj, intValue) & 1) == 0;
+}
+
+static _Bool isEvenPair(const Dictionary *dictionary, ident obj, ident key, ident data) {
+	return isEven(obj, data);
+}
+
+static ident square(ident obj, ident data) {
+	const int i = $((Number *) obj, intValue);
+	return $$(Number, numberWithValue, i * i);
+}
+
+static ident sum(ident obj, ident accumulator, ident data) {
+
+	const double a = accumulator ? ((Number *) accumulator)->value : 0.0;
+	return $$(Number, numberWithValue, a + ((Number *) obj)->value);
+}
+
+static _Bool countObjects(const Array *array, ident obj, ident data) {
+	__sync_fetch_and_add((int *) data, 1); return false;
+}
+
+static _Bool countPairs(const Dictionary *dictionary, ident obj, ident key, ident data) {
+	__sync_fetch_and_add((int *) data, 1); return false;
+}
+
+static _Bool countElements(const Set *set, ident obj, ident data) {
+	__sync_fetch_and_add((int *) data, 1); return false;
+}
+
+START_TEST(array)
+	{
+		MutableArray *array = $$(MutableArray, array);
+
+		for (int i = 0; i < 1000; i++) {
+			Number *number = $$(Number, numberWithValue, i);
+			$(array, addObject, number);
+			release(number);
+		}
+
+		const Array *a = (Array *) array;
+
+		int count = 0;
+		$(a, enumerateObjectsConcurrently, countObjects, &count, 0);
+		ck_assert_int_eq(1000, count);
+
+		Array *filtered = $(a, filterConcurrently, isEven, NULL, 3);
+		ck_assert_int_eq(500, filtered->count);
+		for (int i = 0; i < 500; i++) {
+			ck_assert_int_eq(i * 2, $((Number *) $(filtered, objectAtIndex, i), intValue));
+		}
+
+		Array *mapped = $(a, mapConcurrently, square, NULL, 0);
+		ck_assert_int_eq(1000, mapped->count);
+		for (int i = 0; i < 1000; i++) {
+			ck_assert_int_eq(i * i, $((Number *) $(mapped, objectAtIndex, i), intValue));
+		}
+
+		Number *total = $(a, reduceConcurrently, sum, NULL, NULL, 10);
+		ck_assert_int_eq(499500, $(total, intValue));
+
+		Array *empty = $$(Array, arrayWithObjects, NULL);
+		ck_assert_ptr_eq(NULL, $(empty, reduceConcurrently, sum, NULL, NULL, 0));
+
+		release(empty);
+		release(total);
+		release(mapped);
+		release(filtered);
+		release(array);
+
+	}END_TEST
+
+START_TEST(dictionary)
+	{
+		MutableDictionary *dictionary = $$(MutableDictionary, dictionary);
+
+		for (int i = 0; i < 1000; i++) {
+			Number *number = $$(Number, numberWithValue, i);
+			String *key = $$(String, stringWithFormat, "%d", i);
+			$(dictionary, setObjectForKey, number, key);
+			release(number);
+			release(key);
+		}
+
+		const Dictionary *d = (Dictionary *) dictionary;
+
+		int count = 0;
+		$(d, enumerateObjectsConcurrently, countPairs, &count, 0);
+		ck_assert_int_eq(1000, count);
+
+		Dictionary *filtered = $(d, filterConcurrently, isEvenPair, NULL, 0);
+		ck_assert_int_eq(500, filtered->count);
+		ck_assert_ptr_ne(NULL, $(filtered, objectForKeyPath, "42"));
+		ck_assert_ptr_eq(NULL, $(filtered, objectForKeyPath, "43"));
+
+		Dictionary *mapped = $(d, mapConcurrently, square, NULL, 0);
+		ck_assert_int_eq(1000, mapped->count);
+		ck_assert_int_eq(43 * 43, $((Number *) $(mapped, objectForKeyPath, "43"), intValue));
+
+		Number *total = $(d, reduceConcurrently, sum, NULL, NULL, 0);
+		ck_assert_int_eq(499500, $(total, intValue));
+
+		release(total);
+		release(mapped);
+		release(filtered);
+		release(dictionary);
+
+	}END_TEST
+
+START_TEST(set)
+	{
+		MutableSet *set = $$(MutableSet, set);
+
+		for (int i = 0; i < 1000; i++) {
+			Number *number = $$(Number, numberWithValue, i);
+			$(set, addObject, number);
+			release(number);
+		}
+
+		const Set *s = (Set *) set;
+
+		int count = 0;
+		$(s, enumerateObjectsConcurrently, countElements, &count, 0);
+		ck_assert_int_eq(1000, count);
+
+		Set *filtered = $(s, filterConcurrently, isEven, NULL, 0);
+		ck_assert_int_eq(500, filtered->count);
+
+		Number *two = $$(Number, numberWithValue, 2);
+		Number *three = $$(Number, numberWithValue, 3);
+		Number *nine = $$(Number, numberWithValue, 9);
+
+		ck_assert($(filtered, containsObject, two));
+		ck_assert(!$(filtered, containsObject, three));
+
+		Set *mapped = $(s, mapConcurrently, square, NULL, 0);
+		ck_assert_int_eq(1000, mapped->count);
+		ck_assert($(mapped, containsObject, nine));
+
+		Number *total = $(s, reduceConcurrently, sum, NULL, NULL, 0);
+		ck_assert_int_eq(499500, $(total, intValue));
+
+		release(two);
+		release(three);
+		release(nine);
+		release(total);
+		release(mapped);
+		release(filtered);
+		release(set);
+
+	}END_TEST
+
+int main(int argc, char **argv) {
+
+	TCase *tcase = tcase_create("parallel");
+	tcase_add_test(tcase, parallelFor);
+	tcase_add_test(tcase, array);
+	tcase_add_test(tcase, dictionary);
+	tcase_add_test(tcase, set);
+
+	Suite *suite = suite_create("parallel");
+	suite_add_tcase(suite, tcase);
+
+	SRunner *runner = srunner_create(suite);
+
+	srunner_run_all(runner, CK_VERBOSE);
+	int failed = srunner_ntests_failed(runner);
+
+	srunner_free(runner);
+
+	return failed;
+}
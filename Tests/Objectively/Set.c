@@ -22,6 +22,7 @@
  */
 
 #include <check.h>
+#include <string.h>
 
 #include <Objectively.h>
 
@@ -75,10 +76,104 @@ START_TEST(set)
 
 	}END_TEST
 
+START_TEST(iterator)
+	{
+		Number *one = $$(Number, numberWithValue, 1);
+		Number *two = $$(Number, numberWithValue, 2);
+
+		Set *set = $$(Set, setWithObjects, one, two, NULL);
+
+		Number *number;
+		double sum = 0;
+
+		SetForEach(number, set) {
+			sum += number->value;
+		}
+
+		ck_assert_int_eq(3, (int) sum);
+
+		Set *empty = $$(Set, setWithObjects, NULL);
+		SetIterator iterator = MakeSetIterator(empty);
+
+		ck_assert(!SetIteratorNext(&iterator, (ident *) &number));
+
+		String *desc = $((Object *) set, description);
+		ck_assert(strstr(desc->chars, ", ") != NULL);
+
+		release(desc);
+		release(empty);
+		release(set);
+		release(one);
+		release(two);
+
+	}END_TEST
+
+/**
+ * @return A new MutableSet of the Numbers from `0` to `count` that are multiples of `step`.
+ */
+static MutableSet *multiples(int step, int count, size_t capacity) {
+
+	MutableSet *set = $$(MutableSet, setWithCapacity, capacity);
+
+	for (int i = 0; i < count; i += step) {
+		Number *number = $$(Number, numberWithValue, i);
+		$(set, addObject, number);
+		release(number);
+	}
+
+	return set;
+}
+
+START_TEST(algebra)
+	{
+		Set *twos = (Set *) multiples(2, 100, 64);
+		Set *threes = (Set *) multiples(3, 150, 64);
+		Set *sixes = (Set *) multiples(6, 100, 1024);
+
+		Set *intersection = $(twos, setByIntersectingSet, threes);
+		ck_assert_int_eq(17, intersection->count);
+		ck_assert($(intersection, isSubsetOfSet, twos));
+		ck_assert($(intersection, isSubsetOfSet, threes));
+		ck_assert($(intersection, isSubsetOfSet, sixes));
+		ck_assert($(sixes, isSubsetOfSet, intersection));
+
+		Set *difference = $(twos, setBySubtractingSet, threes);
+		ck_assert_int_eq(50 - 17, difference->count);
+		ck_assert(!$(difference, intersectsSet, threes));
+		ck_assert($(difference, intersectsSet, twos));
+
+		Set *union_ = $(twos, setByUnioningSet, threes);
+		ck_assert_int_eq(50 + 50 - 17, union_->count);
+		ck_assert($(twos, isSubsetOfSet, union_));
+		ck_assert($(threes, isSubsetOfSet, union_));
+		ck_assert(!$(union_, isSubsetOfSet, twos));
+
+		ck_assert($(sixes, isSubsetOfSet, twos));
+		ck_assert($(twos, intersectsSet, sixes));
+
+		Set *other = $(sixes, setByIntersectingSet, twos);
+		ck_assert_int_eq(sixes->count, other->count);
+		release(other);
+
+		other = $(sixes, setByUnioningSet, threes);
+		ck_assert_int_eq(threes->count, other->count);
+		release(other);
+
+		release(union_);
+		release(difference);
+		release(intersection);
+		release(sixes);
+		release(threes);
+		release(twos);
+
+	}END_TEST
+
 int main(int argc, char **argv) {
 
 	TCase *tcase = tcase_create("set");
 	tcase_add_test(tcase, set);
+	tcase_add_test(tcase, iterator);
+	tcase_add_test(tcase, algebra);
 
 	Suite *suite = suite_create("set");
 	suite_add_tcase(suite, tcase);
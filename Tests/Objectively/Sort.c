@@ -0,0 +1,229 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <check.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <Objectively.h>
+
+typedef struct {
+	int key;
+	int sequence;
+} Item;
+
+static Order compareNumbers(const ident a, const ident b) {
+	return $((Number *) a, compareTo, (Number *) b);
+}
+
+static Order compareKeys(const ident a, const ident b) {
+
+	const int i = ((Item *) a)->key, j = ((Item *) b)->key;
+
+	return i < j ? OrderAscending : i > j ? OrderDescending : OrderSame;
+}
+
+/**
+ * @brief Sorts `count` Items generated by `generator` with each option, and verifies the result.
+ */
+static void sortItems(size_t count, int (*generator)(size_t i, size_t count)) {
+
+	const SortOptions options[] = {
+		SortOptionNone,
+		SortOptionStable,
+		SortOptionConcurrent
+	};
+
+	Item *items = calloc(count, sizeof(Item));
+	ident *elements = calloc(count, sizeof(ident));
+
+	for (size_t i = 0; i < count; i++) {
+		items[i].key = generator(i, count);
+		items[i].sequence = (int) i;
+	}
+
+	for (size_t o = 0; o < lengthof(options); o++) {
+
+		for (size_t i = 0; i < count; i++) {
+			elements[i] = items + i;
+		}
+
+		Sort(elements, count, compareKeys, options[o]);
+
+		for (size_t i = 1; i < count; i++) {
+
+			const Item *a = elements[i - 1], *b = elements[i];
+
+			ck_assert_int_le(a->key, b->key);
+
+			if (options[o] != SortOptionNone && a->key == b->key) {
+				ck_assert_int_lt(a->sequence, b->sequence);
+			}
+		}
+	}
+
+	free(elements);
+	free(items);
+}
+
+static int ascending(size_t i, size_t count) {
+	return (int) i;
+}
+
+static int descending(size_t i, size_t count) {
+	return (int) (count - i);
+}
+
+static int uniform(size_t i, size_t count) {
+	return rand() % (count / 16 + 1);
+}
+
+static int sawtooth(size_t i, size_t count) {
+	return (int) (i % 1000);
+}
+
+static int equal(size_t i, size_t count) {
+	return 1;
+}
+
+START_TEST(sort)
+	{
+		srand(time(NULL));
+
+		const size_t counts[] = { 0, 1, 2, 23, 24, 100, 1000, 100000, 300000 };
+
+		for (size_t i = 0; i < lengthof(counts); i++) {
+			sortItems(counts[i], ascending);
+			sortItems(counts[i], descending);
+			sortItems(counts[i], uniform);
+			sortItems(counts[i], sawtooth);
+			sortItems(counts[i], equal);
+		}
+
+	}END_TEST
+
+START_TEST(sortedArrayWithOptions)
+	{
+		MutableArray *array = $$(MutableArray, array);
+
+		for (int i = 0; i < 100; i++) {
+
+			Number *number = $$(Number, numberWithValue, 100 - i);
+
+			$(array, addObject, number);
+
+			release(number);
+		}
+
+		Array *sorted = $((Array *) array, sortedArrayWithOptions, compareNumbers, SortOptionStable);
+
+		ck_assert_int_eq(100, sorted->count);
+
+		for (int i = 0; i < 100; i++) {
+			ck_assert_int_eq(i + 1, $((Number *) $(sorted, objectAtIndex, i), intValue));
+		}
+
+		release(sorted);
+		release(array);
+
+	}END_TEST
+
+static Order compareStrings(const ident a, const ident b) {
+
+	const int i = strcmp(((String *) a)->chars, ((String *) b)->chars);
+
+	return i < 0 ? OrderAscending : i > 0 ? OrderDescending : OrderSame;
+}
+
+START_TEST(sortByKey)
+	{
+		MutableArray *numbers = $$(MutableArray, array);
+
+		for (int i = 0; i < 10000; i++) {
+
+			Number *number = $$(Number, numberWithValue, (rand() - RAND_MAX / 2) / 100.0);
+
+			$(numbers, addObject, number);
+
+			release(number);
+		}
+
+		Array *expected = $((Array *) numbers, sortedArrayWithOptions, compareNumbers, SortOptionStable);
+
+		$(numbers, sortByKey);
+
+		for (size_t i = 0; i < expected->count; i++) {
+			ck_assert_ptr_eq($(expected, objectAtIndex, i), $((Array *) numbers, objectAtIndex, i));
+		}
+
+		release(expected);
+		release(numbers);
+
+		MutableArray *strings = $$(MutableArray, array);
+
+		const char *prefixes[] = {
+			"", "a", "ab", "abcdefgh", "abcdefghi",
+			"0123456789012345678901234567890123456789012345678901234567890123456789"
+		};
+
+		for (int i = 0; i < 10000; i++) {
+
+			String *string = str("%s%d", prefixes[rand() % lengthof(prefixes)], rand() % 100);
+
+			$(strings, addObject, string);
+
+			release(string);
+		}
+
+		expected = $((Array *) strings, sortedArrayWithOptions, compareStrings, SortOptionStable);
+
+		$(strings, sortByKey);
+
+		for (size_t i = 0; i < expected->count; i++) {
+			ck_assert_ptr_eq($(expected, objectAtIndex, i), $((Array *) strings, objectAtIndex, i));
+		}
+
+		release(expected);
+		release(strings);
+
+	}END_TEST
+
+int main(int argc, char **argv) {
+
+	TCase *tcase = tcase_create("sort");
+	tcase_add_test(tcase, sort);
+	tcase_add_test(tcase, sortedArrayWithOptions);
+	tcase_add_test(tcase, sortByKey);
+
+	Suite *suite = suite_create("sort");
+	suite_add_tcase(suite, tcase);
+
+	SRunner *runner = srunner_create(suite);
+
+	srunner_run_all(runner, CK_VERBOSE);
+	int failed = srunner_ntests_failed(runner);
+
+	srunner_free(runner);
+
+	return failed;
+}
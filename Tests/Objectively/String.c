@@ -21,6 +21,8 @@
  * 3. This notice may not be removed or altered from any source distribution.
  */
 
+#include <string.h>
+#include <strings.h>
 #include <unistd.h>
 #include <check.h>
 
@@ -99,10 +101,422 @@ START_TEST(string)
 
 	}END_TEST
 
+START_TEST(inlineStorage)
+	{
+		String *shortString = $$(String, stringWithCharacters, "Content-Type");
+		ck_assert_ptr_eq(shortString->inlineChars, shortString->chars);
+		ck_assert_str_eq("Content-Type", shortString->chars);
+		ck_assert_int_eq(_String.instanceSize, $((Object *) shortString, sizeInBytes));
+
+		String *longString = $$(String, stringWithFormat, "%s, %s", "a considerably longer", "heap allocated string");
+		ck_assert_ptr_ne(longString->inlineChars, longString->chars);
+		ck_assert_str_eq("a considerably longer, heap allocated string", longString->chars);
+
+		String *formatted = $$(String, stringWithFormat, "%d bottles", 99);
+		ck_assert_ptr_eq(formatted->inlineChars, formatted->chars);
+		ck_assert_str_eq("99 bottles", formatted->chars);
+
+		const Range range = { 2, 12 };
+		String *substring = $(longString, substring, range);
+		ck_assert_ptr_eq(substring->inlineChars, substring->chars);
+		ck_assert_str_eq("considerably", substring->chars);
+
+		String *bytes = $$(String, stringWithBytes, (const uint8_t *) "id", 2, STRING_ENCODING_UTF8);
+		ck_assert_ptr_eq(bytes->inlineChars, bytes->chars);
+		ck_assert_str_eq("id", bytes->chars);
+
+		String *copy = (String *) $((Object *) shortString, copy);
+		ck_assert($((Object *) copy, isEqual, (Object *) shortString));
+		ck_assert_int_eq($((Object *) copy, hash), $((Object *) shortString, hash));
+
+		release(shortString);
+		release(longString);
+		release(formatted);
+		release(substring);
+		release(bytes);
+		release(copy);
+	}END_TEST
+
+START_TEST(views)
+	{
+		String *string = $$(String, stringWithCharacters, "the first long component,short,the final and longest component");
+
+		const Range suffix = { 10, string->length - 10 };
+		String *substring = $(string, substring, suffix);
+		ck_assert_ptr_eq(string->chars + 10, substring->chars);
+		ck_assert_ptr_eq(string, substring->backing);
+		ck_assert_int_eq(2, ((Object *) string)->referenceCount);
+
+		$(substring, compact);
+		ck_assert_ptr_eq(NULL, substring->backing);
+		ck_assert_ptr_ne(string->chars + 10, substring->chars);
+		ck_assert_int_eq(1, ((Object *) string)->referenceCount);
+		ck_assert_str_eq("long component,short,the final and longest component", substring->chars);
+
+		Array *components = $(string, componentsSeparatedByCharacters, ",");
+		ck_assert_int_eq(3, components->count);
+
+		String *first = $(components, objectAtIndex, 0);
+		String *second = $(components, objectAtIndex, 1);
+		String *third = $(components, objectAtIndex, 2);
+
+		ck_assert_str_eq("the first long component", first->chars);
+		ck_assert_str_eq("short", second->chars);
+		ck_assert_str_eq("the final and longest component", third->chars);
+
+		ck_assert_ptr_ne(NULL, first->backing);
+		ck_assert_ptr_eq(first->backing, third->backing);
+		ck_assert_ptr_eq(second->inlineChars, second->chars);
+
+		String *copy = $$(String, stringWithCharacters, "the final and longest component");
+		ck_assert($((Object *) copy, isEqual, (Object *) third));
+		ck_assert_int_eq($((Object *) copy, hash), $((Object *) third, hash));
+		release(copy);
+
+		release(string);
+		release(substring);
+		release(components);
+	}END_TEST
+
+/**
+ * @brief The naive search that rangeOfCharactersWithOptions must agree with.
+ */
+static Range naiveRangeOfCharacters(const String *string, const char *chars, const Range range, StringSearchOptions options) {
+
+	const int length = (int) strlen(chars);
+
+	for (int i = 0; i + length <= range.length; i++) {
+
+		const int location = options & StringSearchOptionBackwards ? range.location + range.length - length - i : range.location + i;
+
+		const int cmp = options & StringSearchOptionCaseInsensitive ?
+			strncasecmp(string->chars + location, chars, length) :
+			strncmp(string->chars + location, chars, length);
+
+		if (cmp == 0 && length) {
+			return (Range) { location, length };
+		}
+
+		if (options & StringSearchOptionAnchored) {
+			break;
+		}
+	}
+
+	return (Range) { -1, 0 };
+}
+
+START_TEST(search)
+	{
+		String *string = $$(String, stringWithCharacters, "Hello, World! The quick brown fox jumps over the lazy dog.");
+		const Range all = { 0, string->length };
+
+		Range range = $(string, rangeOfCharacters, "o", all);
+		ck_assert_int_eq(4, range.location);
+		ck_assert_int_eq(1, range.length);
+
+		range = $(string, rangeOfCharactersWithOptions, "o", all, StringSearchOptionBackwards);
+		ck_assert_int_eq(string->length - 3, range.location);
+
+		range = $(string, rangeOfCharactersWithOptions, "the", all, StringSearchOptionCaseInsensitive);
+		ck_assert_int_eq(14, range.location);
+
+		range = $(string, rangeOfCharactersWithOptions, "THE", all, StringSearchOptionCaseInsensitive | StringSearchOptionBackwards);
+		ck_assert_int_eq(45, range.location);
+
+		range = $(string, rangeOfCharactersWithOptions, "Hello", all, StringSearchOptionAnchored);
+		ck_assert_int_eq(0, range.location);
+
+		range = $(string, rangeOfCharactersWithOptions, "World", all, StringSearchOptionAnchored);
+		ck_assert_int_eq(-1, range.location);
+
+		range = $(string, rangeOfCharactersWithOptions, "dog.", all, StringSearchOptionAnchored | StringSearchOptionBackwards);
+		ck_assert_int_eq(string->length - 4, range.location);
+
+		range = $(string, rangeOfCharacters, "World", (const Range) { 0, 10 });
+		ck_assert_int_eq(-1, range.location);
+
+		release(string);
+
+		srand(1);
+
+		char chars[4096 + 1];
+		for (size_t i = 0; i < sizeof(chars) - 1; i++) {
+			chars[i] = "abAB"[rand() % 4];
+		}
+		chars[sizeof(chars) - 1] = '\0';
+
+		string = $$(String, stringWithCharacters, chars);
+
+		for (int i = 0; i < 2000; i++) {
+
+			char needle[48];
+			const int length = 1 + rand() % (i & 1 ? 6 : 40);
+			const int location = rand() % (string->length - length);
+
+			memcpy(needle, chars + location, length);
+			needle[length] = '\0';
+
+			if (rand() % 4 == 0) {
+				needle[rand() % length] = 'c';
+			}
+
+			const int a = rand() % string->length;
+			const int b = rand() % string->length;
+			const Range range = { min(a, b), max(a, b) - min(a, b) };
+
+			const StringSearchOptions options = rand() % 8;
+
+			const Range expected = naiveRangeOfCharacters(string, needle, range, options);
+			const Range actual = $(string, rangeOfCharactersWithOptions, needle, range, options);
+
+			ck_assert_int_eq(expected.location, actual.location);
+			ck_assert_int_eq(expected.length, actual.length);
+		}
+
+		release(string);
+	}END_TEST
+
+START_TEST(transcoding)
+	{
+		const char *chars = "Ünïcödé \xf0\x9f\x98\x80 and ASCII";
+		String *string = $$(String, stringWithCharacters, chars);
+
+		const StringEncoding encodings[] = {
+			STRING_ENCODING_UTF8,
+			STRING_ENCODING_UTF16,
+			STRING_ENCODING_UTF32,
+			STRING_ENCODING_WCHAR,
+		};
+
+		for (size_t i = 0; i < lengthof(encodings); i++) {
+
+			Data *data = $(string, getData, encodings[i]);
+			ck_assert(data->length >= string->length);
+
+			String *decoded = $$(String, stringWithData, data, encodings[i]);
+			ck_assert_str_eq(chars, decoded->chars);
+
+			release(decoded);
+			release(data);
+		}
+
+		const uint8_t utf16[] = { 0xff, 0xfe, 'h', 0, 'i', 0, 0x3d, 0xd8, 0x00, 0xde };
+		String *swapped = $$(String, stringWithBytes, utf16, sizeof(utf16), STRING_ENCODING_UTF16);
+		ck_assert_str_eq("hi\xf0\x9f\x98\x80", swapped->chars);
+		release(swapped);
+
+		const uint8_t latin1[] = { 'c', 0xe9, 'l', 0xe8, 'b', 'r', 'e' };
+		String *celebre = $$(String, stringWithBytes, latin1, sizeof(latin1), STRING_ENCODING_LATIN1);
+		ck_assert_str_eq("célèbre", celebre->chars);
+
+		Data *data = $(celebre, getData, STRING_ENCODING_LATIN1);
+		ck_assert_int_eq(sizeof(latin1), data->length);
+		ck_assert(memcmp(latin1, data->bytes, sizeof(latin1)) == 0);
+		release(data);
+
+		release(celebre);
+
+		String *dvorak = $$(String, stringWithCharacters, "Dvořák");
+		Data *latin2 = $(dvorak, getData, STRING_ENCODING_LATIN2);
+		ck_assert_int_eq(6, latin2->length);
+		String *fromLatin2 = $$(String, stringWithData, latin2, STRING_ENCODING_LATIN2);
+		ck_assert_str_eq("Dvořák", fromLatin2->chars);
+		release(fromLatin2);
+		release(latin2);
+		release(dvorak);
+
+		String *empty = $$(String, stringWithCharacters, "");
+		Data *emptyData = $(empty, getData, STRING_ENCODING_UTF32);
+		ck_assert_int_eq(0, emptyData->length);
+		release(emptyData);
+		release(empty);
+
+		String *lower = $(string, lowercaseString);
+		ck_assert(strstr(lower->chars, " and ascii"));
+		release(lower);
+
+		String *long_ = $$(String, stringWithCharacters, "Mixed Case Text That Is Long Enough For Vectors, 123!");
+		String *upper = $(long_, uppercaseString);
+		ck_assert_str_eq("MIXED CASE TEXT THAT IS LONG ENOUGH FOR VECTORS, 123!", upper->chars);
+		String *lowerAgain = $(upper, lowercaseString);
+		ck_assert_str_eq("mixed case text that is long enough for vectors, 123!", lowerAgain->chars);
+		release(lowerAgain);
+		release(upper);
+		release(long_);
+
+		Locale *locale = alloc(Locale, initWithIdentifier, "C.UTF-8");
+		if (locale) {
+			String *unicode = $(string, uppercaseStringWithLocale, locale);
+			ck_assert_str_eq("ÜNÏCÖDÉ \xf0\x9f\x98\x80 AND ASCII", unicode->chars);
+			release(unicode);
+			release(locale);
+		}
+
+		release(string);
+	}END_TEST
+
+START_TEST(interning)
+	{
+		String *a = $$(String, stringWithCharacters, "an interned string, long enough for the heap");
+		String *b = $$(String, stringWithFormat, "an interned string, long enough for the %s", "heap");
+
+		String *internedA = $(a, intern);
+		String *internedB = $(b, intern);
+
+		ck_assert_ptr_eq(internedA, internedB);
+		ck_assert(internedA->isInterned);
+		ck_assert_ptr_eq(internedA, $(internedA, intern));
+
+		const char *chars = "an interned string, long enough for the heap, or not";
+		ck_assert_ptr_eq(internedA, $$(String, internedStringWithCharacters, chars, internedA->length));
+
+		MutableString *mutable = $$(MutableString, string);
+		$(mutable, appendCharacters, "mutable");
+
+		String *internedMutable = $((String *) mutable, intern);
+		ck_assert_ptr_ne((String *) mutable, internedMutable);
+		ck_assert(classof(internedMutable) == &_String);
+
+		$(mutable, appendCharacters, " and changed");
+		ck_assert_str_eq("mutable", internedMutable->chars);
+
+		ck_assert($((Object *) internedA, isEqual, (Object *) a));
+		ck_assert(!$((Object *) internedA, isEqual, (Object *) internedMutable));
+
+		release(mutable);
+		release(b);
+		release(a);
+	}END_TEST
+
+/**
+ * @return True if the `length` bytes at `bytes` are valid UTF-8, by the table of RFC 3629.
+ */
+static _Bool isValidUTF8(const uint8_t *bytes, size_t length) {
+
+	for (size_t i = 0; i < length; ) {
+
+		const uint8_t c = bytes[i];
+
+		size_t n;
+		uint8_t low = 0x80, high = 0xbf;
+
+		if (c < 0x80) {
+			n = 1;
+		} else if (c >= 0xc2 && c <= 0xdf) {
+			n = 2;
+		} else if (c >= 0xe0 && c <= 0xef) {
+			n = 3;
+			low = c == 0xe0 ? 0xa0 : 0x80;
+			high = c == 0xed ? 0x9f : 0xbf;
+		} else if (c >= 0xf0 && c <= 0xf4) {
+			n = 4;
+			low = c == 0xf0 ? 0x90 : 0x80;
+			high = c == 0xf4 ? 0x8f : 0xbf;
+		} else {
+			return false;
+		}
+
+		if (i + n > length) {
+			return false;
+		}
+
+		for (size_t j = 1; j < n; j++) {
+			const uint8_t lo = j == 1 ? low : 0x80;
+			const uint8_t hi = j == 1 ? high : 0xbf;
+			if (bytes[i + j] < lo || bytes[i + j] > hi) {
+				return false;
+			}
+		}
+
+		i += n;
+	}
+
+	return true;
+}
+
+START_TEST(utf8)
+	{
+		const char *invalid[] = {
+			"\xc0\xaf", "\xe0\x80\xaf", "\xed\xa0\x80", "\xf4\x90\x80\x80", "\xf8\x88\x80\x80\x80", "\xe2\x82", "\x80"
+		};
+
+		for (size_t i = 0; i < lengthof(invalid); i++) {
+			const uint8_t *bytes = (const uint8_t *) invalid[i];
+			ck_assert(!IsValidUTF8(bytes, strlen(invalid[i])));
+			ck_assert_ptr_eq(NULL, $$(String, stringWithBytes, bytes, strlen(invalid[i]), STRING_ENCODING_UTF8));
+		}
+
+		const uint8_t pieces[][4] = {
+			{ 0xc3, 0xa9 }, { 0xe2, 0x82, 0xac }, { 0xf0, 0x9f, 0x98, 0x80 }, { 0xed, 0xa0 }, { 0x80 }, { 0xf4, 0x90 }
+		};
+
+		srand(49);
+
+		uint8_t bytes[300];
+		for (int i = 0; i < 2000; i++) {
+
+			size_t length = 0;
+			while (length < sizeof(bytes) - 4) {
+				if (rand() % 40) {
+					bytes[length++] = 'a' + rand() % 26;
+				} else {
+					const uint8_t *piece = pieces[rand() % (i % 2 ? 3 : lengthof(pieces))];
+					for (size_t j = 0; j < 4 && piece[j]; j++) {
+						bytes[length++] = piece[j];
+					}
+				}
+			}
+
+			length = rand() % length;
+
+			ck_assert_int_eq(isValidUTF8(bytes, length), IsValidUTF8(bytes, length));
+		}
+
+		const char *chars = "A long enough string, with é, € and \xf0\x9f\x98\x80, for vectors: ééééééééééééééééééééééééééééééééé";
+		String *string = $$(String, stringWithBytes, (const uint8_t *) chars, strlen(chars), STRING_ENCODING_UTF8);
+		ck_assert_ptr_ne(NULL, string);
+
+		size_t count = 0;
+		for (const uint8_t *c = (const uint8_t *) chars; *c; c++) {
+			count += (*c & 0xc0) != 0x80;
+		}
+
+		ck_assert_int_eq(count, $(string, codePointCount));
+
+		Data *data = $(string, getData, STRING_ENCODING_WCHAR);
+		const wchar_t *wide = (const wchar_t *) data->bytes;
+		ck_assert_int_eq(count, data->length / sizeof(wchar_t));
+
+		size_t i = 0;
+		Unicode c;
+		StringForEachCodePoint(c, string) {
+			ck_assert_int_eq(wide[i++], c);
+		}
+		ck_assert_int_eq(count, i);
+
+		release(data);
+		release(string);
+
+		String *invalidString = $$(String, stringWithMemory, strdup("a\xff" "b"), 3);
+		StringCodePointIterator iterator = MakeStringCodePointIterator(invalidString);
+		ck_assert(StringCodePointIteratorNext(&iterator, &c) && c == 'a');
+		ck_assert(StringCodePointIteratorNext(&iterator, &c) && c == 0xfffd);
+		ck_assert(StringCodePointIteratorNext(&iterator, &c) && c == 'b');
+		ck_assert(!StringCodePointIteratorNext(&iterator, &c));
+		release(invalidString);
+
+	}END_TEST
+
 int main(int argc, char **argv) {
 
 	TCase *tcase = tcase_create("string");
 	tcase_add_test(tcase, string);
+	tcase_add_test(tcase, inlineStorage);
+	tcase_add_test(tcase, views);
+	tcase_add_test(tcase, search);
+	tcase_add_test(tcase, transcoding);
+	tcase_add_test(tcase, interning);
+	tcase_add_test(tcase, utf8);
 
 	Suite *suite = suite_create("string");
 	suite_add_tcase(suite, tcase);
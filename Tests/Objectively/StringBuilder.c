@@ -0,0 +1,122 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <check.h>
+
+#include <Objectively.h>
+
+START_TEST(stringBuilder)
+	{
+		StringBuilder *builder = alloc(StringBuilder, init);
+		MutableString *expected = $$(MutableString, string);
+
+		char *chars = calloc(STRING_BUILDER_ADOPTION_MIN * 2 + 1, 1);
+		memset(chars, 'x', STRING_BUILDER_ADOPTION_MIN * 2);
+
+		String *adopted = $$(String, stringWithCharacters, chars);
+		Data *data = $$(Data, dataWithBytes, (uint8_t *) chars, STRING_BUILDER_ADOPTION_MIN);
+
+		for (int i = 0; i < 2000; i++) {
+
+			$(builder, appendFormat, "%d,", i);
+			$(expected, appendFormat, "%d,", i);
+
+			if (i % 500 == 0) {
+				$(builder, appendString, adopted);
+				$(expected, appendString, adopted);
+
+				$(builder, appendData, data);
+				$(expected, appendBytes, data->bytes, data->length);
+
+				$(builder, appendCharacters, "short");
+				$(expected, appendCharacters, "short");
+			}
+		}
+
+		ck_assert_int_eq(expected->string.length, builder->length);
+		ck_assert(builder->locals.count > 1);
+		ck_assert_int_eq(5, adopted->object.referenceCount);
+
+		String *string = $(builder, string);
+		ck_assert_str_eq(expected->string.chars, string->chars);
+
+		uint8_t bytes[1024];
+		const size_t offset = STRING_BUILDER_CHUNK_SIZE - 8;
+		ck_assert_int_eq(sizeof(bytes), $(builder, getBytes, bytes, offset, sizeof(bytes)));
+		ck_assert(memcmp(expected->string.chars + offset, bytes, sizeof(bytes)) == 0);
+		ck_assert_int_eq(4, $(builder, getBytes, bytes, builder->length - 4, sizeof(bytes)));
+		ck_assert_int_eq(0, $(builder, getBytes, bytes, builder->length, sizeof(bytes)));
+
+		FILE *file = tmpfile();
+		ck_assert($(builder, writeToFileDescriptor, fileno(file)));
+
+		char *written = calloc(builder->length + 1, 1);
+		rewind(file);
+		ck_assert_int_eq(builder->length, fread(written, 1, builder->length, file));
+		ck_assert_str_eq(expected->string.chars, written);
+
+		free(written);
+		fclose(file);
+
+		release(string);
+		release(builder);
+
+		ck_assert_int_eq(1, adopted->object.referenceCount);
+
+		release(data);
+		release(adopted);
+		release(expected);
+		free(chars);
+
+		builder = alloc(StringBuilder, init);
+		$(builder, appendFormat, "%s", "");
+
+		string = $(builder, string);
+		ck_assert_int_eq(0, string->length);
+
+		release(string);
+		release(builder);
+
+	}END_TEST
+
+int main(int argc, char **argv) {
+
+	TCase *tcase = tcase_create("stringBuilder");
+	tcase_add_test(tcase, stringBuilder);
+
+	Suite *suite = suite_create("stringBuilder");
+	suite_add_tcase(suite, tcase);
+
+	SRunner *runner = srunner_create(suite);
+
+	srunner_run_all(runner, CK_VERBOSE);
+	int failed = srunner_ntests_failed(runner);
+
+	srunner_free(runner);
+
+	return failed;
+}
@@ -0,0 +1,127 @@
+/*
+ * Objectively: Ultra-lightweight object oriented framework for GNU C.
+ * Copyright (C) 2014 Jay Dolan <jay@jaydolan.com>
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ * claim that you wrote the original software. If you use this software
+ * in a product, an acknowledgment in the product documentation would be
+ * appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ * misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <check.h>
+
+#include <Objectively.h>
+
+/**
+ * @brief Tokenizes `chars` with `strchr`, and compares each token to those of `tokenizer`.
+ */
+static void verify(StringTokenizer *tokenizer, const char *chars, size_t length, const char *delimiters) {
+
+	const _Bool skipEmpty = tokenizer->options & StringTokenizerOptionSkipEmpty;
+
+	size_t start = 0;
+	for (size_t i = 0; i <= length; i++) {
+		if (i == length || strchr(delimiters, chars[i])) {
+			if (i > start || !skipEmpty) {
+				Range range;
+				ck_assert($(tokenizer, nextToken, &range));
+				ck_assert_int_eq(start, range.location);
+				ck_assert_int_eq(i - start, range.length);
+			}
+			start = i + 1;
+		}
+	}
+
+	Range range;
+	ck_assert(!$(tokenizer, nextToken, &range));
+}
+
+START_TEST(stringTokenizer)
+	{
+		String *string = $$(String, stringWithCharacters, "a\tbb\t\tccc\n\ndddd\t");
+		StringTokenizer *tokenizer = alloc(StringTokenizer, initWithString, string, "\t\n", StringTokenizerOptionNone);
+
+		const char *expected[] = { "a", "bb", "", "ccc", "", "dddd", "" };
+
+		Range range;
+		for (size_t i = 0; i < lengthof(expected); i++) {
+			ck_assert($(tokenizer, nextToken, &range));
+
+			String *token = $(string, substring, range);
+			ck_assert_str_eq(expected[i], token->chars);
+			release(token);
+		}
+
+		ck_assert(!$(tokenizer, nextToken, &range));
+
+		$(tokenizer, reset);
+		tokenizer->options = StringTokenizerOptionSkipEmpty;
+
+		size_t count = 0;
+		while ($(tokenizer, nextToken, &range)) {
+			ck_assert_int_gt(range.length, 0);
+			count++;
+		}
+		ck_assert_int_eq(4, count);
+
+		release(tokenizer);
+		release(string);
+
+		const char *delimiterSets[] = { ",", "\t\n", "abcdefgh", "abcdefghij", "" };
+
+		srand(50);
+
+		char chars[400];
+		for (int i = 0; i < 1000; i++) {
+
+			const size_t length = rand() % sizeof(chars);
+			for (size_t j = 0; j < length; j++) {
+				chars[j] = rand() % 4 ? 'a' + rand() % 16 : ",\t\n"[rand() % 3];
+			}
+
+			Data *data = $$(Data, dataWithBytes, (uint8_t *) chars, length);
+
+			const char *delimiters = delimiterSets[i % lengthof(delimiterSets)];
+			const StringTokenizerOptions options = i & 1 ? StringTokenizerOptionSkipEmpty : StringTokenizerOptionNone;
+
+			tokenizer = alloc(StringTokenizer, initWithData, data, delimiters, options);
+			verify(tokenizer, chars, length, delimiters);
+
+			release(tokenizer);
+			release(data);
+		}
+
+	}END_TEST
+
+int main(int argc, char **argv) {
+
+	TCase *tcase = tcase_create("stringTokenizer");
+	tcase_add_test(tcase, stringTokenizer);
+
+	Suite *suite = suite_create("stringTokenizer");
+	suite_add_tcase(suite, tcase);
+
+	SRunner *runner = srunner_create(suite);
+
+	srunner_run_all(runner, CK_VERBOSE);
+	int failed = srunner_ntests_failed(runner);
+
+	srunner_free(runner);
+
+	return failed;
+}
@@ -83,6 +83,17 @@ START_TEST(url)
 
 		release(url);
 
+		url = alloc(URL, initWithCharactersWithOptions, "https://example.com/a", URL_INTERN_COMPONENTS);
+		URL *other = alloc(URL, initWithCharactersWithOptions, "https://example.com/b", URL_INTERN_COMPONENTS);
+
+		ck_assert(url->scheme->isInterned);
+		ck_assert_ptr_eq(url->scheme, other->scheme);
+		ck_assert_ptr_eq(url->host, other->host);
+		ck_assert_str_eq("example.com", other->host->chars);
+
+		release(other);
+		release(url);
+
 		url = alloc(URL, initWithCharacters, "malformed");
 		ck_assert(url == NULL);
 